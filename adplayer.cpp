@@ -21,64 +21,25 @@
 #include "adplayer.h"
 #include "music.h"
 #include "sfx.h"
+#include "timeline.h"
+#include "writelog.h"
 
 #include <stdexcept>
 #include <string>
 #include <cstring>
 #include <cstdio>
-#include <cstdlib>
 #include <iterator>
 #include <algorithm>
 
-void loadADFile(const std::string &filename, FileBuffer &data);
-void validateADFile(FileBuffer &data);
+#include <boost/chrono.hpp>
 
-void outputHelp() {
-	std::printf("Usage:\n"
-	            "\tadplayer [--loom] input-file\n"
-	            "\n"
-	            "\t    --loom        Switch for Loom v3 music files\n");
-}
-
-int main(int argc, char *argv[]) {
-	if (argc != 2 && argc != 3) {
-		outputHelp();
-		return -1;
-	}
-
-	const bool isLoom = (argc == 3 && !std::strcmp(argv[1], "--loom"));
+namespace {
+typedef boost::chrono::steady_clock ProfileClock;
 
-	try {
-		FileBuffer data;
-
-		std::string filename(argc == 3 ? argv[2] : argv[1]);
-		loadADFile(filename, data);
-		validateADFile(data);
-
-		if (SDL_Init(SDL_INIT_AUDIO) == -1)
-			throw std::runtime_error("Could not initialize SDL audio subsystem");
-
-		if (data.at(2) == 0x80) {
-			MusicPlayer player(data, isLoom);
-			player.startPlayback();
-			while (player.isPlaying())
-				SDL_Delay(100);
-			player.stopPlayback();
-		} else {
-			SfxPlayer player(data);
-			player.startPlayback();
-			while (player.isPlaying())
-				SDL_Delay(100);
-			player.stopPlayback();
-		}
-	} catch (const std::exception &e) {
-		std::fprintf(stderr,  "ERROR: %s\n", e.what());
-		return -1;
-	}
-
-	SDL_Quit();
-	return EXIT_SUCCESS;
+double secondsSince(ProfileClock::time_point start) {
+	return boost::chrono::duration<double>(ProfileClock::now() - start).count();
 }
+} // End of anonymous namespace
 
 void loadADFile(const std::string &filename, FileBuffer &data) {
 	data.clear();
@@ -119,116 +80,553 @@ void loadADFile(const std::string &filename, FileBuffer &data) {
 	}
 }
 
-void validateADFile(FileBuffer &data) {
-	try {
-		const bool isMusicFile = (data.at(2) == 0x80);
-		if (isMusicFile) {
-		} else {
-			if (data.at(1) > 3)
-				throw std::runtime_error("SFX start channel is too big");
-		}
-	} catch (const std::range_error &e) {
-		throw std::runtime_error("Premature end of file");
-	}
+void validateADFile(const FileBuffer &data) {
+	checkADOffset(data, 2, "Resource type");
+
+	if (data[2] == 0x80)
+		MusicPlayer::validate(data);
+	else
+		SfxPlayer::validate(data);
 }
 
-Player::Player(const FileBuffer &file)
-    : _file(file), _emulator(new DBOPL::Chip()), _obtained(),
-      _callbackFrequency(472), _samplesPerCallback(),
-      _samplesPerCallbackRemainder(), _samplesTillCallback(),
-      _samplesTillCallbackRemainder() {
-	DBOPL::InitTables();
+void checkADOffset(const FileBuffer &data, uint32_t offset, const char *what) {
+	if (offset >= data.size())
+		throwADError(std::string(what) + " exceeds the resource", offset);
+}
+
+void throwADError(const std::string &error, uint32_t offset) {
+	char position[32];
+	std::snprintf(position, sizeof(position), " at offset 0x%04X", static_cast<unsigned int>(offset));
+	throw std::runtime_error(error + position);
+}
 
-	SDL_AudioSpec desired;
-	memset(&desired, 0, sizeof(desired));
-	desired.freq = 44100;
-	desired.format = AUDIO_S16SYS;
-	desired.channels = 1;
-	desired.samples = 8192;
-	desired.callback = Player::readSamples;
-	desired.userdata = static_cast<void *>(this);
+Player *createPlayer(const FileBuffer &data, bool isLoom, int rate) {
+	validateADFile(data);
 
-	if (SDL_OpenAudio(&desired, &_obtained) < 0)
-		throw std::runtime_error("Could not open audio device");
-	if (_obtained.format != AUDIO_S16SYS) {
-		SDL_CloseAudio();
-		throw std::runtime_error("Could not obtain S16SYS audio format");
-	}
+	if (data[2] == 0x80)
+		return new MusicPlayer(data, isLoom, rate);
+	else
+		return new SfxPlayer(data, rate);
+}
 
-	_emulator->Setup(_obtained.freq);
+Player::Profile::Profile()
+    : callbacks(0), callbackSeconds(0), maxCallbackSeconds(0), blocks(0),
+      blockSamples(0), synthesisSeconds(0), maxSynthesisSeconds(0) {
+}
+
+Player::Player(const FileBuffer &file, int rate)
+    : _file(file), _emulator(new DBOPL::Opl2Chip()), _rate(rate),
+      _callbackFrequency(472), _samplesPerCallback(),
+      _samplesPerCallbackRemainder(), _samplesTillCallback(),
+      _samplesTillCallbackRemainder(), _recordTimeline(), _recordCallback(),
+      _seeking(false), _position(), _lastWritePosition(), _profile(), _trace(), _writeLog(), _writeLogStart(),
+      _exporting(false), _exportLoopPoints(), _exportLoopStart(), _exportLoopEnd(), _loopState(kLoopNone), _loopCache(), _loopCachePos(),
+      _loopLimit(kLoopForever), _loopCount(), _blockPos(), _blockLength() {
+	std::memset(_registerBackUpTable, 0, sizeof(_registerBackUpTable));
+	std::memset(_seekDirty, 0, sizeof(_seekDirty));
+	std::memset(_seekKeyOn, 0, sizeof(_seekKeyOn));
+	_emulator->Setup(_rate);
 
 	writeReg(0x01, 0x00);
 	writeReg(0xBD, 0x00);
 	writeReg(0x08, 0x00);
 	writeReg(0x01, 0x20);
 
-	_samplesPerCallback = _obtained.freq / _callbackFrequency;
-	_samplesPerCallbackRemainder = _obtained.freq % _callbackFrequency;
+	_samplesPerCallback = _rate / _callbackFrequency;
+	_samplesPerCallbackRemainder = _rate % _callbackFrequency;
 }
 
-void Player::startPlayback() {
-	SDL_PauseAudio(0);
-}
+void Player::writeReg(uint16_t reg, uint8_t data) {
+	if (_recordTimeline) {
+		_recordTimeline->addWrite(_recordCallback, reg, data);
+		return;
+	}
 
-void Player::stopPlayback() {
-	SDL_PauseAudio(1);
-	SDL_CloseAudio();
-}
+	if (_seeking) {
+		// Remember which notes were started, their key on bits are
+		// switched off and on again when the seek is finished.
+		uint8_t keyBits = 0;
+		if (reg >= 0xB0 && reg <= 0xB8)
+			keyBits = 0x20;
+		else if (reg == 0xBD)
+			keyBits = 0x1F;
+		_seekKeyOn[reg] |= data & ~_registerBackUpTable[reg] & keyBits;
+		_seekDirty[reg] = true;
+	} else {
+		writeEmulator(reg, data);
+		_lastWritePosition = _position;
+	}
 
-void Player::writeReg(uint16_t reg, uint8_t data) {
 	_registerBackUpTable[reg] = data;
-	_emulator->WriteReg(reg, data);
 }
 
 uint16_t Player::readWord(const uint32_t offset) const {
-	return static_cast<uint16_t>(_file.at(offset) | (_file.at(offset + 1) << 8));
+	return static_cast<uint16_t>(_file[offset] | (_file[offset + 1] << 8));
 }
 
-void Player::readSamples(void *userdata, Uint8 *buffer, int len) {
-	Player *player = static_cast<Player *>(userdata);
-	int16_t *dst = reinterpret_cast<int16_t *>(buffer);
+const size_t Player::_maxBlockLength;
+const uint32_t Player::kLoopForever;
+
+namespace {
+const uint32_t stateMagic = 0x53504441; // "ADPS"
+const uint8_t stateVersion = 5;
+} // End of anonymous namespace
+
+void Player::saveState(StateBuffer &state) const {
+	state.clear();
+	StateWriter writer(state);
+
+	writer.writeUint32(stateMagic);
+	writer.writeByte(stateVersion);
+	writer.writeUint32(_file.size());
+	writer.writeUint32(stateChecksum(&_file[0], _file.size()));
+	writer.writeUint32(_rate);
+
+	writer.writeUint32(_samplesTillCallback);
+	writer.writeUint32(_samplesTillCallbackRemainder);
+	writer.writeUint64(_position);
+	for (size_t i = 0; i < sizeof(_registerBackUpTable); ++i)
+		writer.writeByte(_registerBackUpTable[i]);
+	writer.writeUint16(_blockPos);
+	writer.writeUint16(_blockLength);
+	for (size_t i = 0; i < _blockLength; ++i)
+		writer.writeUint16(_block[i]);
+	writer.writeByte(_loopState);
+	writer.writeUint32(_loopCachePos);
+	writer.writeUint32(_loopCache.size());
+	for (size_t i = 0; i < _loopCache.size(); ++i)
+		writer.writeUint16(_loopCache[i]);
+	writer.writeUint32(_loopCount);
+
+	const size_t chipStart = state.size();
+	writer.writeUint32(0);
+	_emulator->SaveState(state);
+	const uint32_t chipSize = state.size() - chipStart - 4;
+	for (int i = 0; i < 4; ++i)
+		state[chipStart + i] = static_cast<uint8_t>(chipSize >> (i * 8));
+
+	saveSequencer(writer);
+
+	writer.writeUint32(stateChecksum(&state[0], state.size()));
+}
 
-	const int bufferLength = 512;
-	int32_t tempBuffer[bufferLength];
+void Player::loadState(const StateBuffer &state) {
+	if (state.size() < 4)
+		throw std::runtime_error("State ends unexpectedly");
+	StateReader trailer(&state[state.size() - 4], 4);
+	if (trailer.readUint32() != stateChecksum(&state[0], state.size() - 4))
+		throw std::runtime_error("State is corrupt");
+
+	StateReader reader(&state[0], state.size() - 4);
+	if (reader.readUint32() != stateMagic || reader.readByte() != stateVersion)
+		throw std::runtime_error("Unsupported state format");
+	if (reader.readUint32() != _file.size() || reader.readUint32() != stateChecksum(&_file[0], _file.size()))
+		throw std::runtime_error("State belongs to a different resource");
+	if (reader.readUint32() != static_cast<uint32_t>(_rate))
+		throw std::runtime_error("State was made for a different rate");
+
+	// Everything is loaded into copies first, so nothing changes when the
+	// state turns out to be broken.
+	const int32_t samplesTillCallback = reader.readUint32();
+	const int32_t samplesTillCallbackRemainder = reader.readUint32();
+	const uint64_t position = reader.readUint64();
+	uint8_t registers[sizeof(_registerBackUpTable)];
+	for (size_t i = 0; i < sizeof(registers); ++i)
+		registers[i] = reader.readByte();
+	const size_t blockPos = reader.readUint16();
+	const size_t blockLength = reader.readUint16();
+	if (blockLength > _maxBlockLength || blockPos > blockLength
+	    || samplesTillCallback < 0 || samplesTillCallbackRemainder < 0
+	    || samplesTillCallbackRemainder >= _callbackFrequency)
+		throw std::runtime_error("Invalid player state");
+	int16_t block[_maxBlockLength];
+	for (size_t i = 0; i < blockLength; ++i)
+		block[i] = static_cast<int16_t>(reader.readUint16());
+
+	const LoopState loopState = static_cast<LoopState>(reader.readByte());
+	const size_t loopCachePos = reader.readUint32();
+	const size_t loopCacheLength = reader.readUint32();
+	if (loopState > kLoopTooLong || loopCacheLength > reader.getRemaining() / 2
+	    || (loopState == kLoopReplaying && loopCachePos >= loopCacheLength))
+		throw std::runtime_error("Invalid player state");
+	std::vector<int16_t> loopCache(loopCacheLength);
+	for (size_t i = 0; i < loopCacheLength; ++i)
+		loopCache[i] = static_cast<int16_t>(reader.readUint16());
+	const uint32_t loopCount = reader.readUint32();
+
+	const uint32_t chipSize = reader.readUint32();
+	if (chipSize > reader.getRemaining())
+		throw std::runtime_error("State ends unexpectedly");
+	DBOPL::Opl2Chip chip(*_emulator);
+	if (chip.LoadState(reader.getPosition(), chipSize) != chipSize)
+		throw std::runtime_error("Invalid emulator state");
+	reader.skip(chipSize);
+
+	loadSequencer(reader);
+
+	*_emulator = chip;
+	_samplesTillCallback = samplesTillCallback;
+	_samplesTillCallbackRemainder = samplesTillCallbackRemainder;
+	_position = position;
+	std::memcpy(_registerBackUpTable, registers, sizeof(_registerBackUpTable));
+	std::copy(block, block + blockLength, _block);
+	_blockPos = blockPos;
+	_blockLength = blockLength;
+	_loopState = loopState;
+	_loopCache.swap(loopCache);
+	_loopCachePos = loopCachePos;
+	_loopCount = loopCount;
+}
 
-	len /= 2;
+void Player::render(int16_t *dst, size_t frames) {
+	int32_t tempBuffer[_maxBlockLength];
+
+	if (_trace)
+		_trace->begin("Player::render", "samples", frames);
+
+	while (frames > 0) {
+		if (_blockPos == _blockLength) {
+			const size_t samples = beginBlock();
+			if (samples && (_profile || _trace)) {
+				if (_trace)
+					_trace->begin("GenerateBlock2", "samples", samples);
+				const ProfileClock::time_point start = ProfileClock::now();
+				_emulator->GenerateBlock2(samples, tempBuffer);
+				profileBlock(samples, secondsSince(start));
+				if (_trace)
+					_trace->end();
+				endBlock(tempBuffer, samples);
+			} else if (samples) {
+				_emulator->GenerateBlock2(samples, tempBuffer);
+				endBlock(tempBuffer, samples);
+			}
+		}
 
-	while (len > 0) {
-		if (!player->_samplesTillCallback) {
-			player->callback();
-			player->_samplesTillCallback = player->_samplesPerCallback;
-			player->_samplesTillCallbackRemainder += player->_samplesPerCallbackRemainder;
-			if (player->_samplesTillCallbackRemainder >= player->_callbackFrequency) {
-				++player->_samplesTillCallback;
-				player->_samplesTillCallbackRemainder -= player->_callbackFrequency;
+		const size_t samples = readBlock(dst, frames);
+		dst += samples;
+		frames -= samples;
+	}
+
+	if (_trace)
+		_trace->end();
+}
+
+void Player::setTrace(Trace::Track *track) {
+	_trace = track;
+	_emulator->trace = track;
+}
+
+void Player::renderGroup(Player *const *players, size_t count, int16_t *const *dst, size_t frames) {
+	const size_t maxChips = DBOPL::ChipLanes::MAX_CHIPS;
+	for (; count > maxChips; count -= maxChips, players += maxChips, dst += maxChips)
+		renderGroup(players, maxChips, dst, frames);
+
+	DBOPL::ChipLanes lanes;
+	int32_t tempBuffer[maxChips][_maxBlockLength];
+	size_t blockLength[maxChips] = { 0 };
+	size_t done[maxChips] = { 0 };
+	double seconds[maxChips] = { 0 };
+
+	while (true) {
+		// Hand out finished blocks and start new ones where needed.
+		size_t samples = 0;
+		size_t active = 0;
+		for (size_t i = 0; i < count; ++i) {
+			Player &player = *players[i];
+			if (!blockLength[i]) {
+				// Blocks from the loop cache are read right away.
+				while (done[i] < frames && !blockLength[i]) {
+					done[i] += player.readBlock(dst[i] + done[i], frames - done[i]);
+					if (done[i] < frames)
+						blockLength[i] = player.beginBlock();
+				}
+				if (done[i] == frames)
+					continue;
+
+				lanes.Begin(i, player._emulator.get(), blockLength[i], tempBuffer[i]);
 			}
+
+			++active;
+			if (!samples || lanes.Left(i) < samples)
+				samples = lanes.Left(i);
+		}
+
+		if (!samples)
+			break;
+
+		const ProfileClock::time_point start = ProfileClock::now();
+		lanes.Generate(samples);
+		const double share = secondsSince(start) / active;
+
+		for (size_t i = 0; i < count; ++i) {
+			if (!blockLength[i])
+				continue;
+
+			seconds[i] += share;
+			if (!lanes.Left(i)) {
+				players[i]->profileBlock(blockLength[i], seconds[i]);
+				players[i]->endBlock(tempBuffer[i], blockLength[i]);
+				blockLength[i] = 0;
+				seconds[i] = 0;
+			}
+		}
+	}
+}
+
+void Player::seek(uint32_t milliseconds) {
+	const uint64_t target = static_cast<uint64_t>(milliseconds) * _rate / 1000;
+	if (target <= _position)
+		return;
+
+	// Drop the rest of the current block first.
+	const size_t skip = std::min<uint64_t>(target - _position, _blockLength - _blockPos);
+	_blockPos += skip;
+	_position += skip;
+
+	if (_loopState == kLoopReplaying) {
+		_loopCachePos = (_loopCachePos + (target - _position)) % _loopCache.size();
+		_position = target;
+		return;
+	}
+
+	// A loop iteration which is skipped in parts can not be cached.
+	if (_loopState == kLoopCapturing) {
+		_loopState = kLoopNone;
+		_loopCache.clear();
+	}
+
+	_seeking = true;
+	while (_position < target) {
+		advanceCallback();
+
+		const int32_t samples = std::min<uint64_t>(target - _position, _samplesTillCallback);
+		_samplesTillCallback -= samples;
+		_position += samples;
+	}
+	_seeking = false;
+
+	flushSeek();
+}
+
+void Player::flushSeek() {
+	// The rhythm register comes last, since the percussion instruments
+	// depend on the setup of their channels.
+	for (uint16_t reg = 0; reg < 0x100; ++reg) {
+		if (reg != 0xBD)
+			flushSeekRegister(reg);
+	}
+	flushSeekRegister(0xBD);
+	_lastWritePosition = _position;
+
+	std::memset(_seekDirty, 0, sizeof(_seekDirty));
+	std::memset(_seekKeyOn, 0, sizeof(_seekKeyOn));
+}
+
+void Player::flushSeekRegister(uint8_t reg) {
+	if (!_seekDirty[reg])
+		return;
+
+	if (_seekKeyOn[reg])
+		writeEmulator(reg, _registerBackUpTable[reg] & ~_seekKeyOn[reg]);
+	writeEmulator(reg, _registerBackUpTable[reg]);
+}
+
+void Player::writeEmulator(uint16_t reg, uint8_t data) {
+	if (_trace)
+		_trace->instant("write", "reg", reg, "value", data);
+	if (_writeLog)
+		_writeLog->addWrite(_position - _writeLogStart, reg, data);
+	_emulator->WriteReg(reg, data);
+}
+
+void Player::setWriteLog(WriteLog *log) {
+	_writeLog = log;
+	if (!_writeLog)
+		return;
+
+	_writeLogStart = _position;
+	if (_loopState == kLoopCapturing) {
+		_loopState = kLoopNone;
+		_loopCache.clear();
+	}
+
+	// The rhythm register comes last, just like after seeking.
+	for (uint16_t reg = 0; reg < 0x100; ++reg) {
+		if (reg != 0xBD && _registerBackUpTable[reg])
+			_writeLog->addWrite(0, reg, _registerBackUpTable[reg]);
+	}
+	if (_registerBackUpTable[0xBD])
+		_writeLog->addWrite(0, 0xBD, _registerBackUpTable[0xBD]);
+}
+
+bool Player::exportWrites(WriteLog &log, uint64_t maxSamples, uint64_t &loopStart) {
+	if (_blockPos < _blockLength || _loopState == kLoopReplaying)
+		throw std::runtime_error("Writes can only be exported before rendering");
+
+	const uint64_t start = _position;
+	setWriteLog(&log);
+	_exporting = true;
+	_exportLoopPoints = 0;
+
+	// This runs just like seeking, except that every write is passed on
+	// right away. The third loop point stops logging.
+	while (_writeLog && isPlaying() && _position - start < maxSamples) {
+		advanceCallback();
+
+		const int32_t samples = std::min<uint64_t>(maxSamples - (_position - start), _samplesTillCallback);
+		_samplesTillCallback -= samples;
+		_position += samples;
+	}
+
+	const bool looped = !_writeLog;
+	_exporting = false;
+	setWriteLog(0);
+
+	if (looped) {
+		log.finish(_exportLoopEnd);
+		loopStart = _exportLoopStart;
+	} else {
+		log.finish(_position - start);
+	}
+	return looped;
+}
+
+bool Player::loopPoint() {
+	if (_exporting) {
+		if (++_exportLoopPoints == 2) {
+			_exportLoopStart = _position - _writeLogStart;
+		} else if (_exportLoopPoints == 3) {
+			_exportLoopEnd = _position - _writeLogStart;
+			_writeLog = 0;
 		}
+		return true;
+	}
 
-		const int samplesToRead = std::min(std::min(len, bufferLength), player->_samplesTillCallback);
-		player->_emulator->GenerateBlock2(samplesToRead, tempBuffer);
+	if (_loopLimit != kLoopForever) {
+		if (_loopCount == _loopLimit)
+			return false;
+		++_loopCount;
+		return true;
+	}
 
-		const int32_t *src = tempBuffer;
-		for (int i = 0; i < samplesToRead; ++i)
-			*dst++ = *src++ * 435 / 256;
+	if (_seeking || _loopState == kLoopTooLong || _writeLog)
+		return true;
+
+	if (_loopState == kLoopCapturing && !_loopCache.empty()) {
+		_loopState = kLoopReplaying;
+		_loopCachePos = 0;
+	} else if (_loopState == kLoopFirstPass) {
+		_loopState = kLoopCapturing;
+		_loopCache.clear();
+	} else {
+		_loopState = kLoopFirstPass;
+	}
+	return true;
+}
 
-		len -= samplesToRead;
-		player->_samplesTillCallback -= samplesToRead;
+size_t Player::beginBlock() {
+	if (_loopState != kLoopReplaying)
+		advanceCallback();
+
+	if (_loopState == kLoopReplaying) {
+		const size_t samples = std::min(_maxBlockLength, _loopCache.size() - _loopCachePos);
+		std::copy(&_loopCache[_loopCachePos], &_loopCache[_loopCachePos] + samples, _block);
+		_loopCachePos = (_loopCachePos + samples) % _loopCache.size();
+		_blockPos = 0;
+		_blockLength = samples;
+		return 0;
 	}
+
+	const size_t samples = std::min(_maxBlockLength, static_cast<size_t>(_samplesTillCallback));
+	if (_writeLog)
+		_writeLog->addBlock(_position - _writeLogStart);
+	return samples;
+}
+
+void Player::advanceCallback() {
+	if (_samplesTillCallback)
+		return;
+
+	if (_profile || _trace)
+		measureCallback();
+	else
+		callback();
+
+	_samplesTillCallback = _samplesPerCallback;
+	_samplesTillCallbackRemainder += _samplesPerCallbackRemainder;
+	if (_samplesTillCallbackRemainder >= _callbackFrequency) {
+		++_samplesTillCallback;
+		_samplesTillCallbackRemainder -= _callbackFrequency;
+	}
+}
+
+void Player::measureCallback() {
+	if (_trace)
+		_trace->begin(getCallbackName());
+
+	const ProfileClock::time_point start = ProfileClock::now();
+	callback();
+	const double seconds = secondsSince(start);
+
+	if (_trace)
+		_trace->end();
+
+	if (_profile) {
+		++_profile->callbacks;
+		_profile->callbackSeconds += seconds;
+		_profile->maxCallbackSeconds = std::max(_profile->maxCallbackSeconds, seconds);
+	}
+}
+
+void Player::profileBlock(size_t samples, double seconds) {
+	if (!_profile)
+		return;
+
+	++_profile->blocks;
+	_profile->blockSamples += samples;
+	_profile->synthesisSeconds += seconds;
+	_profile->maxSynthesisSeconds = std::max(_profile->maxSynthesisSeconds, seconds);
+}
+
+void Player::endBlock(const int32_t *src, size_t samples) {
+	for (size_t i = 0; i < samples; ++i)
+		_block[i] = *src++ * 435 / 256;
+
+	_blockPos = 0;
+	_blockLength = samples;
+	_samplesTillCallback -= samples;
+
+	if (_loopState == kLoopCapturing) {
+		if (_loopCache.size() + samples > static_cast<uint64_t>(_maxLoopCacheSeconds) * _rate) {
+			_loopState = kLoopTooLong;
+			std::vector<int16_t>().swap(_loopCache);
+		} else {
+			_loopCache.insert(_loopCache.end(), _block, _block + samples);
+		}
+	}
+}
+
+size_t Player::readBlock(int16_t *dst, size_t frames) {
+	const size_t samples = std::min(frames, _blockLength - _blockPos);
+	std::copy(_block + _blockPos, _block + _blockPos + samples, dst);
+	_blockPos += samples;
+	_position += samples;
+	return samples;
 }
 
 void Player::setupChannel(uint8_t channel, uint16_t instrOffset) {
 	instrOffset += 2;
-	writeReg(0xC0 + channel, _file.at(instrOffset++));
+	writeReg(0xC0 + channel, _file[instrOffset++]);
 	setupOperator(_operatorOffsetTable[channel * 2 + 0], instrOffset);
 	setupOperator(_operatorOffsetTable[channel * 2 + 1], instrOffset);
 }
 
 void Player::setupOperator(uint8_t opr, uint16_t &instrOffset) {
-	writeReg(0x20 + opr, _file.at(instrOffset++));
-	writeReg(0x40 + opr, _file.at(instrOffset++));
-	writeReg(0x60 + opr, _file.at(instrOffset++));
-	writeReg(0x80 + opr, _file.at(instrOffset++));
-	writeReg(0xE0 + opr, _file.at(instrOffset++));
+	writeReg(0x20 + opr, _file[instrOffset++]);
+	writeReg(0x40 + opr, _file[instrOffset++]);
+	writeReg(0x60 + opr, _file[instrOffset++]);
+	writeReg(0x80 + opr, _file[instrOffset++]);
+	writeReg(0xE0 + opr, _file[instrOffset++]);
 }
 
 const uint8_t Player::_operatorOffsetTable[18] = {
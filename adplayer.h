@@ -22,20 +22,256 @@
 #define ADPLAYER_H
 
 #include <vector>
+#include <string>
 #include <stdint.h>
 #include <boost/scoped_ptr.hpp>
-#include <SDL.h>
 #include "dbopl.h"
+#include "state.h"
+#include "trace.h"
 
 typedef std::vector<uint8_t> FileBuffer;
 
+class Player;
+class Timeline;
+class WriteLog;
+
+void loadADFile(const std::string &filename, FileBuffer &data);
+
+/**
+ * Check the structure of a resource.
+ *
+ * This walks all data the players will ever read and throws a
+ * std::runtime_error naming the offset of the first problem found. The
+ * players themselves do not check any offsets, thus only validated
+ * resources may be played.
+ *
+ * @param data Resource data.
+ */
+void validateADFile(const FileBuffer &data);
+
+/**
+ * Throw the error for an offset outside of a resource unless it is in range.
+ *
+ * @param data   Resource data.
+ * @param offset Offset to check.
+ * @param what   Description of the data at the offset.
+ */
+void checkADOffset(const FileBuffer &data, uint32_t offset, const char *what);
+
+/**
+ * Throw a std::runtime_error for a malformed resource.
+ *
+ * @param error  Description of the problem.
+ * @param offset Offset of the problem in the resource.
+ */
+void throwADError(const std::string &error, uint32_t offset);
+
+/**
+ * Create the matching player for a resource, which is validated first.
+ *
+ * @param data   Resource data.
+ * @param isLoom Whether music resources are in the Loom v3 format.
+ * @param rate   Output sample rate.
+ * @return Newly allocated player, the caller takes ownership.
+ */
+Player *createPlayer(const FileBuffer &data, bool isLoom, int rate);
+
+/**
+ * Base class for the AD resource players.
+ *
+ * A player owns its own emulator instance and does not depend on any audio
+ * device. Output is pulled from it via render(), see AudioOutput for a sink
+ * which feeds an SDL audio device.
+ */
 class Player {
 public:
-	Player(const FileBuffer &file);
+	/**
+	 * Time spent in the sequencer and the emulator, collected while a
+	 * profile is set with setProfile(). All times are in seconds.
+	 */
+	struct Profile {
+		Profile();
+
+		/**
+		 * Sequencer callbacks, including those run while seeking.
+		 */
+		uint64_t callbacks;
+		double callbackSeconds;
+		double maxCallbackSeconds;
+
+		/**
+		 * Blocks generated by the emulator. Blocks played back from the
+		 * loop cache are not included.
+		 */
+		uint64_t blocks;
+		uint64_t blockSamples;
+		double synthesisSeconds;
+		double maxSynthesisSeconds;
+	};
+
+	Player(const FileBuffer &file, int rate);
 	virtual ~Player() {}
 
-	void startPlayback();
-	void stopPlayback();
+	/**
+	 * Render the next samples of the resource.
+	 *
+	 * This advances the sequencer and the emulator by exactly the given
+	 * number of samples. It is safe to call this from any thread, as long as
+	 * calls for one player are not made concurrently.
+	 *
+	 * @param dst    Buffer to store the signed 16bit mono samples in.
+	 * @param frames Number of samples to render.
+	 */
+	void render(int16_t *dst, size_t frames);
+
+	/**
+	 * Render the next samples of several players at once.
+	 *
+	 * The emulators of the players are rendered side by side, which is
+	 * faster than rendering each player on its own. The output is identical
+	 * to calling render() for every player.
+	 *
+	 * @param players Players to render.
+	 * @param count   Number of players.
+	 * @param dst     Buffers to store the samples of each player in.
+	 * @param frames  Number of samples to render for each player.
+	 */
+	static void renderGroup(Player *const *players, size_t count, int16_t *const *dst, size_t frames);
+
+	/**
+	 * Skip ahead to a position in the resource.
+	 *
+	 * Only the sequencer is run up to the position, its register writes
+	 * are collected and passed to the emulator in one burst at the end.
+	 * The emulator does not generate any samples meanwhile, thus notes
+	 * which are still playing at the position continue from the state
+	 * they had before seeking. Positions before the current one are
+	 * ignored, seeking backwards requires a new player.
+	 *
+	 * @param milliseconds Position from the start of the resource.
+	 */
+	void seek(uint32_t milliseconds);
+
+	/**
+	 * @return Number of samples since the start of the resource.
+	 */
+	uint64_t getPosition() const { return _position; }
+
+	/**
+	 * @return Position of the last register write which was passed to the
+	 *         emulator, in samples since the start of the resource.
+	 */
+	uint64_t getLastWritePosition() const { return _lastWritePosition; }
+
+	int getRate() const { return _rate; }
+
+	/**
+	 * Store the complete state of the player in a snapshot.
+	 *
+	 * This includes the sequencer, the emulator and samples which were
+	 * generated but not rendered yet. Loading the snapshot into a player
+	 * for the same resource and rate continues with exactly the same
+	 * output, which also allows to fork one state into several players.
+	 *
+	 * @param state Buffer to store the snapshot in, it is overwritten.
+	 */
+	void saveState(StateBuffer &state) const;
+
+	/**
+	 * Restore a snapshot made by saveState.
+	 *
+	 * A std::runtime_error is thrown when the snapshot is corrupt or was
+	 * made for a different resource or rate, the player is unchanged then.
+	 *
+	 * @param state Snapshot to load.
+	 */
+	void loadState(const StateBuffer &state);
+
+	/**
+	 * Select the engine the emulator uses to generate samples. All engines
+	 * produce identical output, they only differ in speed.
+	 */
+	void setEngine(DBOPL::Engine engine) { _emulator->engine = engine; }
+
+	/**
+	 * Select the wave generator routine of the emulator. The output of the
+	 * modes differs slightly, only DBOPL::wmTableMul (the default) is
+	 * checked against golden output. Looping music which is replayed from
+	 * its cache keeps the output of the mode it was generated with.
+	 */
+	void setWaveMode(DBOPL::WaveMode mode) { _emulator->SetWaveMode(mode); }
+
+	/**
+	 * Value for setLoopLimit to repeat loops forever.
+	 */
+	static const uint32_t kLoopForever = 0xFFFFFFFF;
+
+	/**
+	 * Limit how often looping music jumps back to its loop start.
+	 *
+	 * The music stops playing at the jump after the limit, thus a limit of
+	 * zero plays it once up to the end of the track. Limited loops are not
+	 * cached, since replaying the cache does not run the sequencer which
+	 * counts them. The limit has to be set before rendering.
+	 *
+	 * @param loops Number of repetitions, kLoopForever (the default) to
+	 *              loop forever.
+	 */
+	void setLoopLimit(uint32_t loops) { _loopLimit = loops; }
+
+	/**
+	 * Start collecting timing information.
+	 *
+	 * With renderGroup() the time of each emulator pass is split evenly
+	 * between the players taking part in it.
+	 *
+	 * @param profile Profile to add to, 0 to stop collecting. The caller
+	 *                keeps ownership.
+	 */
+	void setProfile(Profile *profile) { _profile = profile; }
+
+	/**
+	 * Record spans for rendering, the sequencer callbacks and the emulator
+	 * blocks, and an event for every register write into a trace track.
+	 * Only render() is traced, renderGroup() is not.
+	 *
+	 * @param track Track of the thread rendering the player, 0 to stop
+	 *              tracing. The caller keeps ownership.
+	 */
+	void setTrace(Trace::Track *track);
+
+	/**
+	 * Log every register write passed to the emulator and the blocks it
+	 * generates, see WriteLog. Positions in the log start at the position
+	 * the player had when logging started, the current register values are
+	 * logged first. Thus a log started before rendering replays exactly.
+	 *
+	 * Loops are not cached while logging, since replaying them from the
+	 * cache would skip their writes. Writes made while seeking are logged
+	 * at the seek target.
+	 *
+	 * @param log Log to add to, 0 to stop logging. The caller keeps
+	 *            ownership and has to finish the log.
+	 */
+	void setWriteLog(WriteLog *log);
+
+	/**
+	 * Run only the sequencer and log its register writes, see setWriteLog.
+	 *
+	 * No samples are generated, the writes are still passed to the emulator
+	 * so the player can continue rendering afterwards like after seeking.
+	 * The export ends when the player stops playing, after maxSamples or
+	 * when a loop was run once. For a loop the log ends right before the
+	 * writes of its second iteration, thus it can be repeated from the loop
+	 * start on forever. Exporting has to start before rendering.
+	 *
+	 * @param log        Log to add to, it is finished at the end.
+	 * @param maxSamples Maximum length of the export in samples.
+	 * @param loopStart  Set to the position of the loop start in the log
+	 *                   when a loop was found.
+	 * @return true when the log ends with a complete loop, false otherwise.
+	 */
+	bool exportWrites(WriteLog &log, uint64_t maxSamples, uint64_t &loopStart);
 
 	virtual bool isPlaying() const = 0;
 protected:
@@ -45,17 +281,60 @@ protected:
 
 	virtual void callback() = 0;
 
+	/**
+	 * @return Name of the callback shown in traces.
+	 */
+	virtual const char *getCallbackName() const = 0;
+
+	/**
+	 * Store the state of the sequencer in a snapshot.
+	 */
+	virtual void saveSequencer(StateWriter &state) const = 0;
+
+	/**
+	 * Restore the sequencer from a snapshot. Implementations must not
+	 * change anything when they throw.
+	 */
+	virtual void loadSequencer(StateReader &state) = 0;
+
 	void writeReg(uint16_t reg, uint8_t data);
 	uint8_t readReg(uint16_t reg) const { return _registerBackUpTable[reg]; }
 
+	/**
+	 * Record register writes into a timeline instead of passing them to the
+	 * emulator, used to compile resources ahead of playback.
+	 *
+	 * @param timeline Timeline to add the writes to, 0 to stop recording.
+	 * @param callback Callback the following writes belong to.
+	 */
+	void recordWrites(Timeline *timeline, uint32_t callback) {
+		_recordTimeline = timeline;
+		_recordCallback = callback;
+	}
+
+	/**
+	 * Called by the sequencer whenever it jumps back to the start of a loop.
+	 *
+	 * The first loop iteration still contains what sounds from the first
+	 * pass through the track, thus the output of the second one is cached.
+	 * All later iterations are played back from the cache without running
+	 * the sequencer or the emulator anymore. Exported writes end with the
+	 * second iteration for the same reason.
+	 *
+	 * @return false when the loop limit is reached, the sequencer has to
+	 *         stop playing then.
+	 */
+	bool loopPoint();
+
 	void setupChannel(uint8_t channel, uint16_t instrOffset);
 	void setupOperator(uint8_t opr, uint16_t &instrOffset);
 
 	static const uint8_t _operatorOffsetTable[18];
 private:
-	typedef boost::scoped_ptr<DBOPL::Chip> ChipPtr;
+	/** The resources only use the OPL2 registers, the 9 channels of an OPL2 suffice. */
+	typedef boost::scoped_ptr<DBOPL::Opl2Chip> ChipPtr;
 	ChipPtr _emulator;
-	SDL_AudioSpec _obtained;
+	const int _rate;
 
 	const int _callbackFrequency;
 	int32_t _samplesPerCallback;
@@ -63,9 +342,117 @@ private:
 	int32_t _samplesTillCallback;
 	int32_t _samplesTillCallbackRemainder;
 
-	static void readSamples(void *userdata, Uint8 *buffer, int len);
-
 	uint8_t _registerBackUpTable[0x100];
+
+	Timeline *_recordTimeline;
+	uint32_t _recordCallback;
+
+	/**
+	 * Registers written while seeking, they are only stored in
+	 * _registerBackUpTable until the seek is finished.
+	 */
+	bool _seeking;
+	bool _seekDirty[0x100];
+	uint8_t _seekKeyOn[0x100];
+
+	/**
+	 * Pass all registers written while seeking to the emulator.
+	 */
+	void flushSeek();
+	void flushSeekRegister(uint8_t reg);
+
+	uint64_t _position;
+	uint64_t _lastWritePosition;
+
+	Profile *_profile;
+	Trace::Track *_trace;
+
+	WriteLog *_writeLog;
+	uint64_t _writeLogStart;
+
+	/**
+	 * State of exportWrites, the second loop point found is the loop start
+	 * and the third one its end. Both are positions in the log.
+	 */
+	bool _exporting;
+	uint32_t _exportLoopPoints;
+	uint64_t _exportLoopStart;
+	uint64_t _exportLoopEnd;
+
+	/**
+	 * Pass a register write to the emulator and the write log.
+	 */
+	void writeEmulator(uint16_t reg, uint8_t data);
+
+	/**
+	 * Run the callback while collecting a profile or a trace.
+	 */
+	void measureCallback();
+
+	/**
+	 * Add a generated block to the profile, if any.
+	 */
+	void profileBlock(size_t samples, double seconds);
+
+	enum LoopState {
+		kLoopNone,
+		kLoopFirstPass,
+		kLoopCapturing,
+		kLoopReplaying,
+		kLoopTooLong
+	};
+
+	/**
+	 * Output of one loop iteration. Loops longer than the limit are not
+	 * cached, they are generated again for every iteration.
+	 */
+	LoopState _loopState;
+	std::vector<int16_t> _loopCache;
+	size_t _loopCachePos;
+	static const uint32_t _maxLoopCacheSeconds = 5 * 60;
+
+	/**
+	 * Limit from setLoopLimit and the jumps back to a loop start counted
+	 * against it.
+	 */
+	uint32_t _loopLimit;
+	uint32_t _loopCount;
+
+	/**
+	 * The emulator is always run in blocks which end at the next callback,
+	 * independent of how many samples are requested. This way the output
+	 * does not depend on the buffer sizes used by the caller.
+	 */
+	static const size_t _maxBlockLength = 512;
+	int16_t _block[_maxBlockLength];
+	size_t _blockPos;
+	size_t _blockLength;
+
+	/**
+	 * Run the callback when it is due and return the length of the next
+	 * block.
+	 *
+	 * @return Number of samples to generate, 0 when the block was taken
+	 *         from the loop cache.
+	 */
+	size_t beginBlock();
+
+	/**
+	 * Run the callback when it is due and advance the callback timer.
+	 */
+	void advanceCallback();
+
+	/**
+	 * Store the emulator output of a block for rendering.
+	 */
+	void endBlock(const int32_t *src, size_t samples);
+
+	/**
+	 * Copy as much as possible of the current block into dst.
+	 *
+	 * @return Number of samples copied.
+	 */
+	size_t readBlock(int16_t *dst, size_t frames);
 };
 
 #endif
@@ -0,0 +1,295 @@
+/* adplayer - A player for SCUMM AD resource files.
+ *
+ * (c) 2011 by Johannes Schickel <lordhoto at gmail dot com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "batch.h"
+#include "adplayer.h"
+#include "render.h"
+#include "wav.h"
+
+#include <stdexcept>
+#include <algorithm>
+#include <fstream>
+#include <cstdio>
+
+#include <boost/scoped_ptr.hpp>
+#include <boost/scoped_array.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/chrono.hpp>
+#include <boost/filesystem.hpp>
+
+namespace fs = boost::filesystem;
+
+BatchRenderer::BatchRenderer(const std::string &outputDir, unsigned int jobs, bool isLoom, uint64_t maxSamples)
+    : _outputDir(outputDir), _jobs(std::max(jobs, 1U)), _isLoom(isLoom),
+      _maxSamples(maxSamples), _rate(44100), _engine(DBOPL::engineScalar),
+      _waveMode(DBOPL::wmTableMul), _loopLimit(0), _lanes(1),
+      _isExport(false), _exportFormat(kExportDRO), _inputs(), _mutex(),
+      _nextInput(0), _totalSamples(0), _failedJobs(0) {
+}
+
+void BatchRenderer::addInput(const std::string &path) {
+	if (!fs::is_directory(path)) {
+		_inputs.push_back(path);
+		return;
+	}
+
+	std::vector<std::string> files;
+	for (fs::directory_iterator i(path), end; i != end; ++i) {
+		if (fs::is_regular_file(i->status()))
+			files.push_back(i->path().string());
+	}
+
+	// Sort the files so the job order does not depend on the file system.
+	std::sort(files.begin(), files.end());
+	_inputs.insert(_inputs.end(), files.begin(), files.end());
+}
+
+void BatchRenderer::addList(const std::string &listFile) {
+	std::ifstream list(listFile.c_str());
+	if (!list)
+		throw std::runtime_error("Could not open list file: " + listFile);
+
+	std::string line;
+	while (std::getline(list, line)) {
+		if (!line.empty())
+			addInput(line);
+	}
+}
+
+bool BatchRenderer::run() {
+	// Make sure no two jobs write into the same file.
+	std::vector<std::string> outputs;
+	for (std::vector<std::string>::const_iterator i = _inputs.begin(); i != _inputs.end(); ++i)
+		outputs.push_back(outputName(*i));
+	std::sort(outputs.begin(), outputs.end());
+	std::vector<std::string>::const_iterator duplicate = std::adjacent_find(outputs.begin(), outputs.end());
+	if (duplicate != outputs.end())
+		throw std::runtime_error("Several inputs would be rendered to " + *duplicate);
+
+	fs::create_directories(_outputDir);
+
+	_nextInput = 0;
+	_totalSamples = 0;
+	_failedJobs = 0;
+
+	const boost::chrono::steady_clock::time_point start = boost::chrono::steady_clock::now();
+
+	const unsigned int workers = std::min<size_t>(_jobs, _inputs.size());
+	boost::thread_group pool;
+	for (unsigned int i = 0; i < workers; ++i)
+		pool.create_thread(boost::bind(&BatchRenderer::worker, this));
+	pool.join_all();
+
+	const double seconds = boost::chrono::duration<double>(boost::chrono::steady_clock::now() - start).count();
+	const double samplesPerSecond = seconds > 0 ? _totalSamples / seconds : 0;
+
+	if (_isExport) {
+		std::printf("Exported %u of %u files with %u workers\n",
+		            static_cast<unsigned int>(_inputs.size() - _failedJobs),
+		            static_cast<unsigned int>(_inputs.size()), workers);
+	} else {
+		std::printf("Rendered %u of %u files with %u workers, %u lanes each\n",
+		            static_cast<unsigned int>(_inputs.size() - _failedJobs),
+		            static_cast<unsigned int>(_inputs.size()), workers, _lanes);
+	}
+	std::printf("%llu samples in %.3f seconds: %.0f samples/s (%.1fx realtime)\n",
+	            static_cast<unsigned long long>(_totalSamples), seconds,
+	            samplesPerSecond, samplesPerSecond / _rate);
+
+	return !_failedJobs;
+}
+
+bool BatchRenderer::nextInput(std::string &input) {
+	boost::lock_guard<boost::mutex> lock(_mutex);
+	if (_nextInput >= _inputs.size())
+		return false;
+	input = _inputs[_nextInput++];
+	return true;
+}
+
+void BatchRenderer::finishJob(bool success, uint64_t samples) {
+	boost::lock_guard<boost::mutex> lock(_mutex);
+	_totalSamples += samples;
+	if (!success)
+		++_failedJobs;
+}
+
+void BatchRenderer::worker() {
+	if (_lanes > 1 && !_isExport) {
+		laneWorker();
+		return;
+	}
+
+	std::string input;
+	while (nextInput(input)) {
+		uint64_t samples = 0;
+		const bool success = renderJob(input, samples);
+		finishJob(success, samples);
+	}
+}
+
+/**
+ * A job rendered side by side with others.
+ */
+struct BatchRenderer::LaneJob {
+	LaneJob() : input(), player(), output(), samples(0), buffer(renderChunkLength) {}
+
+	std::string input;
+	boost::scoped_ptr<Player> player;
+	boost::scoped_ptr<WavWriter> output;
+	uint64_t samples;
+	std::vector<int16_t> buffer;
+};
+
+void BatchRenderer::laneWorker() {
+	boost::scoped_array<LaneJob> jobs(new LaneJob[_lanes]);
+	std::vector<LaneJob *> active;
+	std::vector<Player *> players;
+	std::vector<int16_t *> buffers;
+
+	while (true) {
+		active.clear();
+		players.clear();
+		buffers.clear();
+
+		// Jobs are only checked for their end between chunks, just like
+		// renderToFile does, so the output is the same.
+		uint64_t chunk = renderChunkLength;
+		for (unsigned int i = 0; i < _lanes; ++i) {
+			LaneJob &job = jobs[i];
+			while (true) {
+				if (job.player) {
+					if (job.samples < _maxSamples && (job.samples % renderChunkLength || job.player->isPlaying()))
+						break;
+					finishLaneJob(job);
+				}
+
+				if (!nextInput(job.input))
+					break;
+				startLaneJob(job);
+			}
+
+			if (!job.player)
+				continue;
+
+			active.push_back(&job);
+			players.push_back(job.player.get());
+			buffers.push_back(&job.buffer[0]);
+			chunk = std::min(chunk, renderChunkLength - job.samples % renderChunkLength);
+			chunk = std::min(chunk, _maxSamples - job.samples);
+		}
+
+		if (active.empty())
+			return;
+
+		try {
+			Player::renderGroup(&players[0], players.size(), &buffers[0], chunk);
+		} catch (const std::exception &e) {
+			// There is no telling which of the players failed, thus the
+			// jobs are rendered again one by one.
+			for (std::vector<LaneJob *>::iterator i = active.begin(); i != active.end(); ++i) {
+				(*i)->output.reset();
+				(*i)->player.reset();
+
+				uint64_t samples = 0;
+				const bool success = renderJob((*i)->input, samples);
+				finishJob(success, samples);
+			}
+			continue;
+		}
+
+		for (std::vector<LaneJob *>::iterator i = active.begin(); i != active.end(); ++i) {
+			LaneJob &job = **i;
+			try {
+				job.output->write(&job.buffer[0], chunk);
+				job.samples += chunk;
+			} catch (const std::exception &e) {
+				std::fprintf(stderr, "ERROR: %s: %s\n", job.input.c_str(), e.what());
+				job.output.reset();
+				job.player.reset();
+				finishJob(false, job.samples);
+			}
+		}
+	}
+}
+
+bool BatchRenderer::startLaneJob(LaneJob &job) {
+	try {
+		FileBuffer data;
+		loadADFile(job.input, data);
+
+		job.player.reset(createPlayer(data, _isLoom, _rate));
+		job.player->setEngine(_engine);
+		job.player->setWaveMode(_waveMode);
+		job.player->setLoopLimit(_loopLimit);
+		job.output.reset(new WavWriter(outputName(job.input), _rate, 1));
+		job.samples = 0;
+		return true;
+	} catch (const std::exception &e) {
+		std::fprintf(stderr, "ERROR: %s: %s\n", job.input.c_str(), e.what());
+		job.output.reset();
+		job.player.reset();
+		finishJob(false, 0);
+		return false;
+	}
+}
+
+void BatchRenderer::finishLaneJob(LaneJob &job) {
+	bool success = true;
+	try {
+		job.output->finish();
+	} catch (const std::exception &e) {
+		std::fprintf(stderr, "ERROR: %s: %s\n", job.input.c_str(), e.what());
+		success = false;
+	}
+
+	job.output.reset();
+	job.player.reset();
+	finishJob(success, job.samples);
+}
+
+bool BatchRenderer::renderJob(const std::string &input, uint64_t &samples) {
+	try {
+		FileBuffer data;
+		loadADFile(input, data);
+
+		boost::scoped_ptr<Player> player(createPlayer(data, _isLoom, _rate));
+		player->setEngine(_engine);
+		player->setWaveMode(_waveMode);
+		player->setLoopLimit(_loopLimit);
+		if (_isExport)
+			samples = exportToFile(*player, _exportFormat, outputName(input), _maxSamples);
+		else
+			samples = renderToFile(*player, outputName(input), _maxSamples);
+		return true;
+	} catch (const std::exception &e) {
+		std::fprintf(stderr, "ERROR: %s: %s\n", input.c_str(), e.what());
+		return false;
+	}
+}
+
+std::string BatchRenderer::outputName(const std::string &input) const {
+	const char *extension = ".wav";
+	if (_isExport)
+		extension = _exportFormat == kExportDRO ? ".dro" : ".vgm";
+	return (fs::path(_outputDir) / fs::path(input).stem()).string() + extension;
+}
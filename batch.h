@@ -0,0 +1,127 @@
+/* adplayer - A player for SCUMM AD resource files.
+ *
+ * (c) 2011 by Johannes Schickel <lordhoto at gmail dot com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <stdint.h>
+
+#include <boost/thread/mutex.hpp>
+
+#include "dbopl.h"
+#include "export.h"
+
+/**
+ * Renders a whole set of resources into WAV files using a pool of worker
+ * threads, or exports their register writes instead.
+ *
+ * Every job uses its own player and thus its own emulator instance, the only
+ * state shared between the workers is the job queue.
+ */
+class BatchRenderer {
+public:
+	BatchRenderer(const std::string &outputDir, unsigned int jobs, bool isLoom, uint64_t maxSamples);
+
+	/**
+	 * Add an input to render. Directories are expanded to all regular files
+	 * inside them.
+	 */
+	void addInput(const std::string &path);
+
+	/**
+	 * Add all inputs listed in a text file, one per line.
+	 */
+	void addList(const std::string &listFile);
+
+	/**
+	 * Select the emulator engine used for all jobs.
+	 */
+	void setEngine(DBOPL::Engine engine) { _engine = engine; }
+
+	/**
+	 * Select the wave generator routine of the emulator used for all jobs.
+	 */
+	void setWaveMode(DBOPL::WaveMode mode) { _waveMode = mode; }
+
+	/**
+	 * Limit the repetitions of looping music for all jobs, see
+	 * Player::setLoopLimit. By default the music is rendered once.
+	 */
+	void setLoopLimit(uint32_t loops) { _loopLimit = loops; }
+
+	/**
+	 * Set how many jobs each worker renders side by side, see
+	 * Player::renderGroup. A value of 1 renders the jobs one by one.
+	 */
+	void setLanes(unsigned int lanes) { _lanes = std::max(lanes, 1U); }
+
+	/**
+	 * Export the register writes of all inputs instead of rendering them,
+	 * see exportToFile. Lanes are not used then.
+	 */
+	void setExport(ExportFormat format) {
+		_isExport = true;
+		_exportFormat = format;
+	}
+
+	/**
+	 * Render all inputs and print throughput statistics.
+	 *
+	 * @return true when all inputs could be rendered, false otherwise.
+	 */
+	bool run();
+private:
+	struct LaneJob;
+
+	bool nextInput(std::string &input);
+	void finishJob(bool success, uint64_t samples);
+
+	void worker();
+	void laneWorker();
+	bool renderJob(const std::string &input, uint64_t &samples);
+	bool startLaneJob(LaneJob &job);
+	void finishLaneJob(LaneJob &job);
+	std::string outputName(const std::string &input) const;
+
+	const std::string _outputDir;
+	const unsigned int _jobs;
+	const bool _isLoom;
+	const uint64_t _maxSamples;
+	const int _rate;
+	DBOPL::Engine _engine;
+	DBOPL::WaveMode _waveMode;
+	uint32_t _loopLimit;
+	unsigned int _lanes;
+	bool _isExport;
+	ExportFormat _exportFormat;
+
+	std::vector<std::string> _inputs;
+
+	// Everything below is shared between the workers and guarded by _mutex.
+	boost::mutex _mutex;
+	size_t _nextInput;
+	uint64_t _totalSamples;
+	unsigned int _failedJobs;
+};
+
+#endif
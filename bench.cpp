@@ -0,0 +1,481 @@
+/* adplayer - A player for SCUMM AD resource files.
+ *
+ * (c) 2011 by Johannes Schickel <lordhoto at gmail dot com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+// Measures how fast the emulator generates samples for fixed register
+// setups, one for every synth mode combined with the different waveforms,
+// vibrato and tremolo and keyed on or silent channels. Alternatively the
+// register writes of real resources are replayed from write logs. Every wave
+// generator routine is measured along with how far its output is off from
+// the one of the default multiplication tables.
+
+#include "dbopl.h"
+#include "writelog.h"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <stdint.h>
+
+#include <boost/chrono.hpp>
+#include <boost/filesystem.hpp>
+
+namespace {
+typedef boost::chrono::steady_clock Clock;
+
+const uint32_t benchRate = 44100;
+// Samples generated per call, the same as the players use.
+const size_t blockLength = 512;
+
+struct BenchCase {
+	std::string name;
+	// Either 2 for GenerateBlock2 or 3 for GenerateBlock3
+	int block;
+	DBOPL::Engine engine;
+	const char *engineName;
+	DBOPL::WaveMode waves;
+	const char *wavesName;
+	DBOPL::SynthMode mode;
+	const char *modeName;
+	uint8_t waveForm;
+	bool lfo;
+	bool keyed;
+};
+
+struct BenchResult {
+	double median;
+	double deviation;
+	double min;
+	double max;
+};
+
+// How far the output of a wave mode is off from the one of wmTableMul.
+struct Difference {
+	Difference() : max(0), rms(0) {}
+
+	int64_t max;
+	double rms;
+};
+
+// Accumulates the difference of two outputs.
+class DifferenceCounter {
+public:
+	DifferenceCounter() : _max(0), _squares(0), _count(0) {}
+
+	void add(const int32_t *reference, const int32_t *output, size_t count) {
+		for (size_t i = 0; i < count; ++i) {
+			const int64_t delta = static_cast<int64_t>(output[i]) - reference[i];
+			_max = std::max<int64_t>(_max, delta < 0 ? -delta : delta);
+			_squares += static_cast<double>(delta) * delta;
+		}
+		_count += count;
+	}
+
+	Difference result() const {
+		Difference d;
+		d.max = _max;
+		d.rms = _count ? std::sqrt(_squares / _count) : 0;
+		return d;
+	}
+private:
+	int64_t _max;
+	double _squares;
+	uint64_t _count;
+};
+
+const uint8_t operatorOffsets[9] = { 0, 1, 2, 8, 9, 10, 16, 17, 18 };
+
+void writeOperator(DBOPL::Chip &chip, uint32_t bank, uint32_t op, const BenchCase &c) {
+	// Sustained tone with a short attack, tremolo and vibrato optional.
+	chip.WriteReg(bank | (0x20 + op), (c.lfo ? 0xC0 : 0x00) | 0x20 | 0x01);
+	chip.WriteReg(bank | (0x40 + op), 0x08);
+	chip.WriteReg(bank | (0x60 + op), 0xF4);
+	chip.WriteReg(bank | (0x80 + op), 0x24);
+	chip.WriteReg(bank | (0xE0 + op), c.waveForm);
+}
+
+void setupChip(DBOPL::Chip &chip, const BenchCase &c) {
+	chip.Setup(benchRate);
+	chip.engine = c.engine;
+	chip.SetWaveMode(c.waves);
+
+	const bool opl3 = c.block == 3;
+	const bool fourOp = c.mode == DBOPL::sm3FMFM || c.mode == DBOPL::sm3AMFM
+	                    || c.mode == DBOPL::sm3FMAM || c.mode == DBOPL::sm3AMAM;
+	const bool percussion = c.mode == DBOPL::sm2Percussion || c.mode == DBOPL::sm3Percussion;
+
+	chip.WriteReg(0x01, 0x20);
+	chip.WriteReg(0x08, 0x00);
+	if (opl3) {
+		chip.WriteReg(0x105, 0x01);
+		chip.WriteReg(0x104, fourOp ? 0x3F : 0x00);
+	}
+
+	const int banks = opl3 ? 2 : 1;
+	for (int b = 0; b < banks; ++b) {
+		const uint32_t bank = b ? 0x100 : 0;
+		for (int ch = 0; ch < 9; ++ch) {
+			writeOperator(chip, bank, operatorOffsets[ch], c);
+			writeOperator(chip, bank, operatorOffsets[ch] + 3, c);
+
+			// The connection of the first channel of a 4 op pair is the
+			// low bit of the mode, the one of the second channel the high
+			// bit.
+			bool am = c.mode == DBOPL::sm2AM || c.mode == DBOPL::sm3AM;
+			if (fourOp) {
+				const bool second = ch % 6 >= 3;
+				am = second ? (c.mode == DBOPL::sm3FMAM || c.mode == DBOPL::sm3AMAM)
+				            : (c.mode == DBOPL::sm3AMFM || c.mode == DBOPL::sm3AMAM);
+			}
+			chip.WriteReg(bank | (0xC0 + ch), (opl3 ? 0x30 : 0x00) | 0x06 | (am ? 1 : 0));
+
+			// Spread the channels over different frequencies.
+			const uint32_t fnum = 0x158 + ch * 0x2B;
+			chip.WriteReg(bank | (0xA0 + ch), fnum & 0xFF);
+			chip.WriteReg(bank | (0xB0 + ch), (c.keyed ? 0x20 : 0x00) | (4 << 2) | (fnum >> 8));
+		}
+	}
+
+	chip.WriteReg(0xBD, (c.lfo ? 0xC0 : 0x00) | (percussion ? 0x20 : 0x00) | (percussion && c.keyed ? 0x1F : 0x00));
+
+	// Make sure the registers selected the mode which is to be measured.
+	const DBOPL::Channel &check = chip.chan[percussion ? 6 : 0];
+	if (check.synthMode != c.mode)
+		throw std::runtime_error("Register setup did not select the mode of " + c.name);
+}
+
+const DBOPL::WaveMode waveModes[3] = { DBOPL::wmTableMul, DBOPL::wmTableLog, DBOPL::wmHandler };
+const char *const waveModeNames[3] = { "mul", "log", "handler" };
+
+void addCases(std::vector<BenchCase> &cases, int block, DBOPL::Engine engine, const char *engineName,
+              int waves, DBOPL::SynthMode mode, const char *modeName, int waveForms) {
+	for (int waveForm = 0; waveForm < waveForms; ++waveForm) {
+		for (int lfo = 0; lfo < 2; ++lfo) {
+			for (int keyed = 0; keyed < 2; ++keyed) {
+				BenchCase c;
+				char name[128];
+				std::sprintf(name, "block%d/%s/%s/%s/wave%d/%s/%s", block, engineName, waveModeNames[waves],
+				             modeName, waveForm, lfo ? "lfo" : "nolfo", keyed ? "keyed" : "silent");
+				c.name = name;
+				c.block = block;
+				c.engine = engine;
+				c.engineName = engineName;
+				c.waves = waveModes[waves];
+				c.wavesName = waveModeNames[waves];
+				c.mode = mode;
+				c.modeName = modeName;
+				c.waveForm = waveForm;
+				c.lfo = lfo != 0;
+				c.keyed = keyed != 0;
+				cases.push_back(c);
+			}
+		}
+	}
+}
+
+void buildCases(std::vector<BenchCase> &cases) {
+	// The soa engine only supports the multiplication tables.
+	addCases(cases, 2, DBOPL::engineSoA, "soa", 0, DBOPL::sm2AM, "sm2AM", 4);
+	addCases(cases, 2, DBOPL::engineSoA, "soa", 0, DBOPL::sm2FM, "sm2FM", 4);
+	addCases(cases, 2, DBOPL::engineSoA, "soa", 0, DBOPL::sm2Percussion, "sm2Percussion", 4);
+
+	for (int waves = 0; waves < 3; ++waves) {
+		// OPL2 only has the first four waveforms.
+		addCases(cases, 2, DBOPL::engineScalar, "scalar", waves, DBOPL::sm2AM, "sm2AM", 4);
+		addCases(cases, 2, DBOPL::engineScalar, "scalar", waves, DBOPL::sm2FM, "sm2FM", 4);
+		addCases(cases, 2, DBOPL::engineScalar, "scalar", waves, DBOPL::sm2Percussion, "sm2Percussion", 4);
+
+		addCases(cases, 3, DBOPL::engineScalar, "scalar", waves, DBOPL::sm3AM, "sm3AM", 8);
+		addCases(cases, 3, DBOPL::engineScalar, "scalar", waves, DBOPL::sm3FM, "sm3FM", 8);
+		addCases(cases, 3, DBOPL::engineScalar, "scalar", waves, DBOPL::sm3FMFM, "sm3FMFM", 8);
+		addCases(cases, 3, DBOPL::engineScalar, "scalar", waves, DBOPL::sm3AMFM, "sm3AMFM", 8);
+		addCases(cases, 3, DBOPL::engineScalar, "scalar", waves, DBOPL::sm3FMAM, "sm3FMAM", 8);
+		addCases(cases, 3, DBOPL::engineScalar, "scalar", waves, DBOPL::sm3AMAM, "sm3AMAM", 8);
+		addCases(cases, 3, DBOPL::engineScalar, "scalar", waves, DBOPL::sm3Percussion, "sm3Percussion", 8);
+	}
+}
+
+/**
+ * @return Seconds taken to generate the samples.
+ */
+double generate(DBOPL::Chip &chip, int block, size_t samples) {
+	int32_t buffer[blockLength * 2];
+
+	const Clock::time_point start = Clock::now();
+	while (samples > 0) {
+		const size_t length = std::min(samples, blockLength);
+		if (block == 2)
+			chip.GenerateBlock2(length, buffer);
+		else
+			chip.GenerateBlock3(length, buffer);
+		samples -= length;
+	}
+	return boost::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/**
+ * Calculate the statistics of the samples per second of all iterations.
+ */
+BenchResult summarize(std::vector<double> &rates) {
+	std::sort(rates.begin(), rates.end());
+	const size_t n = rates.size();
+
+	BenchResult result;
+	result.median = n % 2 ? rates[n / 2] : (rates[n / 2 - 1] + rates[n / 2]) / 2;
+	result.min = rates.front();
+	result.max = rates.back();
+
+	double mean = 0;
+	for (size_t i = 0; i < n; ++i)
+		mean += rates[i];
+	mean /= n;
+	double variance = 0;
+	for (size_t i = 0; i < n; ++i)
+		variance += (rates[i] - mean) * (rates[i] - mean);
+	result.deviation = n > 1 ? std::sqrt(variance / (n - 1)) : 0;
+	return result;
+}
+
+BenchResult runCase(const BenchCase &c, unsigned int iterations, size_t samples) {
+	DBOPL::Chip chip;
+	setupChip(chip, c);
+
+	// Let the envelopes settle before measuring.
+	generate(chip, c.block, benchRate / 10);
+
+	std::vector<double> rates;
+	for (unsigned int i = 0; i < iterations; ++i) {
+		const double seconds = generate(chip, c.block, samples);
+		rates.push_back(seconds > 0 ? samples / seconds : 0);
+	}
+	return summarize(rates);
+}
+
+/**
+ * Compare the output of a case to the same case with the multiplication
+ * tables, which are the reference for the other wave modes.
+ */
+Difference caseDifference(const BenchCase &c, size_t samples) {
+	Difference none;
+	if (c.waves == DBOPL::wmTableMul)
+		return none;
+
+	BenchCase reference = c;
+	reference.waves = DBOPL::wmTableMul;
+	DBOPL::Chip referenceChip;
+	setupChip(referenceChip, reference);
+	DBOPL::Chip chip;
+	setupChip(chip, c);
+
+	// Compare the settling as well as the measured samples.
+	samples += benchRate / 10;
+	int32_t referenceBuffer[blockLength * 2];
+	int32_t buffer[blockLength * 2];
+	DifferenceCounter counter;
+	while (samples > 0) {
+		const size_t length = std::min(samples, blockLength);
+		if (c.block == 2) {
+			referenceChip.GenerateBlock2(length, referenceBuffer);
+			chip.GenerateBlock2(length, buffer);
+		} else {
+			referenceChip.GenerateBlock3(length, referenceBuffer);
+			chip.GenerateBlock3(length, buffer);
+		}
+		counter.add(referenceBuffer, buffer, length * (c.block == 2 ? 1 : 2));
+		samples -= length;
+	}
+	return counter.result();
+}
+
+/**
+ * Replay a whole write log for every iteration, including its writes.
+ */
+template<class ChipType>
+BenchResult runReplay(const WriteLog &log, DBOPL::Engine engine, DBOPL::WaveMode waves, unsigned int iterations) {
+	int32_t buffer[blockLength];
+
+	std::vector<double> rates;
+	for (unsigned int i = 0; i < iterations; ++i) {
+		ChipType chip;
+		chip.engine = engine;
+		WriteLogPlayer<ChipType> player(log, chip);
+		chip.SetWaveMode(waves);
+
+		uint64_t samples = 0;
+		const Clock::time_point start = Clock::now();
+		while (const size_t generated = player.generate(buffer, blockLength))
+			samples += generated;
+		const double seconds = boost::chrono::duration<double>(Clock::now() - start).count();
+		rates.push_back(seconds > 0 ? samples / seconds : 0);
+	}
+	return summarize(rates);
+}
+
+template<class ChipType>
+Difference replayDifference(const WriteLog &log, DBOPL::WaveMode waves) {
+	Difference none;
+	if (waves == DBOPL::wmTableMul)
+		return none;
+
+	ChipType referenceChip;
+	WriteLogPlayer<ChipType> reference(log, referenceChip);
+	ChipType chip;
+	WriteLogPlayer<ChipType> player(log, chip);
+	chip.SetWaveMode(waves);
+
+	// Both players see the same writes, thus their blocks are the same.
+	int32_t referenceBuffer[blockLength];
+	int32_t buffer[blockLength];
+	DifferenceCounter counter;
+	while (const size_t generated = reference.generate(referenceBuffer, blockLength)) {
+		player.generate(buffer, blockLength);
+		counter.add(referenceBuffer, buffer, generated);
+	}
+	return counter.result();
+}
+
+void printResult(bool json, bool &first, const std::string &name, const std::string &fields, const BenchResult &r,
+                 const Difference &d) {
+	if (json) {
+		std::printf("%s\n  {\"name\": \"%s\", %s, \"median\": %.0f, \"deviation\": %.0f, "
+		            "\"min\": %.0f, \"max\": %.0f, \"maxdiff\": %lld, \"rmsdiff\": %.3f}",
+		            first ? "" : ",", name.c_str(), fields.c_str(), r.median, r.deviation, r.min, r.max,
+		            static_cast<long long>(d.max), d.rms);
+	} else {
+		std::printf("%s\t%.0f\t%.0f\t%.0f\t%.0f\t%lld\t%.3f\n", name.c_str(), r.median, r.deviation, r.min, r.max,
+		            static_cast<long long>(d.max), d.rms);
+	}
+	std::fflush(stdout);
+	first = false;
+}
+
+void outputHelp() {
+	std::printf("Usage:\n"
+	            "\tadbench [--iterations count] [--samples count] [--filter text] [--json]\n"
+	            "\tadbench [--iterations count] [--json] --replay log-file...\n"
+	            "\n"
+	            "\t    --iterations  Number of measurements per case, defaults to 7\n"
+	            "\t    --samples     Samples generated per measurement, defaults to 44100\n"
+	            "\t    --filter      Only run cases whose name contains text\n"
+	            "\t    --json        Write the results as JSON instead of a table\n"
+	            "\t    --replay      Replay write logs made with adplayer --write-log\n"
+	            "\t                  with every engine instead of the fixed setups\n"
+	            "\n"
+	            "\tmaxdiff and rmsdiff are the largest and the RMS difference of the\n"
+	            "\toutput to the one of the mul wave generator.\n");
+}
+} // End of anonymous namespace
+
+int main(int argc, char *argv[]) {
+	unsigned int iterations = 7;
+	size_t samples = benchRate;
+	std::string filter;
+	bool json = false;
+	bool replay = false;
+	std::vector<std::string> logs;
+
+	for (int i = 1; i < argc; ++i) {
+		if (!std::strcmp(argv[i], "--iterations") && i + 1 < argc) {
+			iterations = std::atoi(argv[++i]);
+		} else if (!std::strcmp(argv[i], "--samples") && i + 1 < argc) {
+			samples = std::atoi(argv[++i]);
+		} else if (!std::strcmp(argv[i], "--filter") && i + 1 < argc) {
+			filter = argv[++i];
+		} else if (!std::strcmp(argv[i], "--json")) {
+			json = true;
+		} else if (!std::strcmp(argv[i], "--replay")) {
+			replay = true;
+		} else if (replay && argv[i][0] != '-') {
+			logs.push_back(argv[i]);
+		} else {
+			outputHelp();
+			return -1;
+		}
+	}
+
+	if (!iterations || !samples || (replay && logs.empty())) {
+		outputHelp();
+		return -1;
+	}
+
+	std::vector<BenchCase> cases;
+	buildCases(cases);
+
+	try {
+		if (json)
+			std::printf("{\"iterations\": %u, \"samples\": %u, \"cases\": [", iterations, static_cast<unsigned int>(samples));
+		else
+			std::printf("case\tmedian\tdeviation\tmin\tmax\tmaxdiff\trmsdiff\n");
+
+		bool first = true;
+		for (std::vector<std::string>::const_iterator i = logs.begin(); i != logs.end(); ++i) {
+			WriteLog log;
+			log.load(*i);
+
+			const std::string logName = boost::filesystem::path(*i).filename().string();
+			// Logs of the players replay on the OPL2 only chip they use.
+			const bool opl3 = log.hasHighWrites();
+			// The soa engine only supports the multiplication tables.
+			const DBOPL::Engine engines[] = { DBOPL::engineScalar, DBOPL::engineSoA, DBOPL::engineScalar, DBOPL::engineScalar };
+			const char *const engineNames[] = { "scalar", "soa", "scalar", "scalar" };
+			const int engineWaves[] = { 0, 0, 1, 2 };
+			for (int engine = 0; engine < 4; ++engine) {
+				const int waves = engineWaves[engine];
+				char fields[256];
+				std::sprintf(fields, "\"log\": \"%s\", \"chip\": \"%s\", \"engine\": \"%s\", \"waves\": \"%s\", \"samples\": %llu",
+				             logName.c_str(), opl3 ? "opl3" : "opl2", engineNames[engine], waveModeNames[waves],
+				             static_cast<unsigned long long>(log.getLength()));
+				const BenchResult result = opl3
+				    ? runReplay<DBOPL::Chip>(log, engines[engine], waveModes[waves], iterations)
+				    : runReplay<DBOPL::Opl2Chip>(log, engines[engine], waveModes[waves], iterations);
+				const Difference difference = opl3
+				    ? replayDifference<DBOPL::Chip>(log, waveModes[waves])
+				    : replayDifference<DBOPL::Opl2Chip>(log, waveModes[waves]);
+				printResult(json, first, "replay/" + logName + "/" + engineNames[engine] + "/" + waveModeNames[waves],
+				            fields, result, difference);
+			}
+		}
+
+		for (std::vector<BenchCase>::const_iterator i = cases.begin(); i != cases.end() && !replay; ++i) {
+			if (i->name.find(filter) == std::string::npos)
+				continue;
+
+			char fields[256];
+			std::sprintf(fields, "\"block\": %d, \"engine\": \"%s\", \"waves\": \"%s\", \"mode\": \"%s\", "
+			             "\"waveform\": %d, \"lfo\": %s, \"keyed\": %s",
+			             i->block, i->engineName, i->wavesName, i->modeName, i->waveForm,
+			             i->lfo ? "true" : "false", i->keyed ? "true" : "false");
+			printResult(json, first, i->name, fields, runCase(*i, iterations, samples),
+			            caseDifference(*i, samples));
+		}
+
+		if (json)
+			std::printf("\n]}\n");
+	} catch (const std::exception &e) {
+		std::fprintf(stderr, "ERROR: %s\n", e.what());
+		return -1;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,880 @@
+/* adplayer - A player for SCUMM AD resource files.
+ *
+ * (c) 2011 by Johannes Schickel <lordhoto at gmail dot com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+// Checks that the output of the emulator and the players is bit exact.
+//
+// Reference output is generated with the scalar engine for synthetic
+// register sequences and for AD resources, and compared to the hashes in a
+// golden file. Every other way to generate the same output, like the other
+// engines, rendering side by side, rendering in threads or continuing from a
+// snapshot, has to produce exactly the reference output. Replaying a write
+// log has to produce exactly the output the log was recorded from. The
+// validator has to reject malformed resources the players can't handle.
+
+#include "adplayer.h"
+#include "render.h"
+#include "dbopl.h"
+#include "writelog.h"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <stdint.h>
+
+#include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/bind/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/filesystem.hpp>
+
+namespace fs = boost::filesystem;
+
+namespace {
+const int checkRate = 44100;
+// Longest block the emulator generates at once, the same as the players use.
+const size_t maxBlockLength = 512;
+// Resources may loop forever, thus their output is limited.
+const uint64_t maxResourceSamples = static_cast<uint64_t>(5 * 60) * checkRate;
+
+typedef std::map<std::string, uint64_t> HashMap;
+
+/**
+ * 64 bit FNV-1a hash of output samples.
+ */
+class OutputHash {
+public:
+	OutputHash() : _hash(0xCBF29CE484222325ULL), _audible(false) {}
+
+	void add(const int32_t *samples, size_t count) {
+		for (size_t i = 0; i < count; ++i) {
+			const uint32_t value = static_cast<uint32_t>(samples[i]);
+			_audible |= value != 0;
+			for (int byte = 0; byte < 4; ++byte) {
+				_hash ^= (value >> (byte * 8)) & 0xFF;
+				_hash *= 0x100000001B3ULL;
+			}
+		}
+	}
+
+	void add(const int16_t *samples, size_t count) {
+		for (size_t i = 0; i < count; ++i) {
+			const uint16_t value = static_cast<uint16_t>(samples[i]);
+			_audible |= value != 0;
+			_hash ^= value & 0xFF;
+			_hash *= 0x100000001B3ULL;
+			_hash ^= value >> 8;
+			_hash *= 0x100000001B3ULL;
+		}
+	}
+
+	uint64_t get() const { return _hash; }
+
+	/**
+	 * @return Whether any sample was not zero.
+	 */
+	bool isAudible() const { return _audible; }
+private:
+	uint64_t _hash;
+	bool _audible;
+};
+
+std::string formatHash(uint64_t hash) {
+	char buffer[17];
+	std::sprintf(buffer, "%016llx", static_cast<unsigned long long>(hash));
+	return buffer;
+}
+
+/**
+ * Synthetic sequence of register writes.
+ */
+struct RegisterSequence {
+	struct Write {
+		// Samples to generate before the write
+		uint32_t delay;
+		uint16_t reg;
+		uint8_t value;
+	};
+
+	std::string name;
+	bool opl3;
+	std::vector<Write> writes;
+	// Samples generated after the last write
+	uint32_t tail;
+};
+
+class Random {
+public:
+	Random(uint32_t seed) : _state(seed) {}
+
+	uint32_t next(uint32_t range) {
+		_state = _state * 1103515245 + 12345;
+		return (_state >> 8) % range;
+	}
+private:
+	uint32_t _state;
+};
+
+const uint8_t operatorOffsets[18] = { 0, 1, 2, 3, 4, 5, 8, 9, 10, 11, 12, 13, 16, 17, 18, 19, 20, 21 };
+
+void addWrite(RegisterSequence &sequence, uint32_t delay, uint16_t reg, uint8_t value) {
+	const RegisterSequence::Write write = { delay, reg, value };
+	sequence.writes.push_back(write);
+}
+
+/**
+ * Create a sequence of random register writes. Notes are keyed on and off
+ * regularly, so most of the time something is playing.
+ */
+RegisterSequence randomSequence(const std::string &name, uint32_t seed, bool opl3, bool fourOp,
+                                bool percussion, uint32_t writes, uint32_t maxDelay) {
+	RegisterSequence sequence;
+	sequence.name = name;
+	sequence.opl3 = opl3;
+	sequence.tail = checkRate;
+
+	Random random(seed);
+	addWrite(sequence, 0, 0x01, 0x20);
+	if (opl3) {
+		addWrite(sequence, 0, 0x105, 0x01);
+		addWrite(sequence, 0, 0x104, fourOp ? 0x3F : 0x00);
+	}
+
+	const uint32_t banks = opl3 ? 2 : 1;
+	for (uint32_t i = 0; i < writes; ++i) {
+		const uint32_t delay = random.next(4) ? 0 : random.next(maxDelay);
+		const uint16_t bank = random.next(banks) ? 0x100 : 0;
+		const uint8_t op = operatorOffsets[random.next(18)];
+		const uint8_t channel = random.next(9);
+		const uint8_t value = random.next(256);
+
+		switch (random.next(10)) {
+		case 0:
+			addWrite(sequence, delay, bank | (0x20 + op), value);
+			break;
+		case 1:
+			// Mostly audible levels
+			addWrite(sequence, delay, bank | (0x40 + op), value & 0xDF);
+			break;
+		case 2:
+			addWrite(sequence, delay, bank | (0x60 + op), value | 0x10);
+			break;
+		case 3:
+			addWrite(sequence, delay, bank | (0x80 + op), value);
+			break;
+		case 4:
+			addWrite(sequence, delay, bank | (0xE0 + op), value & 0x07);
+			break;
+		case 5:
+			addWrite(sequence, delay, bank | (0xA0 + channel), value);
+			break;
+		case 6:
+		case 7:
+			// Key on more often than off
+			addWrite(sequence, delay, bank | (0xB0 + channel), (random.next(3) ? 0x20 : 0x00) | (value & 0x1F));
+			break;
+		case 8:
+			addWrite(sequence, delay, bank | (0xC0 + channel), value);
+			break;
+		case 9:
+			addWrite(sequence, delay, 0xBD, (value & 0xC0) | (percussion ? 0x20 | (value & 0x1F) : 0x00));
+			break;
+		}
+	}
+
+	return sequence;
+}
+
+void buildSequences(std::vector<RegisterSequence> &sequences) {
+	// About five seconds each, the dense one writes every few samples.
+	sequences.push_back(randomSequence("opl2-melodic", 1, false, false, false, 1600, 1200));
+	sequences.push_back(randomSequence("opl2-melodic-dense", 2, false, false, false, 16000, 120));
+	sequences.push_back(randomSequence("opl2-percussion", 3, false, false, true, 1600, 1200));
+	sequences.push_back(randomSequence("opl3-melodic", 4, true, false, false, 1600, 1200));
+	sequences.push_back(randomSequence("opl3-fourop", 5, true, true, false, 1600, 1200));
+	sequences.push_back(randomSequence("opl3-percussion", 6, true, true, true, 1600, 1200));
+}
+
+/**
+ * Generate a block of a sequence. OPL3 sequences are generated in stereo
+ * with GenerateBlock3.
+ *
+ * @return Number of values stored in buffer.
+ */
+size_t generateSequence(DBOPL::Chip &chip, bool opl3, uint32_t length, int32_t *buffer) {
+	if (opl3) {
+		chip.GenerateBlock3(length, buffer);
+		return length * 2;
+	}
+	chip.GenerateBlock2(length, buffer);
+	return length;
+}
+
+/**
+ * The OPL2 only chip has no GenerateBlock3, it only plays OPL2 sequences.
+ */
+size_t generateSequence(DBOPL::Opl2Chip &chip, bool, uint32_t length, int32_t *buffer) {
+	chip.GenerateBlock2(length, buffer);
+	return length;
+}
+
+/**
+ * Play a sequence with one chip on its own.
+ */
+template<class ChipType>
+uint64_t renderSequence(const RegisterSequence &sequence, DBOPL::Engine engine) {
+	ChipType chip;
+	chip.Setup(checkRate);
+	chip.engine = engine;
+
+	OutputHash hash;
+	int32_t buffer[maxBlockLength * 2];
+
+	for (size_t i = 0; i <= sequence.writes.size(); ++i) {
+		const bool last = i == sequence.writes.size();
+		uint32_t samples = last ? sequence.tail : sequence.writes[i].delay;
+		while (samples > 0) {
+			const uint32_t length = std::min<uint32_t>(samples, maxBlockLength);
+			hash.add(buffer, generateSequence(chip, sequence.opl3, length, buffer));
+			samples -= length;
+		}
+		if (!last)
+			chip.WriteReg(sequence.writes[i].reg, sequence.writes[i].value);
+	}
+
+	// A silent sequence would not check anything.
+	if (!hash.isAudible())
+		throw std::runtime_error("Sequence " + sequence.name + " is silent");
+	return hash.get();
+}
+
+/**
+ * Play OPL2 sequences side by side with ChipLanes.
+ */
+template<class ChipType>
+void renderSequenceLanes(const std::vector<const RegisterSequence *> &sequences, std::vector<uint64_t> &hashes) {
+	struct Slot {
+		ChipType chip;
+		OutputHash hash;
+		size_t next;
+		uint32_t untilWrite;
+		size_t blockLength;
+		int32_t buffer[maxBlockLength];
+	};
+
+	const size_t count = sequences.size();
+	if (count > DBOPL::ChipLanes::MAX_CHIPS)
+		throw std::runtime_error("Too many sequences for one ChipLanes");
+
+	std::vector<boost::shared_ptr<Slot> > slots;
+	for (size_t i = 0; i < count; ++i) {
+		boost::shared_ptr<Slot> slot(new Slot());
+		slot->chip.Setup(checkRate);
+		slot->next = 0;
+		slot->untilWrite = sequences[i]->writes.empty() ? sequences[i]->tail : sequences[i]->writes[0].delay;
+		slot->blockLength = 0;
+		slots.push_back(slot);
+	}
+
+	DBOPL::ChipLanes lanes;
+	while (true) {
+		size_t samples = 0;
+		for (size_t i = 0; i < count; ++i) {
+			Slot &slot = *slots[i];
+			const RegisterSequence &sequence = *sequences[i];
+
+			if (!slot.blockLength) {
+				// Apply all writes which are due and start the next block.
+				while (!slot.untilWrite && slot.next < sequence.writes.size()) {
+					slot.chip.WriteReg(sequence.writes[slot.next].reg, sequence.writes[slot.next].value);
+					++slot.next;
+					slot.untilWrite = slot.next < sequence.writes.size() ? sequence.writes[slot.next].delay : sequence.tail;
+				}
+				if (!slot.untilWrite)
+					continue;
+
+				slot.blockLength = std::min<size_t>(slot.untilWrite, maxBlockLength);
+				lanes.Begin(i, &slot.chip, slot.blockLength, slot.buffer);
+			}
+
+			if (!samples || lanes.Left(i) < samples)
+				samples = lanes.Left(i);
+		}
+
+		if (!samples)
+			break;
+
+		lanes.Generate(samples);
+
+		for (size_t i = 0; i < count; ++i) {
+			Slot &slot = *slots[i];
+			if (slot.blockLength && !lanes.Left(i)) {
+				slot.hash.add(slot.buffer, slot.blockLength);
+				slot.untilWrite -= slot.blockLength;
+				slot.blockLength = 0;
+			}
+		}
+	}
+
+	hashes.clear();
+	for (size_t i = 0; i < count; ++i)
+		hashes.push_back(slots[i]->hash.get());
+}
+
+/**
+ * AD resource which is checked.
+ */
+struct Resource {
+	std::string name;
+	bool isLoom;
+	FileBuffer data;
+};
+
+Player *createResourcePlayer(const Resource &resource, DBOPL::Engine engine) {
+	Player *player = createPlayer(resource.data, resource.isLoom, checkRate);
+	player->setEngine(engine);
+	return player;
+}
+
+/**
+ * Render a resource the way renderToFile does.
+ *
+ * @param length Set to the number of samples rendered.
+ */
+uint64_t renderResource(const Resource &resource, uint64_t &length) {
+	boost::scoped_ptr<Player> player(createResourcePlayer(resource, DBOPL::engineScalar));
+	OutputHash hash;
+	int16_t buffer[renderChunkLength];
+
+	length = 0;
+	while (player->isPlaying() && length < maxResourceSamples) {
+		const size_t samples = std::min<uint64_t>(maxResourceSamples - length, renderChunkLength);
+		player->render(buffer, samples);
+		hash.add(buffer, samples);
+		length += samples;
+	}
+	return hash.get();
+}
+
+/**
+ * Render a number of samples of a player with changing chunk sizes.
+ */
+void renderSamples(Player &player, uint64_t length, size_t maxChunk, OutputHash &hash) {
+	int16_t buffer[renderChunkLength];
+	size_t chunk = 1;
+	while (length > 0) {
+		chunk = chunk % maxChunk + 1;
+		const size_t samples = std::min<uint64_t>(length, chunk);
+		player.render(buffer, samples);
+		hash.add(buffer, samples);
+		length -= samples;
+		// Walk through the chunk sizes in large steps.
+		chunk = (chunk * 37) % maxChunk;
+	}
+}
+
+uint64_t renderResourceWith(const Resource &resource, DBOPL::Engine engine, uint64_t length, size_t maxChunk) {
+	boost::scoped_ptr<Player> player(createResourcePlayer(resource, engine));
+	OutputHash hash;
+	renderSamples(*player, length, maxChunk, hash);
+	return hash.get();
+}
+
+/**
+ * Render the first half of a resource, then continue with another player
+ * from a snapshot.
+ */
+uint64_t renderResourceForked(const Resource &resource, uint64_t length) {
+	boost::scoped_ptr<Player> first(createResourcePlayer(resource, DBOPL::engineScalar));
+	OutputHash hash;
+	renderSamples(*first, length / 2, renderChunkLength, hash);
+
+	StateBuffer state;
+	first->saveState(state);
+	first.reset();
+
+	boost::scoped_ptr<Player> second(createResourcePlayer(resource, DBOPL::engineScalar));
+	second->loadState(state);
+	renderSamples(*second, length - length / 2, renderChunkLength, hash);
+	return hash.get();
+}
+
+/**
+ * Render a resource while logging its writes and replay the log afterwards.
+ * Loops are not cached while logging, thus the output may differ from the
+ * reference for looping resources.
+ *
+ * @param replayed Set to the hash of the replayed output.
+ * @return Hash of the output rendered while logging.
+ */
+uint64_t renderResourceLogged(const Resource &resource, uint64_t length, uint64_t &replayed) {
+	WriteLog log(checkRate);
+	OutputHash hash;
+	{
+		boost::scoped_ptr<Player> player(createResourcePlayer(resource, DBOPL::engineScalar));
+		player->setWriteLog(&log);
+		renderSamples(*player, length, renderChunkLength, hash);
+		log.finish(length);
+	}
+
+	DBOPL::Opl2Chip chip;
+	WriteLogPlayer<DBOPL::Opl2Chip> logPlayer(log, chip);
+	OutputHash replayHash;
+	int32_t buffer[maxBlockLength];
+	int16_t samples[maxBlockLength];
+	while (const size_t generated = logPlayer.generate(buffer, maxBlockLength)) {
+		// The same scaling as the players use.
+		for (size_t i = 0; i < generated; ++i)
+			samples[i] = buffer[i] * 435 / 256;
+		replayHash.add(samples, generated);
+	}
+
+	replayed = replayHash.get();
+	return hash.get();
+}
+
+/**
+ * Render all resources side by side with Player::renderGroup.
+ */
+void renderResourceGroup(const std::vector<Resource> &resources, const std::vector<uint64_t> &lengths,
+                         std::vector<uint64_t> &hashes) {
+	std::vector<boost::shared_ptr<Player> > players;
+	std::vector<std::vector<int16_t> > buffers(resources.size(), std::vector<int16_t>(renderChunkLength));
+	std::vector<OutputHash> outputs(resources.size());
+	std::vector<uint64_t> done(resources.size(), 0);
+	for (size_t i = 0; i < resources.size(); ++i)
+		players.push_back(boost::shared_ptr<Player>(createResourcePlayer(resources[i], DBOPL::engineScalar)));
+
+	while (true) {
+		std::vector<Player *> active;
+		std::vector<int16_t *> activeBuffers;
+		std::vector<size_t> indices;
+		uint64_t chunk = renderChunkLength;
+		for (size_t i = 0; i < resources.size(); ++i) {
+			if (done[i] == lengths[i])
+				continue;
+			active.push_back(players[i].get());
+			activeBuffers.push_back(&buffers[i][0]);
+			indices.push_back(i);
+			chunk = std::min(chunk, lengths[i] - done[i]);
+		}
+
+		if (active.empty())
+			break;
+
+		Player::renderGroup(&active[0], active.size(), &activeBuffers[0], chunk);
+		for (size_t i = 0; i < indices.size(); ++i) {
+			outputs[indices[i]].add(activeBuffers[i], chunk);
+			done[indices[i]] += chunk;
+		}
+	}
+
+	hashes.clear();
+	for (size_t i = 0; i < resources.size(); ++i)
+		hashes.push_back(outputs[i].get());
+}
+
+void renderResourceThread(const Resource *resource, uint64_t length, uint64_t *hash) {
+	*hash = renderResourceWith(*resource, DBOPL::engineScalar, length, renderChunkLength);
+}
+
+/**
+ * Render all resources at the same time, each in a thread of its own.
+ */
+void renderResourceThreads(const std::vector<Resource> &resources, const std::vector<uint64_t> &lengths,
+                           std::vector<uint64_t> &hashes) {
+	hashes.assign(resources.size(), 0);
+	boost::thread_group threads;
+	for (size_t i = 0; i < resources.size(); ++i)
+		threads.create_thread(boost::bind(renderResourceThread, &resources[i], lengths[i], &hashes[i]));
+	threads.join_all();
+}
+
+/**
+ * Collects the results of all checks.
+ */
+class Checker {
+public:
+	Checker(const HashMap &golden) : _golden(golden), _computed(), _failures(0), _missing(0) {}
+
+	/**
+	 * Compare a reference hash to the golden file.
+	 */
+	void reference(const std::string &name, uint64_t hash) {
+		_computed[name] = hash;
+
+		HashMap::const_iterator golden = _golden.find(name);
+		if (golden == _golden.end()) {
+			std::printf("NEW   %s reference %s\n", name.c_str(), formatHash(hash).c_str());
+			++_missing;
+		} else {
+			compare(name, "reference", golden->second, hash);
+		}
+	}
+
+	/**
+	 * Compare another way of generating the output to the reference.
+	 */
+	void variant(const std::string &name, const char *variant, uint64_t hash) {
+		compare(name, variant, _computed[name], hash);
+	}
+
+	/**
+	 * Compare two ways of generating output which is not the reference.
+	 */
+	void equal(const std::string &name, const char *what, uint64_t expected, uint64_t hash) {
+		compare(name, what, expected, hash);
+	}
+
+	/**
+	 * Record the result of a check which doesn't produce output.
+	 */
+	void expect(const std::string &name, const char *what, bool passed) {
+		std::printf("%s  %s %s\n", passed ? "PASS" : "FAIL", name.c_str(), what);
+		if (!passed)
+			++_failures;
+		std::fflush(stdout);
+	}
+
+	const HashMap &getComputed() const { return _computed; }
+	unsigned int getFailures() const { return _failures; }
+	unsigned int getMissing() const { return _missing; }
+private:
+	void compare(const std::string &name, const char *what, uint64_t expected, uint64_t hash) {
+		if (hash == expected) {
+			std::printf("PASS  %s %s\n", name.c_str(), what);
+		} else {
+			std::printf("FAIL  %s %s: expected %s, got %s\n", name.c_str(), what,
+			            formatHash(expected).c_str(), formatHash(hash).c_str());
+			++_failures;
+		}
+		std::fflush(stdout);
+	}
+
+	const HashMap &_golden;
+	HashMap _computed;
+	unsigned int _failures;
+	unsigned int _missing;
+};
+
+void checkSequences(Checker &checker) {
+	std::vector<RegisterSequence> sequences;
+	buildSequences(sequences);
+
+	std::vector<const RegisterSequence *> opl2;
+	for (std::vector<RegisterSequence>::const_iterator i = sequences.begin(); i != sequences.end(); ++i) {
+		const std::string name = "sequence:" + i->name;
+		checker.reference(name, renderSequence<DBOPL::Chip>(*i, DBOPL::engineScalar));
+
+		// The other engines and the OPL2 only chip, which the players use,
+		// only exist for OPL2 output.
+		if (!i->opl3) {
+			checker.variant(name, "soa", renderSequence<DBOPL::Chip>(*i, DBOPL::engineSoA));
+			checker.variant(name, "opl2chip", renderSequence<DBOPL::Opl2Chip>(*i, DBOPL::engineScalar));
+			checker.variant(name, "opl2chip-soa", renderSequence<DBOPL::Opl2Chip>(*i, DBOPL::engineSoA));
+			opl2.push_back(&*i);
+		}
+	}
+
+	std::vector<uint64_t> hashes;
+	renderSequenceLanes<DBOPL::Chip>(opl2, hashes);
+	for (size_t i = 0; i < opl2.size(); ++i)
+		checker.variant("sequence:" + opl2[i]->name, "lanes", hashes[i]);
+	renderSequenceLanes<DBOPL::Opl2Chip>(opl2, hashes);
+	for (size_t i = 0; i < opl2.size(); ++i)
+		checker.variant("sequence:" + opl2[i]->name, "opl2chip-lanes", hashes[i]);
+}
+
+/**
+ * Small resource the validator has to accept or reject.
+ */
+struct ValidationCase {
+	const char *name;
+	bool valid;
+	size_t length;
+	uint8_t data[24];
+};
+
+// SFX slots play on the channels following the start channel times 3. The
+// ones going past the 9 channels of an OPL2 are next to ones which just fit.
+const ValidationCase validationCases[] = {
+	{ "sfx-start-channel-2", true, 18,
+	  { 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF } },
+	{ "sfx-start-channel-3", false, 18,
+	  { 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF } },
+	{ "sfx-slots-up-to-channel-8", true, 20,
+	  { 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0xFF } },
+	{ "sfx-slots-past-channel-8", false, 21,
+	  { 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0xFF } }
+};
+
+void checkValidation(Checker &checker) {
+	for (size_t i = 0; i < sizeof(validationCases) / sizeof(validationCases[0]); ++i) {
+		const ValidationCase &validation = validationCases[i];
+		const FileBuffer data(validation.data, validation.data + validation.length);
+
+		bool accepted = true;
+		try {
+			validateADFile(data);
+		} catch (const std::runtime_error &) {
+			accepted = false;
+		}
+		checker.expect(std::string("validate:") + validation.name, validation.valid ? "accepted" : "rejected",
+		               accepted == validation.valid);
+	}
+}
+
+/**
+ * Looping music with a note before the loop start, which still rings in the
+ * first repetition. The loop takes 67 ticks, a tempo of 128 makes those 134
+ * callbacks.
+ */
+Resource buildLoopResource() {
+	static const uint8_t events[] = {
+		0x90, 0x3C, 0x7F, 0x10,
+		0x80, 0x3C, 0x00, 0x00,
+		// Loop start
+		0x90, 0x40, 0x7F, 0x7E,
+		0x80, 0x40, 0x00, 0x08,
+		0xFF, 0x2F
+	};
+	// An FM instrument with a silent modulator and a slow release.
+	static const uint8_t instrument[] = {
+		0x00, 0x00, 0x00,
+		0x01, 0x3F, 0xF0, 0x00, 0x00,
+		0x21, 0x00, 0xF0, 0x04, 0x00,
+		0x00
+	};
+
+	Resource resource;
+	resource.name = "loop";
+	resource.isLoom = false;
+	resource.data.resize(0x93);
+	resource.data[2] = 0x80;
+	resource.data[3] = 128;
+	resource.data[5] = 8;
+	resource.data[10] = 1;
+	resource.data[11] = 1;
+	std::copy(instrument, instrument + sizeof(instrument), resource.data.begin() + 19);
+	resource.data.insert(resource.data.end(), events, events + sizeof(events));
+	return resource;
+}
+
+/**
+ * Render one sample at a time until a player stops.
+ *
+ * @return Number of samples rendered, including the one it stopped in.
+ */
+uint64_t renderWhilePlaying(Player &player) {
+	uint64_t length = 0;
+	int16_t sample;
+	while (player.isPlaying()) {
+		player.render(&sample, 1);
+		++length;
+	}
+	return length;
+}
+
+void checkLoops(Checker &checker) {
+	const Resource resource = buildLoopResource();
+
+	// A loop limit stops the music at a loop point, without caching.
+	uint64_t lengths[2];
+	for (uint32_t loops = 1; loops <= 2; ++loops) {
+		boost::scoped_ptr<Player> player(createResourcePlayer(resource, DBOPL::engineScalar));
+		player->setLoopLimit(loops);
+		lengths[loops - 1] = renderWhilePlaying(*player);
+	}
+
+	// The loop starts again in the callback the track ends in.
+	const uint64_t period = lengths[1] - lengths[0];
+	const uint64_t expected = 134 * checkRate / 472;
+	checker.expect("loop:period", "134 callbacks", period >= expected && period <= expected + 1);
+
+	// The cache replaces the output from the third loop point on, in the
+	// sample the limited player stopped in.
+	boost::scoped_ptr<Player> limited(createResourcePlayer(resource, DBOPL::engineScalar));
+	limited->setLoopLimit(2);
+	OutputHash generated;
+	renderSamples(*limited, lengths[1] - 1, renderChunkLength, generated);
+
+	boost::scoped_ptr<Player> cached(createResourcePlayer(resource, DBOPL::engineScalar));
+	OutputHash replayed;
+	renderSamples(*cached, lengths[1] - 1, renderChunkLength, replayed);
+	checker.equal("loop:cache", "two repetitions generated", generated.get(), replayed.get());
+}
+
+void checkResources(Checker &checker, const std::vector<Resource> &resources) {
+	std::vector<uint64_t> lengths;
+	for (std::vector<Resource>::const_iterator i = resources.begin(); i != resources.end(); ++i) {
+		uint64_t length = 0;
+		checker.reference(i->name, renderResource(*i, length));
+		lengths.push_back(length);
+
+		checker.variant(i->name, "soa", renderResourceWith(*i, DBOPL::engineSoA, lengths.back(), renderChunkLength));
+		checker.variant(i->name, "chunked", renderResourceWith(*i, DBOPL::engineScalar, lengths.back(), 997));
+		checker.variant(i->name, "snapshot", renderResourceForked(*i, lengths.back()));
+
+		uint64_t replayed = 0;
+		const uint64_t logged = renderResourceLogged(*i, lengths.back(), replayed);
+		checker.equal(i->name, "replay", logged, replayed);
+	}
+
+	if (resources.empty())
+		return;
+
+	std::vector<uint64_t> hashes;
+	// Groups hold at most MAX_CHIPS players each.
+	for (size_t first = 0; first < resources.size(); first += DBOPL::ChipLanes::MAX_CHIPS) {
+		const size_t last = std::min<size_t>(first + DBOPL::ChipLanes::MAX_CHIPS, resources.size());
+		const std::vector<Resource> group(resources.begin() + first, resources.begin() + last);
+		const std::vector<uint64_t> groupLengths(lengths.begin() + first, lengths.begin() + last);
+		renderResourceGroup(group, groupLengths, hashes);
+		for (size_t i = 0; i < group.size(); ++i)
+			checker.variant(group[i].name, "group", hashes[i]);
+	}
+
+	renderResourceThreads(resources, lengths, hashes);
+	for (size_t i = 0; i < resources.size(); ++i)
+		checker.variant(resources[i].name, "threads", hashes[i]);
+}
+
+void addResource(std::vector<Resource> &resources, const std::string &path, bool isLoom) {
+	if (fs::is_directory(path)) {
+		std::vector<std::string> files;
+		for (fs::directory_iterator i(path), end; i != end; ++i) {
+			if (fs::is_regular_file(i->status()))
+				files.push_back(i->path().string());
+		}
+		std::sort(files.begin(), files.end());
+		for (std::vector<std::string>::const_iterator i = files.begin(); i != files.end(); ++i)
+			addResource(resources, *i, isLoom);
+		return;
+	}
+
+	Resource resource;
+	resource.name = "resource:" + fs::path(path).filename().string();
+	resource.isLoom = isLoom;
+	loadADFile(path, resource.data);
+	validateADFile(resource.data);
+	resources.push_back(resource);
+}
+
+void loadGolden(const std::string &filename, HashMap &golden) {
+	std::ifstream file(filename.c_str());
+	if (!file)
+		return;
+
+	std::string line;
+	while (std::getline(file, line)) {
+		if (line.empty() || line[0] == '#')
+			continue;
+
+		std::istringstream fields(line);
+		std::string name, hash;
+		if (!(fields >> name >> hash) || hash.size() != 16)
+			throw std::runtime_error("Invalid line in golden file: " + line);
+		golden[name] = std::strtoull(hash.c_str(), 0, 16);
+	}
+}
+
+void saveGolden(const std::string &filename, const HashMap &golden) {
+	std::ofstream file(filename.c_str());
+	file << "# Hashes of the reference output of the scalar engine, see check.cpp.\n"
+	     << "# Update with: make check-update [CHECK_INPUTS=...]\n";
+	for (HashMap::const_iterator i = golden.begin(); i != golden.end(); ++i)
+		file << i->first << ' ' << formatHash(i->second) << '\n';
+	if (!file)
+		throw std::runtime_error("Writing golden file failed: " + filename);
+}
+
+void outputHelp() {
+	std::printf("Usage:\n"
+	            "\tadcheck [--update] golden-file [[--loom] input...]\n"
+	            "\n"
+	            "\t    --update      Store the reference hashes in golden-file instead\n"
+	            "\t                  of comparing to it\n"
+	            "\t    --loom        Following inputs are Loom v3 music files\n"
+	            "\n"
+	            "Inputs are AD resources or directories containing them.\n");
+}
+} // End of anonymous namespace
+
+int main(int argc, char *argv[]) {
+	bool update = false;
+	std::string goldenFile;
+	std::vector<std::pair<std::string, bool> > inputs;
+	bool isLoom = false;
+
+	for (int i = 1; i < argc; ++i) {
+		if (!std::strcmp(argv[i], "--update")) {
+			update = true;
+		} else if (!std::strcmp(argv[i], "--loom")) {
+			isLoom = true;
+		} else if (argv[i][0] == '-') {
+			outputHelp();
+			return -1;
+		} else if (goldenFile.empty()) {
+			goldenFile = argv[i];
+		} else {
+			inputs.push_back(std::make_pair(std::string(argv[i]), isLoom));
+		}
+	}
+
+	if (goldenFile.empty()) {
+		outputHelp();
+		return -1;
+	}
+
+	try {
+		HashMap golden;
+		loadGolden(goldenFile, golden);
+
+		std::vector<Resource> resources;
+		for (std::vector<std::pair<std::string, bool> >::const_iterator i = inputs.begin(); i != inputs.end(); ++i)
+			addResource(resources, i->first, i->second);
+
+		Checker checker(golden);
+		checkSequences(checker);
+		checkValidation(checker);
+		checkLoops(checker);
+		checkResources(checker, resources);
+
+		if (update) {
+			HashMap merged = golden;
+			for (HashMap::const_iterator i = checker.getComputed().begin(); i != checker.getComputed().end(); ++i)
+				merged[i->first] = i->second;
+			saveGolden(goldenFile, merged);
+			std::printf("Stored %u hashes in %s\n", static_cast<unsigned int>(merged.size()), goldenFile.c_str());
+		}
+
+		std::printf("%u failures, %u outputs without golden hash\n", checker.getFailures(), checker.getMissing());
+		return checker.getFailures() ? -1 : EXIT_SUCCESS;
+	} catch (const std::exception &e) {
+		std::fprintf(stderr, "ERROR: %s\n", e.what());
+		return -1;
+	}
+}
@@ -25,7 +25,6 @@
 	MAME uses much bigger envelope tables and this will be the biggest cause of it sounding different at times
 
 	//TODO Don't delay first operator 1 sample in opl3 mode
-	//TODO Maybe not use class method pointers but a regular function pointers with operator as first parameter
 	//TODO Fix panning for the Percussion channels, would any opl3 player use it and actually really change it though?
 	//TODO Check if having the same accuracy in all frequency multipliers sounds better or not
 
@@ -37,6 +36,7 @@
 #include "dbopl.h"
 
 #include <string.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <math.h>
 
@@ -69,13 +69,8 @@ namespace DBOPL {
 
 //Maximum amount of attenuation bits
 //Envelope goes to 511, 9 bits
-#if (DBOPL_WAVE == WAVE_TABLEMUL )
-//Uses the value directly
+//wmTableMul uses the value directly, the other wave modes shift it up by 3
 #define ENV_BITS	( 9 )
-#else
-//Add 3 bits here for more accuracy and would have to be shifted up either way
-#define ENV_BITS	( 9 )
-#endif
 //Limits of the envelope with those bits and when the envelope goes silent
 #define ENV_MIN		0
 #define ENV_EXTRA	( ENV_BITS - 9 )
@@ -95,15 +90,6 @@ namespace DBOPL {
 #endif
 
 
-//How much to substract from the base value for the final attenuation
-static const Bit8u KslCreateTable[16] = {
-	//0 will always be be lower than 7 * 8
-	64, 32, 24, 19,
-	16, 12, 11, 10,
-	 8,  6,  5,  4,
-	 3,  2,  1,  0,
-};
-
 #define M(_X_) ((Bit8u)( (_X_) * 2))
 static const Bit8u FreqCreateTable[16] = {
 	M(0.5), M(1 ), M(2 ), M(3 ), M(4 ), M(5 ), M(6 ), M(7 ),
@@ -126,16 +112,13 @@ static const Bit8u EnvelopeIncreaseTable[13] = {
 	32,
 };
 
-#if ( DBOPL_WAVE == WAVE_HANDLER ) || ( DBOPL_WAVE == WAVE_TABLELOG )
-static Bit16u ExpTable[ 256 ];
+//The lookup tables are generated by gentables.cpp, they are setup for
+//ENV_EXTRA being 0
+#if ENV_EXTRA != 0
+#error The generated tables do not match the envelope bits
 #endif
+#include "dbopl_tables.h"
 
-#if ( DBOPL_WAVE == WAVE_HANDLER )
-//PI table used by WAVEHANDLER
-static Bit16u SinTable[ 512 ];
-#endif
-
-#if ( DBOPL_WAVE > WAVE_HANDLER )
 //Layout of the waveform table in 512 entry intervals
 //With overlapping waves we reduce the table to half it's size
 
@@ -145,8 +128,7 @@ static Bit16u SinTable[ 512 ];
 
 //6 is just 0 shifted and masked
 
-static Bit16s WaveTable[ 8 * 512 ];
-//Distance into WaveTable the wave starts
+//Distance into the wave tables the wave starts
 static const Bit16u WaveBaseTable[8] = {
 	0x000, 0x200, 0x200, 0x800,
 	0xa00, 0xc00, 0x100, 0x400,
@@ -163,18 +145,33 @@ static const Bit16u WaveStartTable[8] = {
 	512, 0, 0, 0,
 	0, 512, 512, 256,
 };
-#endif
-
-#if ( DBOPL_WAVE == WAVE_TABLEMUL )
-static Bit16u MulTable[ 384 ];
-#endif
 
-static Bit8u KslTable[ 8 * 16 ];
-static Bit8u TremoloTable[ TREMOLO_TABLE ];
-//Start of a channel behind the chip struct start
-static Bit16u ChanOffsetTable[32];
-//Start of an operator behind the chip struct start
-static Bit16u OpOffsetTable[64];
+//No channel or operator behind a register
+#define REG_NONE 0xff
+//Channel of a register, only valid below the number of channels of a chip
+//Make sure the four op channels follow eachother
+static const Bit8u RegChanTable[32] = {
+	0, 2, 4, 1, 3, 5, 6, 7,
+	8, REG_NONE, REG_NONE, REG_NONE, REG_NONE, REG_NONE, REG_NONE, REG_NONE,
+	9, 11, 13, 10, 12, 14, 15, 16,
+	17, REG_NONE, REG_NONE, REG_NONE, REG_NONE, REG_NONE, REG_NONE, REG_NONE,
+};
+//Operator of a register as channel * 2 + operator, only valid below twice
+//the number of channels of a chip
+//Use 32 and up for the 2nd range to match the channel gap
+#define REG_OP( _CH_, _OP_ ) ( ( _CH_ ) * 2 + ( _OP_ ) )
+static const Bit8u RegOpTable[64] = {
+	REG_OP( 0, 0 ), REG_OP( 2, 0 ), REG_OP( 4, 0 ), REG_OP( 0, 1 ), REG_OP( 2, 1 ), REG_OP( 4, 1 ), REG_NONE, REG_NONE,
+	REG_OP( 1, 0 ), REG_OP( 3, 0 ), REG_OP( 5, 0 ), REG_OP( 1, 1 ), REG_OP( 3, 1 ), REG_OP( 5, 1 ), REG_NONE, REG_NONE,
+	REG_OP( 6, 0 ), REG_OP( 7, 0 ), REG_OP( 8, 0 ), REG_OP( 6, 1 ), REG_OP( 7, 1 ), REG_OP( 8, 1 ), REG_NONE, REG_NONE,
+	REG_NONE, REG_NONE, REG_NONE, REG_NONE, REG_NONE, REG_NONE, REG_NONE, REG_NONE,
+	REG_OP( 9, 0 ), REG_OP( 11, 0 ), REG_OP( 13, 0 ), REG_OP( 9, 1 ), REG_OP( 11, 1 ), REG_OP( 13, 1 ), REG_NONE, REG_NONE,
+	REG_OP( 10, 0 ), REG_OP( 12, 0 ), REG_OP( 14, 0 ), REG_OP( 10, 1 ), REG_OP( 12, 1 ), REG_OP( 14, 1 ), REG_NONE, REG_NONE,
+	REG_OP( 15, 0 ), REG_OP( 16, 0 ), REG_OP( 17, 0 ), REG_OP( 15, 1 ), REG_OP( 16, 1 ), REG_OP( 17, 1 ), REG_NONE, REG_NONE,
+	REG_NONE, REG_NONE, REG_NONE, REG_NONE, REG_NONE, REG_NONE, REG_NONE, REG_NONE,
+};
+#undef REG_OP
+#undef REG_NONE
 
 //The lower bits are the shift of the operator vibrato value
 //The highest bit is right shifted to generate -1 or 0 for negation
@@ -203,7 +200,6 @@ static void EnvelopeSelect( Bit8u val, Bit8u& index, Bit8u& shift ) {
 	}
 }
 
-#if ( DBOPL_WAVE == WAVE_HANDLER )
 /*
 	Generate the different waveforms out of the sine/exponetial table using handlers
 */
@@ -273,14 +269,12 @@ static const WaveHandler WaveHandlerTable[8] = {
 	WaveForm4, WaveForm5, WaveForm6, WaveForm7
 };
 
-#endif
-
 /*
 	Operator
 */
 
 //We zero out when rate == 0
-inline void Operator::UpdateAttack( const Chip* chip ) {
+inline void Operator::UpdateAttack( const ChipBase* chip ) {
 	Bit8u rate = reg60 >> 4;
 	if ( rate ) {
 		Bit8u val = (rate << 2) + ksr;
@@ -291,7 +285,7 @@ inline void Operator::UpdateAttack( const Chip* chip ) {
 		rateZero |= (1 << ATTACK);
 	}
 }
-inline void Operator::UpdateDecay( const Chip* chip ) {
+inline void Operator::UpdateDecay( const ChipBase* chip ) {
 	Bit8u rate = reg60 & 0xf;
 	if ( rate ) {
 		Bit8u val = (rate << 2) + ksr;
@@ -302,7 +296,7 @@ inline void Operator::UpdateDecay( const Chip* chip ) {
 		rateZero |= (1 << DECAY);
 	}
 }
-inline void Operator::UpdateRelease( const Chip* chip ) {
+inline void Operator::UpdateRelease( const ChipBase* chip ) {
 	Bit8u rate = reg80 & 0xf;
 	if ( rate ) {
 		Bit8u val = (rate << 2) + ksr;
@@ -352,7 +346,7 @@ void Operator::UpdateFrequency(  ) {
 	}
 }
 
-void Operator::UpdateRates( const Chip* chip ) {
+void Operator::UpdateRates( const ChipBase* chip ) {
 	//Mame seems to reverse this where enabling ksr actually lowers
 	//the rate, but pdf manuals says otherwise?
 	Bit8u newKsr = (Bit8u)((chanData >> SHIFT_KEYCODE) & 0xff);
@@ -425,16 +419,21 @@ Bits Operator::TemplateVolume(  ) {
 	return vol;
 }
 
-static const VolumeHandler VolumeHandlerTable[5] = {
-	&Operator::TemplateVolume< Operator::OFF >,
-	&Operator::TemplateVolume< Operator::RELEASE >,
-	&Operator::TemplateVolume< Operator::SUSTAIN >,
-	&Operator::TemplateVolume< Operator::DECAY >,
-	&Operator::TemplateVolume< Operator::ATTACK >
-};
-
 INLINE Bitu Operator::ForwardVolume() {
-	return currentLevel + (this->*volHandler)();
+	//The state rarely changes, so this predicts a lot better than calling
+	//through a handler and lets the compiler inline the envelope
+	switch ( state ) {
+	case OFF:
+		return currentLevel + TemplateVolume< OFF >();
+	case RELEASE:
+		return currentLevel + TemplateVolume< RELEASE >();
+	case SUSTAIN:
+		return currentLevel + TemplateVolume< SUSTAIN >();
+	case DECAY:
+		return currentLevel + TemplateVolume< DECAY >();
+	default:
+		return currentLevel + TemplateVolume< ATTACK >();
+	}
 }
 
 
@@ -443,7 +442,7 @@ INLINE Bitu Operator::ForwardWave() {
 	return waveIndex >> WAVE_SH;
 }
 
-void Operator::Write20( const Chip* chip, Bit8u val ) {
+void Operator::Write20( const ChipBase* chip, Bit8u val ) {
 	Bit8u change = (reg20 ^ val );
 	if ( !change )
 		return;
@@ -468,14 +467,14 @@ void Operator::Write20( const Chip* chip, Bit8u val ) {
 	}
 }
 
-void Operator::Write40( const Chip* /*chip*/, Bit8u val ) {
+void Operator::Write40( const ChipBase* /*chip*/, Bit8u val ) {
 	if (!(reg40 ^ val ))
 		return;
 	reg40 = val;
 	UpdateAttenuation( );
 }
 
-void Operator::Write60( const Chip* chip, Bit8u val ) {
+void Operator::Write60( const ChipBase* chip, Bit8u val ) {
 	Bit8u change = reg60 ^ val;
 	reg60 = val;
 	if ( change & 0x0f ) {
@@ -486,7 +485,7 @@ void Operator::Write60( const Chip* chip, Bit8u val ) {
 	}
 }
 
-void Operator::Write80( const Chip* chip, Bit8u val ) {
+void Operator::Write80( const ChipBase* chip, Bit8u val ) {
 	Bit8u change = (reg80 ^ val );
 	if ( !change )
 		return;
@@ -500,24 +499,25 @@ void Operator::Write80( const Chip* chip, Bit8u val ) {
 	}
 }
 
-void Operator::WriteE0( const Chip* chip, Bit8u val ) {
+void Operator::WriteE0( const ChipBase* chip, Bit8u val ) {
 	if ( !(regE0 ^ val) )
 		return;
 	//in opl3 mode you can always selet 7 waveforms regardless of waveformselect
 	Bit8u waveForm = val & ( ( 0x3 & chip->waveFormMask ) | (0x7 & chip->opl3Active ) );
 	regE0 = val;
-#if ( DBOPL_WAVE == WAVE_HANDLER )
+	SetWaveForm( chip->waveMode, waveForm );
+}
+
+void Operator::SetWaveForm( WaveMode mode, Bit8u waveForm ) {
 	waveHandler = WaveHandlerTable[ waveForm ];
-#else
-	waveBase = WaveTable + WaveBaseTable[ waveForm ];
-	waveStart = WaveStartTable[ waveForm ] << WAVE_SH;
+	waveBase = ( mode == wmTableLog ? LogWaveTable : MulWaveTable ) + WaveBaseTable[ waveForm ];
+	//The handlers start all waves at 0
+	waveStart = mode == wmHandler ? 0 : WaveStartTable[ waveForm ] << WAVE_SH;
 	waveMask = WaveMaskTable[ waveForm ];
-#endif
 }
 
 INLINE void Operator::SetState( Bit8u s ) {
 	state = s;
-	volHandler = VolumeHandlerTable[ s ];
 }
 
 INLINE bool Operator::Silent() const {
@@ -528,7 +528,25 @@ INLINE bool Operator::Silent() const {
 	return true;
 }
 
-INLINE void Operator::Prepare( const Chip* chip )  {
+INLINE bool Operator::Constant() const {
+	if ( !(rateZero & ( 1 << state ) ) )
+		return false;
+	//Without a rate the envelope can still switch state once it reaches its
+	//limit, which can change the rate
+	if ( state == DECAY )
+		return volume < sustainLevel;
+	if ( state == SUSTAIN && ( reg20 & MASK_SUSTAIN ) )
+		return true;
+	if ( state == SUSTAIN || state == RELEASE )
+		return volume < ENV_MAX;
+	return true;
+}
+
+INLINE bool Operator::Frozen() const {
+	return ENV_SILENT( totalLevel + volume ) && Constant();
+}
+
+INLINE void Operator::Prepare( const ChipBase* chip )  {
 	currentLevel = totalLevel + (chip->tremoloValue & tremoloMask);
 	waveCurrent = waveAdd;
 	if ( vibStrength >> chip->vibratoShift ) {
@@ -544,11 +562,7 @@ INLINE void Operator::Prepare( const Chip* chip )  {
 void Operator::KeyOn( Bit8u mask ) {
 	if ( !keyOn ) {
 		//Restart the frequency generator
-#if ( DBOPL_WAVE > WAVE_HANDLER )
 		waveIndex = waveStart;
-#else
-		waveIndex = 0;
-#endif
 		rateIndex = 0;
 		SetState( ATTACK );
 	}
@@ -564,23 +578,27 @@ void Operator::KeyOff( Bit8u mask ) {
 	}
 }
 
+template< WaveMode wave >
 INLINE Bits Operator::GetWave( Bitu index, Bitu vol ) {
-#if ( DBOPL_WAVE == WAVE_HANDLER )
-	return waveHandler( index, vol << ( 3 - ENV_EXTRA ) );
-#elif ( DBOPL_WAVE == WAVE_TABLEMUL )
+	switch ( wave ) {
+	case wmHandler:
+		return waveHandler( index, vol << ( 3 - ENV_EXTRA ) );
+	case wmTableLog: {
+		Bit32s sample = waveBase[ index & waveMask ];
+		//Only the volume is shifted, the table has the final precision
+		Bit32u total = ( sample & 0x7fff ) + ( vol << ( 3 - ENV_EXTRA ) );
+		Bit32s sig = ExpTable[ total & 0xff ];
+		Bit32u exp = total >> 8;
+		Bit32s neg = sample >> 16;
+		return ((sig ^ neg) - neg) >> exp;
+	}
+	case wmTableMul:
+		break;
+	}
 	return (waveBase[ index & waveMask ] * MulTable[ vol >> ENV_EXTRA ]) >> MUL_SH;
-#elif ( DBOPL_WAVE == WAVE_TABLELOG )
-	Bit32s wave = waveBase[ index & waveMask ];
-	Bit32u total = ( wave & 0x7fff ) + vol << ( 3 - ENV_EXTRA );
-	Bit32s sig = ExpTable[ total & 0xff ];
-	Bit32u exp = total >> 8;
-	Bit32s neg = wave >> 16;
-	return ((sig ^ neg) - neg) >> exp;
-#else
-#error "No valid wave routine"
-#endif
 }
 
+template< WaveMode wave >
 INLINE Bits Operator::GetSample( Bits modulation ) {
 	Bitu vol = ForwardVolume();
 	if ( ENV_SILENT( vol ) ) {
@@ -590,10 +608,28 @@ INLINE Bits Operator::GetSample( Bits modulation ) {
 	} else {
 		Bitu index = ForwardWave();
 		index += modulation;
-		return GetWave( index, vol );
+		return GetWave< wave >( index, vol );
 	}
 }
 
+INLINE Bitu Operator::HeldVolume() const {
+	//Same as ForwardVolume, which only returns the volume when constant
+	return currentLevel + ( state == OFF ? ENV_MAX : volume );
+}
+
+template< WaveMode wave >
+INLINE Bits Operator::GetHeldSample( Bits modulation, Bitu vol, Bits mul ) {
+	if ( ENV_SILENT( vol ) ) {
+		waveIndex += waveCurrent;
+		return 0;
+	}
+	Bitu index = ForwardWave();
+	index += modulation;
+	if ( wave == wmTableMul )
+		return (waveBase[ index & waveMask ] * mul) >> MUL_SH;
+	return GetWave< wave >( index, vol );
+}
+
 Operator::Operator() {
 	chanData = 0;
 	freqMul = 0;
@@ -629,10 +665,10 @@ Channel::Channel() {
 	maskRight = -1;
 	feedback = 31;
 	fourMask = 0;
-	synthHandler = &Channel::BlockTemplate< sm2FM >;
+	synthMode = sm2FM;
 }
 
-void Channel::SetChanData( const Chip* chip, Bit32u data ) {
+void Channel::SetChanData( const ChipBase* chip, Bit32u data ) {
 	Bit32u change = chanData ^ data;
 	chanData = data;
 	Op( 0 )->chanData = data;
@@ -650,7 +686,7 @@ void Channel::SetChanData( const Chip* chip, Bit32u data ) {
 	}
 }
 
-void Channel::UpdateFrequency( const Chip* chip, Bit8u fourOp ) {
+void Channel::UpdateFrequency( const ChipBase* chip, Bit8u fourOp ) {
 	//Extrace the frequency bits
 	Bit32u data = chanData & 0xffff;
 	Bit32u kslBase = KslTable[ data >> 6 ];
@@ -668,7 +704,7 @@ void Channel::UpdateFrequency( const Chip* chip, Bit8u fourOp ) {
 	}
 }
 
-void Channel::WriteA0( const Chip* chip, Bit8u val ) {
+void Channel::WriteA0( const ChipBase* chip, Bit8u val ) {
 	Bit8u fourOp = chip->reg104 & chip->opl3Active & fourMask;
 	//Don't handle writes to silent fourop channels
 	if ( fourOp > 0x80 )
@@ -680,7 +716,7 @@ void Channel::WriteA0( const Chip* chip, Bit8u val ) {
 	}
 }
 
-void Channel::WriteB0( const Chip* chip, Bit8u val ) {
+void Channel::WriteB0( const ChipBase* chip, Bit8u val ) {
 	Bit8u fourOp = chip->reg104 & chip->opl3Active & fourMask;
 	//Don't handle writes to silent fourop channels
 	if ( fourOp > 0x80 )
@@ -711,7 +747,7 @@ void Channel::WriteB0( const Chip* chip, Bit8u val ) {
 	}
 }
 
-void Channel::WriteC0( const Chip* chip, Bit8u val ) {
+void Channel::WriteC0( const ChipBase* chip, Bit8u val ) {
 	Bit8u change = val ^ regC0;
 	if ( !change )
 		return;
@@ -740,16 +776,16 @@ void Channel::WriteC0( const Chip* chip, Bit8u val ) {
 			Bit8u synth = ( (chan0->regC0 & 1) << 0 )| (( chan1->regC0 & 1) << 1 );
 			switch ( synth ) {
 			case 0:
-				chan0->synthHandler = &Channel::BlockTemplate< sm3FMFM >;
+				chan0->synthMode = sm3FMFM;
 				break;
 			case 1:
-				chan0->synthHandler = &Channel::BlockTemplate< sm3AMFM >;
+				chan0->synthMode = sm3AMFM;
 				break;
 			case 2:
-				chan0->synthHandler = &Channel::BlockTemplate< sm3FMAM >;
+				chan0->synthMode = sm3FMAM;
 				break;
 			case 3:
-				chan0->synthHandler = &Channel::BlockTemplate< sm3AMAM >;
+				chan0->synthMode = sm3AMAM;
 				break;
 			}
 		//Disable updating percussion channels
@@ -757,9 +793,9 @@ void Channel::WriteC0( const Chip* chip, Bit8u val ) {
 
 		//Regular dual op, am or fm
 		} else if ( val & 1 ) {
-			synthHandler = &Channel::BlockTemplate< sm3AM >;
+			synthMode = sm3AM;
 		} else {
-			synthHandler = &Channel::BlockTemplate< sm3FM >;
+			synthMode = sm3FM;
 		}
 		maskLeft = ( val & 0x10 ) ? -1 : 0;
 		maskRight = ( val & 0x20 ) ? -1 : 0;
@@ -770,27 +806,27 @@ void Channel::WriteC0( const Chip* chip, Bit8u val ) {
 
 		//Regular dual op, am or fm
 		} else if ( val & 1 ) {
-			synthHandler = &Channel::BlockTemplate< sm2AM >;
+			synthMode = sm2AM;
 		} else {
-			synthHandler = &Channel::BlockTemplate< sm2FM >;
+			synthMode = sm2FM;
 		}
 	}
 }
 
-void Channel::ResetC0( const Chip* chip ) {
+void Channel::ResetC0( const ChipBase* chip ) {
 	Bit8u val = regC0;
 	regC0 ^= 0xff;
 	WriteC0( chip, val );
 }
 
-template< bool opl3Mode>
-INLINE void Channel::GeneratePercussion( Chip* chip, Bit32s* output ) {
+template< WaveMode wave, bool opl3Mode >
+INLINE void Channel::GeneratePercussion( ChipBase* chip, Bit32s* output ) {
 	Channel* chan = this;
 
 	//BassDrum
 	Bit32s mod = (Bit32u)((old[0] + old[1])) >> feedback;
 	old[0] = old[1];
-	old[1] = Op(0)->GetSample( mod );
+	old[1] = Op(0)->GetSample< wave >( mod );
 
 	//When bassdrum is in AM mode first operator is ignoed
 	if ( chan->regC0 & 1 ) {
@@ -798,7 +834,7 @@ INLINE void Channel::GeneratePercussion( Chip* chip, Bit32s* output ) {
 	} else {
 		mod = old[0];
 	}
-	Bit32s sample = Op(1)->GetSample( mod );
+	Bit32s sample = Op(1)->GetSample< wave >( mod );
 
 
 	//Precalculate stuff used by other outputs
@@ -811,22 +847,22 @@ INLINE void Channel::GeneratePercussion( Chip* chip, Bit32s* output ) {
 	Bit32u hhVol = Op(2)->ForwardVolume();
 	if ( !ENV_SILENT( hhVol ) ) {
 		Bit32u hhIndex = (phaseBit<<8) | (0x34 << ( phaseBit ^ (noiseBit << 1 )));
-		sample += Op(2)->GetWave( hhIndex, hhVol );
+		sample += Op(2)->GetWave< wave >( hhIndex, hhVol );
 	}
 	//Snare Drum
 	Bit32u sdVol = Op(3)->ForwardVolume();
 	if ( !ENV_SILENT( sdVol ) ) {
 		Bit32u sdIndex = ( 0x100 + (c2 & 0x100) ) ^ ( noiseBit << 8 );
-		sample += Op(3)->GetWave( sdIndex, sdVol );
+		sample += Op(3)->GetWave< wave >( sdIndex, sdVol );
 	}
 	//Tom-tom
-	sample += Op(4)->GetSample( 0 );
+	sample += Op(4)->GetSample< wave >( 0 );
 
 	//Top-Cymbal
 	Bit32u tcVol = Op(5)->ForwardVolume();
 	if ( !ENV_SILENT( tcVol ) ) {
 		Bit32u tcIndex = (1 + phaseBit) << 8;
-		sample += Op(5)->GetWave( tcIndex, tcVol );
+		sample += Op(5)->GetWave< wave >( tcIndex, tcVol );
 	}
 	sample <<= 1;
 	if ( opl3Mode ) {
@@ -837,8 +873,52 @@ INLINE void Channel::GeneratePercussion( Chip* chip, Bit32s* output ) {
 	}
 }
 
-template<SynthMode mode>
-Channel* Channel::BlockTemplate( Chip* chip, Bit32u samples, Bit32s* output ) {
+void Channel::SkipPercussion( ChipBase* chip, Bit32u samples ) {
+	for ( Bitu o = 0; o < 6; o++ )
+		Op( o )->Prepare( chip );
+	//The snare drum only uses the phase of the hi-hat
+	Op(0)->waveIndex += Op(0)->waveCurrent * samples;
+	Op(1)->waveIndex += Op(1)->waveCurrent * samples;
+	Op(2)->waveIndex += Op(2)->waveCurrent * samples;
+	Op(4)->waveIndex += Op(4)->waveCurrent * samples;
+	Op(5)->waveIndex += Op(5)->waveCurrent * samples;
+	//The bass drum feedback shifts in silence
+	old[0] = samples > 1 ? 0 : old[1];
+	old[1] = 0;
+	chip->SkipNoise( samples );
+}
+
+template<SynthMode mode, WaveMode wave, bool held0, bool held1>
+void Channel::BlockHeld( Bit32u samples, Bit32s* output ) {
+	Bitu vol0 = Op(0)->HeldVolume();
+	Bitu vol1 = Op(1)->HeldVolume();
+	Bits mul0 = 0, mul1 = 0;
+	if ( wave == wmTableMul && held0 && !ENV_SILENT( vol0 ) )
+		mul0 = MulTable[ vol0 >> ENV_EXTRA ];
+	if ( wave == wmTableMul && held1 && !ENV_SILENT( vol1 ) )
+		mul1 = MulTable[ vol1 >> ENV_EXTRA ];
+	for ( Bitu i = 0; i < samples; i++ ) {
+		Bit32s mod = (Bit32u)((old[0] + old[1])) >> feedback;
+		old[0] = old[1];
+		old[1] = held0 ? Op(0)->GetHeldSample< wave >( mod, vol0, mul0 ) : Op(0)->GetSample< wave >( mod );
+		Bit32s out0 = old[0];
+		Bit32s sample;
+		if ( mode == sm2AM || mode == sm3AM ) {
+			sample = out0 + ( held1 ? Op(1)->GetHeldSample< wave >( 0, vol1, mul1 ) : Op(1)->GetSample< wave >( 0 ) );
+		} else {
+			sample = held1 ? Op(1)->GetHeldSample< wave >( out0, vol1, mul1 ) : Op(1)->GetSample< wave >( out0 );
+		}
+		if ( mode == sm2AM || mode == sm2FM ) {
+			output[ i ] += sample;
+		} else {
+			output[ i * 2 + 0 ] += sample & maskLeft;
+			output[ i * 2 + 1 ] += sample & maskRight;
+		}
+	}
+}
+
+template<SynthMode mode, WaveMode wave>
+Channel* Channel::BlockTemplate( ChipBase* chip, Bit32u samples, Bit32s* output ) {
 	switch( mode ) {
 	case sm2AM:
 	case sm3AM:
@@ -879,26 +959,22 @@ Channel* Channel::BlockTemplate( Chip* chip, Bit32u samples, Bit32s* output ) {
 		}
 		break;
 	case sm2Percussion:
-		// This case was not handled in the DOSBox code either
-		// thus we leave this blank.
-		// TODO: Consider checking this.
-		break;
 	case sm3Percussion:
-		// This case was not handled in the DOSBox code either
-		// thus we leave this blank.
-		// TODO: Consider checking this.
+		//The operators are forwarded even when silent, thus this is only
+		//possible as long as their envelopes don't change
+		if ( Op(0)->Frozen() && Op(1)->Frozen() && Op(2)->Frozen() &&
+			Op(3)->Frozen() && Op(4)->Frozen() && Op(5)->Frozen() ) {
+			SkipPercussion( chip, samples );
+			return (this + 3);
+		}
 		break;
 	case sm4Start:
-		// This case was not handled in the DOSBox code either
-		// thus we leave this blank.
-		// TODO: Consider checking this.
-		break;
 	case sm6Start:
-		// This case was not handled in the DOSBox code either
-		// thus we leave this blank.
-		// TODO: Consider checking this.
+		//Only mark the start of the 4 and 6 operator modes, these are
+		//never the synth mode of a channel
 		break;
 	}
+	chip->activeChannels++;
 	//Init the operators with the the current vibrato and tremolo values
 	Op( 0 )->Prepare( chip );
 	Op( 1 )->Prepare( chip );
@@ -910,44 +986,60 @@ Channel* Channel::BlockTemplate( Chip* chip, Bit32u samples, Bit32s* output ) {
 		Op( 4 )->Prepare( chip );
 		Op( 5 )->Prepare( chip );
 	}
+	//Held notes keep their volume for the whole block, so their envelope
+	//is taken out of the loop
+	if ( mode == sm2AM || mode == sm2FM || mode == sm3AM || mode == sm3FM ) {
+		const bool held0 = Op(0)->Constant();
+		const bool held1 = Op(1)->Constant();
+		if ( held0 && held1 ) {
+			BlockHeld< mode, wave, true, true >( samples, output );
+			return ( this + 1 );
+		} else if ( held0 ) {
+			BlockHeld< mode, wave, true, false >( samples, output );
+			return ( this + 1 );
+		} else if ( held1 ) {
+			BlockHeld< mode, wave, false, true >( samples, output );
+			return ( this + 1 );
+		}
+	}
 	for ( Bitu i = 0; i < samples; i++ ) {
 		//Early out for percussion handlers
 		if ( mode == sm2Percussion ) {
-			GeneratePercussion<false>( chip, output + i );
+			GeneratePercussion< wave, false >( chip, output + i );
 			continue;	//Prevent some unitialized value bitching
 		} else if ( mode == sm3Percussion ) {
-			GeneratePercussion<true>( chip, output + i * 2 );
+			GeneratePercussion< wave, true >( chip, output + i * 2 );
 			continue;	//Prevent some unitialized value bitching
 		}
 
 		//Do unsigned shift so we can shift out all bits but still stay in 10 bit range otherwise
 		Bit32s mod = (Bit32u)((old[0] + old[1])) >> feedback;
 		old[0] = old[1];
-		old[1] = Op(0)->GetSample( mod );
+		old[1] = Op(0)->GetSample< wave >( mod );
 		Bit32s sample;
 		Bit32s out0 = old[0];
 		if ( mode == sm2AM || mode == sm3AM ) {
-			sample = out0 + Op(1)->GetSample( 0 );
+			sample = out0 + Op(1)->GetSample< wave >( 0 );
 		} else if ( mode == sm2FM || mode == sm3FM ) {
-			sample = Op(1)->GetSample( out0 );
+			sample = Op(1)->GetSample< wave >( out0 );
 		} else if ( mode == sm3FMFM ) {
-			Bits next = Op(1)->GetSample( out0 );
-			next = Op(2)->GetSample( next );
-			sample = Op(3)->GetSample( next );
+			Bits next = Op(1)->GetSample< wave >( out0 );
+			next = Op(2)->GetSample< wave >( next );
+			sample = Op(3)->GetSample< wave >( next );
 		} else if ( mode == sm3AMFM ) {
 			sample = out0;
-			Bits next = Op(1)->GetSample( 0 );
-			next = Op(2)->GetSample( next );
-			sample += Op(3)->GetSample( next );
+			Bits next = Op(1)->GetSample< wave >( 0 );
+			next = Op(2)->GetSample< wave >( next );
+			sample += Op(3)->GetSample< wave >( next );
 		} else if ( mode == sm3FMAM ) {
-			sample = Op(1)->GetSample( out0 );
-			Bits next = Op(2)->GetSample( 0 );
-			sample += Op(3)->GetSample( next );
+			sample = Op(1)->GetSample< wave >( out0 );
+			Bits next = Op(2)->GetSample< wave >( 0 );
+			sample += Op(3)->GetSample< wave >( next );
 		} else if ( mode == sm3AMAM ) {
 			sample = out0;
-			Bits next = Op(1)->GetSample( 0 );
-			sample += Op(2)->GetSample( next );
-			sample += Op(3)->GetSample( 0 );
+			Bits next = Op(1)->GetSample< wave >( 0 );
+			sample += Op(2)->GetSample< wave >( next );
+			sample += Op(3)->GetSample< wave >( 0 );
 		}
 		switch( mode ) {
 		case sm2AM:
@@ -1013,31 +1105,123 @@ Channel* Channel::BlockTemplate( Chip* chip, Bit32u samples, Bit32s* output ) {
 	return 0;
 }
 
+template<WaveMode wave>
+Channel* Channel::BlockWave( ChipBase* chip, Bit32u samples, Bit32s* output ) {
+	switch ( synthMode ) {
+	case sm2AM:
+		return BlockTemplate< sm2AM, wave >( chip, samples, output );
+	case sm2FM:
+		return BlockTemplate< sm2FM, wave >( chip, samples, output );
+	case sm3AM:
+		return BlockTemplate< sm3AM, wave >( chip, samples, output );
+	case sm3FM:
+		return BlockTemplate< sm3FM, wave >( chip, samples, output );
+	case sm3FMFM:
+		return BlockTemplate< sm3FMFM, wave >( chip, samples, output );
+	case sm3AMFM:
+		return BlockTemplate< sm3AMFM, wave >( chip, samples, output );
+	case sm3FMAM:
+		return BlockTemplate< sm3FMAM, wave >( chip, samples, output );
+	case sm3AMAM:
+		return BlockTemplate< sm3AMAM, wave >( chip, samples, output );
+	case sm2Percussion:
+		return BlockTemplate< sm2Percussion, wave >( chip, samples, output );
+	case sm3Percussion:
+		return BlockTemplate< sm3Percussion, wave >( chip, samples, output );
+	case sm4Start:
+	case sm6Start:
+		break;
+	}
+	return 0;
+}
+
+Channel* Channel::Block( ChipBase* chip, Bit32u samples, Bit32s* output ) {
+	switch ( chip->waveMode ) {
+	case wmHandler:
+		return BlockWave< wmHandler >( chip, samples, output );
+	case wmTableLog:
+		return BlockWave< wmTableLog >( chip, samples, output );
+	case wmTableMul:
+		break;
+	}
+	return BlockWave< wmTableMul >( chip, samples, output );
+}
+
 /*
 	Chip
 */
 
-Chip::Chip() {
+ChipBase::ChipBase() {
 	reg08 = 0;
 	reg04 = 0;
 	regBD = 0;
 	reg104 = 0;
 	opl3Active = 0;
+	engine = engineScalar;
+	waveMode = wmTableMul;
+	trace = 0;
+	idleChannels = 0;
+	activeChannels = 0;
 }
 
-INLINE Bit32u Chip::ForwardNoise() {
+//Step the noise generator from mame, which xors 0x800302 into the value when
+//the lowest bit is set before shifting, by the amount of steps at once
+static INLINE Bit32u JumpNoise( Bit32u value, Bit32u steps ) {
+	const Bit32u* table = NoiseJumpTable;
+	for ( ; steps; steps >>= 1, table += 8 * 16 ) {
+		if ( !( steps & 1 ) )
+			continue;
+		Bit32u next = 0;
+		for ( Bitu i = 0; i < 8; i++ )
+			next ^= table[ i * 16 + ( ( value >> ( i * 4 ) ) & 0xf ) ];
+		value = next;
+	}
+	return value;
+}
+
+//Apply the results of a table for every nibble of the value
+static INLINE Bit32u ApplyNoise( const Bit32u* table, Bit32u value ) {
+	return table[ 0 * 16 + ( value & 0xf ) ] ^ table[ 1 * 16 + ( ( value >> 4 ) & 0xf ) ]
+		^ table[ 2 * 16 + ( ( value >> 8 ) & 0xf ) ] ^ table[ 3 * 16 + ( ( value >> 12 ) & 0xf ) ]
+		^ table[ 4 * 16 + ( ( value >> 16 ) & 0xf ) ] ^ table[ 5 * 16 + ( ( value >> 20 ) & 0xf ) ]
+		^ table[ 6 * 16 + ( ( value >> 24 ) & 0xf ) ] ^ table[ 7 * 16 + ( value >> 28 ) ];
+}
+
+INLINE Bit32u ChipBase::ForwardNoise() {
 	noiseCounter += noiseAdd;
-	Bitu count = noiseCounter >> LFO_SH;
+	Bit32u count = noiseCounter >> LFO_SH;
 	noiseCounter &= WAVE_MASK;
-	for ( ; count > 0; --count ) {
-		//Noise calculation from mame
-		noiseValue ^= ( 0x800302 ) & ( 0 - (noiseValue & 1 ) );
-		noiseValue >>= 1;
-	}
+	//The count of a sample is below 4096 at all usual rates, jumping by its
+	//three digits avoids the unpredictable branches on the bits of the count
+	if ( GCC_UNLIKELY( count >= 0x1000 ) ) {
+		noiseValue = JumpNoise( noiseValue, count );
+		return noiseValue;
+	}
+	Bit32u value = noiseValue;
+	value = ApplyNoise( NoiseCountTable + ( 0 * 16 + ( count & 0xf ) ) * 8 * 16, value );
+	value = ApplyNoise( NoiseCountTable + ( 1 * 16 + ( ( count >> 4 ) & 0xf ) ) * 8 * 16, value );
+	value = ApplyNoise( NoiseCountTable + ( 2 * 16 + ( count >> 8 ) ) * 8 * 16, value );
+	noiseValue = value;
 	return noiseValue;
 }
 
-INLINE Bit32u Chip::ForwardLFO( Bit32u samples ) {
+void ChipBase::SkipNoise( Bit32u samples ) {
+	//Only the total amount of steps matters
+	Bit32u steps = 0;
+	for ( ; samples > 0; --samples ) {
+		noiseCounter += noiseAdd;
+		Bit32u count = noiseCounter >> LFO_SH;
+		noiseCounter &= WAVE_MASK;
+		if ( steps > 0xffffffffu - count ) {
+			noiseValue = JumpNoise( noiseValue, steps );
+			steps = 0;
+		}
+		steps += count;
+	}
+	noiseValue = JumpNoise( noiseValue, steps );
+}
+
+INLINE Bit32u ChipBase::ForwardLFO( Bit32u samples ) {
 	//Current vibrato value, runs 4x slower than tremolo
 	vibratoSign = ( VibratoTable[ vibratoIndex >> 2] ) >> 7;
 	vibratoShift = ( VibratoTable[ vibratoIndex >> 2] & 7) + vibratoStrength;
@@ -1064,7 +1248,8 @@ INLINE Bit32u Chip::ForwardLFO( Bit32u samples ) {
 }
 
 
-void Chip::WriteBD( Bit8u val ) {
+template< Bitu CHANNELS >
+void ChipTemplate< CHANNELS >::WriteBD( Bit8u val ) {
 	Bit8u change = regBD ^ val;
 	if ( !change )
 		return;
@@ -1075,10 +1260,10 @@ void Chip::WriteBD( Bit8u val ) {
 	if ( val & 0x20 ) {
 		//Drum was just enabled, make sure channel 6 has the right synth
 		if ( change & 0x20 ) {
-			if ( opl3Active ) {
-				chan[6].synthHandler = &Channel::BlockTemplate< sm3Percussion >;
+			if ( CHANNELS > 9 && opl3Active ) {
+				chan[6].synthMode = sm3Percussion;
 			} else {
-				chan[6].synthHandler = &Channel::BlockTemplate< sm2Percussion >;
+				chan[6].synthMode = sm2Percussion;
 			}
 		}
 		//Bass Drum
@@ -1115,7 +1300,7 @@ void Chip::WriteBD( Bit8u val ) {
 		}
 	//Toggle keyoffs when we turn off the percussion
 	} else if ( change & 0x20 ) {
-		//Trigger a reset to setup the original synth handler
+		//Trigger a reset to setup the original synth mode
 		chan[6].ResetC0( this );
 		chan[6].op[0].KeyOff( 0x2 );
 		chan[6].op[1].KeyOff( 0x2 );
@@ -1128,38 +1313,40 @@ void Chip::WriteBD( Bit8u val ) {
 
 
 #define REGOP( _FUNC_ )															\
-	index = ( ( reg >> 3) & 0x20 ) | ( reg & 0x1f );								\
-	if ( OpOffsetTable[ index ] ) {													\
-		Operator* regOp = (Operator*)( ((char *)this ) + OpOffsetTable[ index ] );	\
+	index = RegOpTable[ ( ( reg >> 3) & 0x20 ) | ( reg & 0x1f ) ];					\
+	if ( index < CHANNELS * 2 ) {													\
+		Operator* regOp = &chan[ index >> 1 ].op[ index & 1 ];						\
 		regOp->_FUNC_( this, val );													\
 	}
 
 #define REGCHAN( _FUNC_ )																\
-	index = ( ( reg >> 4) & 0x10 ) | ( reg & 0xf );										\
-	if ( ChanOffsetTable[ index ] ) {													\
-		Channel* regChan = (Channel*)( ((char *)this ) + ChanOffsetTable[ index ] );	\
+	index = RegChanTable[ ( ( reg >> 4) & 0x10 ) | ( reg & 0xf ) ];						\
+	if ( index < CHANNELS ) {															\
+		Channel* regChan = &chan[ index ];												\
 		regChan->_FUNC_( this, val );													\
 	}
 
-void Chip::WriteReg( Bit32u reg, Bit8u val ) {
+template< Bitu CHANNELS >
+void ChipTemplate< CHANNELS >::WriteReg( Bit32u reg, Bit8u val ) {
 	Bitu index;
+	idleChannels = 0;
 	switch ( (reg & 0xf0) >> 4 ) {
 	case 0x00 >> 4:
 		if ( reg == 0x01 ) {
 			waveFormMask = ( val & 0x20 ) ? 0x7 : 0x0;
-		} else if ( reg == 0x104 ) {
+		} else if ( CHANNELS > 9 && reg == 0x104 ) {
 			//Only detect changes in lowest 6 bits
 			if ( !((reg104 ^ val) & 0x3f) )
 				return;
 			//Always keep the highest bit enabled, for checking > 0x80
 			reg104 = 0x80 | ( val & 0x3f );
-		} else if ( reg == 0x105 ) {
+		} else if ( CHANNELS > 9 && reg == 0x105 ) {
 			//MAME says the real opl3 doesn't reset anything on opl3 disable/enable till the next write in another register
 			if ( !((opl3Active ^ val) & 1 ) )
 				return;
 			opl3Active = ( val & 1 ) ? 0xff : 0;
 			//Update the 0xc0 register for all channels to signal the switch to mono/stereo handlers
-			for ( int i = 0; i < 18;i++ ) {
+			for ( Bitu i = 0; i < CHANNELS;i++ ) {
 				chan[i].ResetC0( this );
 			}
 		} else if ( reg == 0x08 ) {
@@ -1205,7 +1392,7 @@ void Chip::WriteReg( Bit32u reg, Bit8u val ) {
 }
 
 
-Bit32u Chip::WriteAddr( Bit32u port, Bit8u val ) {
+Bit32u ChipBase::WriteAddr( Bit32u port, Bit8u val ) {
 	switch ( port & 3 ) {
 	case 0:
 		return val;
@@ -1218,41 +1405,660 @@ Bit32u Chip::WriteAddr( Bit32u port, Bit8u val ) {
 	return 0;
 }
 
-void Chip::GenerateBlock2( Bitu total, Bit32s* output ) {
+template< Bitu CHANNELS >
+void ChipTemplate< CHANNELS >::GenerateIdle( Bitu total, Bit32s* output, Bitu outputs ) {
+	if ( trace )
+		trace->BeginSpan( "GenerateIdle", "samples", total );
+	memset(output, 0, sizeof(Bit32s) * total * outputs);
 	while ( total > 0 ) {
 		Bit32u samples = ForwardLFO( total );
+		//Silent percussion still forwards its phases
+		if ( regBD & 0x20 )
+			chan[6].SkipPercussion( this, samples );
+		total -= samples;
+	}
+	if ( trace )
+		trace->EndSpan();
+}
+
+template< Bitu CHANNELS >
+void ChipTemplate< CHANNELS >::GenerateBlock2( Bitu total, Bit32s* output ) {
+	if ( idleChannels >= 9 ) {
+		GenerateIdle( total, output, 1 );
+		return;
+	}
+	//A block without output only happens with all channels silent, which
+	//they stay until the next write
+	activeChannels = 0;
+	//The lanes only support the multiplication tables
+	if ( engine == engineSoA && waveMode == wmTableMul ) {
+		GenerateBlock2SoA( total, output );
+		idleChannels = activeChannels ? 0 : 9;
+		return;
+	}
+	while ( total > 0 ) {
+		Bit32u samples = ForwardLFO( total );
+		if ( trace )
+			trace->BeginSpan( "ForwardLFO segment", "samples", samples );
 		memset(output, 0, sizeof(Bit32s) * samples);
 		int count = 0;
 		for( Channel* ch = chan; ch < chan + 9; ) {
 			count++;
-			ch = (ch->*(ch->synthHandler))( this, samples, output );
+			if ( trace )
+				ch = TraceChannel( ch, samples, output );
+			else
+				ch = ch->Block( this, samples, output );
 		}
+		if ( trace )
+			trace->EndSpan();
 		total -= samples;
 		output += samples;
 	}
+	idleChannels = activeChannels ? 0 : 9;
 }
 
-void Chip::GenerateBlock3( Bitu total, Bit32s* output  ) {
+template< Bitu CHANNELS >
+void ChipTemplate< CHANNELS >::GenerateBlock3( Bitu total, Bit32s* output  ) {
+	if ( idleChannels >= CHANNELS ) {
+		GenerateIdle( total, output, 2 );
+		return;
+	}
+	activeChannels = 0;
 	while ( total > 0 ) {
 		Bit32u samples = ForwardLFO( total );
+		if ( trace )
+			trace->BeginSpan( "ForwardLFO segment", "samples", samples );
 		memset(output, 0, sizeof(Bit32s) * samples * 2);
 		int count = 0;
-		for( Channel* ch = chan; ch < chan + 18; ) {
+		for( Channel* ch = chan; ch < chan + CHANNELS; ) {
 			count++;
-			ch = (ch->*(ch->synthHandler))( this, samples, output );
+			if ( trace )
+				ch = TraceChannel( ch, samples, output );
+			else
+				ch = ch->Block( this, samples, output );
 		}
+		if ( trace )
+			trace->EndSpan();
 		total -= samples;
 		output += samples * 2;
 	}
+	idleChannels = activeChannels ? 0 : CHANNELS;
+}
+
+/*
+	Structure of arrays engine
+
+	All regular 2 op channels are rendered in lockstep. For every block between
+	LFO changes the state of their operators is copied into arrays with one lane
+	per channel, so every step of a sample can be done for all channels at once.
+	A single chip spreads its channels over one group of lanes. With ChipLanes
+	several chips each get their own lane in every group instead, which keeps
+	all groups busy.
+	Envelopes, phase, feedback and table lookups run across all lanes, with AVX2
+	when available. The AVX2 code generates a whole block for one group at a
+	time, so the state of its lanes stays in registers between samples. Only
+	the rare envelope state changes are done lane by lane.
+	Percussion is left to its regular BlockTemplate. Since channels don't
+	depend on each other the output is identical to the scalar engine.
+	Only wmTableMul is supported, chips with another wave mode are always
+	generated by the scalar engine.
+*/
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define DBOPL_SOA_AVX2
+#include <immintrin.h>
+#endif
+
+struct LaneBlock {
+	enum {
+		//Lanes are processed in groups of this size by the vector code, it is
+		//also the maximum number of chips rendered side by side
+		GROUP = 8,
+		LANES = 9 * GROUP,
+		//A group costs about as much as this many channels rendered one by
+		//one, a single chip with less sounding channels doesn't use lanes
+		MIN_CHANNELS = 5
+	};
+
+	struct Ops {
+		Bit32u waveIndex[ LANES ];
+		Bit32u waveCurrent[ LANES ];
+		//Offset of the wave into MulWaveTable
+		Bit32u waveBase[ LANES ];
+		Bit32u waveMask[ LANES ];
+		Bit32s currentLevel[ LANES ];
+		Bit32s volume[ LANES ];
+		Bit32u rateIndex[ LANES ];
+		Bit32u attackAdd[ LANES ];
+		Bit32u decayAdd[ LANES ];
+		Bit32u releaseAdd[ LANES ];
+		Bit32s sustainLevel[ LANES ];
+		Bit32s state[ LANES ];
+		//Set when the volume is held in the sustain state
+		Bit8u hold[ LANES ];
+		//Derived from the state by SetState
+		//Rate added every sample, 0 when the volume doesn't change
+		Bit32u rateAdd[ LANES ];
+		//The state ends once the volume reaches this
+		Bit32s limit[ LANES ];
+		//-1 in the attack state, 0 otherwise
+		Bit32s attack[ LANES ];
+		//-1 in the off state, 0 otherwise
+		Bit32s off[ LANES ];
+		//Volume including the total level for the current sample
+		Bit32s vol[ LANES ];
+
+		void SetState( Bitu l, Bit8u s );
+		void Settle( Bitu l );
+	};
+
+	//Lanes below this are in use, unused ones have no channel
+	Bitu count;
+	Channel* chan[ LANES ];
+	//Either one output for all lanes or one per lane of a group, which may
+	//be 0 for unused lanes
+	Bitu outputs;
+	Bit32s* output[ GROUP ];
+
+	Bit32s old0[ LANES ];
+	Bit32s old1[ LANES ];
+	Bit32u feedback[ LANES ];
+	//-1 for channels in AM mode, 0 for FM
+	Bit32s amMask[ LANES ];
+	Bit32s sample[ LANES ];
+	Ops op[2];
+
+	LaneBlock() : count( 0 ), outputs( 0 ) {
+		memset( chan, 0, sizeof( chan ) );
+	}
+
+	void Add( const ChipBase* chip, Channel* ch, bool am, Bitu l );
+	void Finish();
+	void Store();
+};
+
+void LaneBlock::Ops::SetState( Bitu l, Bit8u s ) {
+	state[l] = s;
+	attack[l] = 0;
+	off[l] = 0;
+	limit[l] = 0x7fffffff;
+	rateAdd[l] = 0;
+	switch ( s ) {
+	case Operator::OFF:
+		off[l] = -1;
+		break;
+	case Operator::ATTACK:
+		attack[l] = -1;
+		rateAdd[l] = attackAdd[l];
+		break;
+	case Operator::DECAY:
+		rateAdd[l] = decayAdd[l];
+		limit[l] = sustainLevel[l];
+		break;
+	case Operator::SUSTAIN:
+		if ( hold[l] )
+			break;
+		// fall through
+	case Operator::RELEASE:
+		rateAdd[l] = releaseAdd[l];
+		limit[l] = ENV_MAX;
+		break;
+	}
+}
+
+//The volume went past the end of the current state, same as the transitions
+//in Operator::TemplateVolume
+void LaneBlock::Ops::Settle( Bitu l ) {
+	switch ( state[l] ) {
+	case Operator::ATTACK:
+		volume[l] = ENV_MIN;
+		rateIndex[l] = 0;
+		SetState( l, Operator::DECAY );
+		break;
+	case Operator::DECAY:
+		if ( volume[l] >= ENV_MAX ) {
+			volume[l] = ENV_MAX;
+			SetState( l, Operator::OFF );
+		} else {
+			rateIndex[l] = 0;
+			SetState( l, Operator::SUSTAIN );
+		}
+		break;
+	default:
+		volume[l] = ENV_MAX;
+		SetState( l, Operator::OFF );
+		break;
+	}
+}
+
+void LaneBlock::Add( const ChipBase* chip, Channel* ch, bool am, Bitu l ) {
+	if ( count <= l )
+		count = l + 1;
+	chan[l] = ch;
+	old0[l] = ch->old[0];
+	old1[l] = ch->old[1];
+	feedback[l] = ch->feedback;
+	//Follow the synth mode, regC0 of channels 7 and 8 can be stale after percussion mode
+	amMask[l] = am ? -1 : 0;
+	for ( Bitu o = 0; o < 2; o++ ) {
+		Operator* src = ch->Op( o );
+		Ops& dst = op[o];
+		src->Prepare( chip );
+		dst.waveIndex[l] = src->waveIndex;
+		dst.waveCurrent[l] = src->waveCurrent;
+		dst.waveBase[l] = (Bit32u)( src->waveBase - MulWaveTable );
+		dst.waveMask[l] = src->waveMask;
+		dst.currentLevel[l] = src->currentLevel;
+		dst.volume[l] = src->volume;
+		dst.rateIndex[l] = src->rateIndex;
+		dst.attackAdd[l] = src->attackAdd;
+		dst.decayAdd[l] = src->decayAdd;
+		dst.releaseAdd[l] = src->releaseAdd;
+		dst.sustainLevel[l] = src->sustainLevel;
+		dst.hold[l] = ( src->reg20 & Operator::MASK_SUSTAIN ) ? 1 : 0;
+		dst.SetState( l, src->state );
+	}
+}
+
+void LaneBlock::Finish() {
+	//Fill up the unused lanes with silent ones so the vector code can run on them
+	count = ( count + GROUP - 1 ) & ~( GROUP - 1 );
+	for ( Bitu l = 0; l < count; l++ ) {
+		if ( chan[l] )
+			continue;
+		old0[l] = old1[l] = 0;
+		feedback[l] = 31;
+		amMask[l] = 0;
+		for ( Bitu o = 0; o < 2; o++ ) {
+			Ops& dst = op[o];
+			dst.waveIndex[l] = 0;
+			dst.waveCurrent[l] = 0;
+			dst.waveBase[l] = 0;
+			dst.waveMask[l] = 0;
+			dst.currentLevel[l] = 0;
+			dst.volume[l] = ENV_MAX;
+			dst.rateIndex[l] = 0;
+			dst.SetState( l, Operator::OFF );
+		}
+	}
+}
+
+void LaneBlock::Store() {
+	for ( Bitu l = 0; l < count; l++ ) {
+		Channel* ch = chan[l];
+		if ( !ch )
+			continue;
+		chan[l] = 0;
+		ch->old[0] = old0[l];
+		ch->old[1] = old1[l];
+		for ( Bitu o = 0; o < 2; o++ ) {
+			Operator* dst = ch->Op( o );
+			dst->waveIndex = op[o].waveIndex[l];
+			dst->volume = op[o].volume[l];
+			dst->rateIndex = op[o].rateIndex[l];
+			if ( dst->state != op[o].state[l] )
+				dst->SetState( op[o].state[l] );
+		}
+	}
+	count = 0;
+}
+
+//Forward the envelope of a lane, gives the same volume as Operator::TemplateVolume
+static INLINE void LaneEnvelope( LaneBlock::Ops& o, Bitu l ) {
+	Bit32u rateIndex = o.rateIndex[l] + o.rateAdd[l];
+	Bit32s change = rateIndex >> RATE_SH;
+	o.rateIndex[l] = rateIndex & RATE_MASK;
+	Bit32s vol = o.volume[l];
+	if ( o.attack[l] ) {
+		vol += ( (~vol) * change ) >> 3;
+	} else {
+		vol += change;
+	}
+	o.volume[l] = vol;
+	if ( GCC_UNLIKELY( vol >= o.limit[l] || ( o.attack[l] && vol < ENV_MIN ) ) )
+		o.Settle( l );
+	o.vol[l] = o.currentLevel[l] + ( o.off[l] ? ENV_MAX : o.volume[l] );
+}
+
+//Same as Operator::GetSample with an already forwarded volume
+static INLINE Bit32s LaneWave( LaneBlock::Ops& o, Bitu l, Bit32s modulation ) {
+	o.waveIndex[l] += o.waveCurrent[l];
+	Bitu vol = o.vol[l];
+	if ( ENV_SILENT( vol ) )
+		return 0;
+	Bitu index = ( o.waveIndex[l] >> WAVE_SH ) + modulation;
+	return ( MulWaveTable[ o.waveBase[l] + ( index & o.waveMask[l] ) ] * MulTable[ vol ] ) >> MUL_SH;
+}
+
+//Add the sums of the lanes of a group to the outputs
+static INLINE void LaneOutput( LaneBlock& b, Bitu i, const Bit32s* sum ) {
+	if ( b.outputs == 1 ) {
+		Bit32s total = 0;
+		for ( Bitu j = 0; j < LaneBlock::GROUP; j++ )
+			total += sum[j];
+		b.output[0][i] += total;
+	} else {
+		for ( Bitu j = 0; j < b.outputs; j++ ) {
+			if ( b.output[j] )
+				b.output[j][i] += sum[j];
+		}
+	}
+}
+
+static void GenerateLanes( LaneBlock& b, Bitu samples ) {
+	for ( Bitu i = 0; i < samples; i++ ) {
+		Bit32s sum[ LaneBlock::GROUP ] = { 0 };
+		for ( Bitu l = 0; l < b.count; l++ ) {
+			LaneEnvelope( b.op[0], l );
+			LaneEnvelope( b.op[1], l );
+			Bit32s mod = (Bit32u)( b.old0[l] + b.old1[l] ) >> b.feedback[l];
+			b.old0[l] = b.old1[l];
+			b.old1[l] = LaneWave( b.op[0], l, mod );
+			Bit32s out0 = b.old0[l];
+			sum[ l % LaneBlock::GROUP ] += LaneWave( b.op[1], l, out0 & ~b.amMask[l] ) + ( out0 & b.amMask[l] );
+		}
+		LaneOutput( b, i, sum );
+	}
+}
+
+#ifdef DBOPL_SOA_AVX2
+#define DBOPL_AVX2 __attribute__(( target( "avx2" ) ))
+
+static INLINE DBOPL_AVX2 __m256i Load( const void* src ) {
+	return _mm256_loadu_si256( (const __m256i*)src );
+}
+
+static INLINE DBOPL_AVX2 void Store( void* dst, __m256i val ) {
+	_mm256_storeu_si256( (__m256i*)dst, val );
+}
+
+//Gather the aligned pairs of 16 bit entries the indices are in, this way
+//we never read outside of the tables
+static INLINE DBOPL_AVX2 __m256i GatherPairs( const void* table, __m256i index ) {
+	__m256i pair = _mm256_i32gather_epi32( (const int*)table, _mm256_srli_epi32( index, 1 ), 4 );
+	__m256i shift = _mm256_slli_epi32( _mm256_and_si256( index, _mm256_set1_epi32( 1 ) ), 4 );
+	return _mm256_srlv_epi32( pair, shift );
+}
+
+//The state of the operators of a group of lanes, kept in registers while
+//the samples of a block are generated
+struct VectorOp {
+	LaneBlock::Ops& o;
+	Bitu l;
+	__m256i waveIndex, waveCurrent, waveBase, waveMask, currentLevel;
+	__m256i volume, rateIndex, rateAdd, limit, attack, off;
+
+	INLINE DBOPL_AVX2 VectorOp( LaneBlock::Ops& ops, Bitu lane ) : o( ops ), l( lane ) {
+		waveIndex = Load( o.waveIndex + l );
+		waveCurrent = Load( o.waveCurrent + l );
+		waveBase = Load( o.waveBase + l );
+		waveMask = Load( o.waveMask + l );
+		currentLevel = Load( o.currentLevel + l );
+		LoadEnvelope();
+	}
+
+	INLINE DBOPL_AVX2 void LoadEnvelope() {
+		volume = Load( o.volume + l );
+		rateIndex = Load( o.rateIndex + l );
+		rateAdd = Load( o.rateAdd + l );
+		limit = _mm256_sub_epi32( Load( o.limit + l ), _mm256_set1_epi32( 1 ) );
+		attack = Load( o.attack + l );
+		off = Load( o.off + l );
+	}
+
+	INLINE DBOPL_AVX2 void Save() {
+		Store( o.waveIndex + l, waveIndex );
+		Store( o.volume + l, volume );
+		Store( o.rateIndex + l, rateIndex );
+	}
+
+	//Forward the envelopes and return the volume including the total level
+	INLINE DBOPL_AVX2 __m256i Envelope() {
+		rateIndex = _mm256_add_epi32( rateIndex, rateAdd );
+		__m256i change = _mm256_srli_epi32( rateIndex, RATE_SH );
+		rateIndex = _mm256_and_si256( rateIndex, _mm256_set1_epi32( RATE_MASK ) );
+		__m256i attackVol = _mm256_srai_epi32( _mm256_mullo_epi32( _mm256_xor_si256( volume, _mm256_set1_epi32( -1 ) ), change ), 3 );
+		volume = _mm256_add_epi32( volume, _mm256_blendv_epi8( change, attackVol, attack ) );
+		__m256i settle = _mm256_or_si256( _mm256_cmpgt_epi32( volume, limit ),
+			_mm256_and_si256( attack, _mm256_cmpgt_epi32( _mm256_set1_epi32( ENV_MIN ), volume ) ) );
+		int mask = _mm256_movemask_ps( _mm256_castsi256_ps( settle ) );
+		if ( GCC_UNLIKELY( mask ) ) {
+			Save();
+			for ( Bitu i = 0; i < LaneBlock::GROUP; i++ ) {
+				if ( mask & ( 1 << i ) )
+					o.Settle( l + i );
+			}
+			LoadEnvelope();
+		}
+		return _mm256_add_epi32( _mm256_blendv_epi8( volume, _mm256_set1_epi32( ENV_MAX ), off ), currentLevel );
+	}
+
+	INLINE DBOPL_AVX2 __m256i Wave( __m256i vol, __m256i modulation ) {
+		waveIndex = _mm256_add_epi32( waveIndex, waveCurrent );
+		__m256i index = _mm256_add_epi32( _mm256_srli_epi32( waveIndex, WAVE_SH ), modulation );
+		index = _mm256_add_epi32( _mm256_and_si256( index, waveMask ), waveBase );
+		//Sign extend the wave entries
+		__m256i wave = GatherPairs( MulWaveTable, index );
+		wave = _mm256_srai_epi32( _mm256_slli_epi32( wave, 16 ), 16 );
+
+		__m256i silentLimit = _mm256_set1_epi32( ENV_LIMIT - 1 );
+		__m256i silent = _mm256_cmpgt_epi32( vol, silentLimit );
+		__m256i mul = GatherPairs( MulTable, _mm256_min_epi32( vol, silentLimit ) );
+		mul = _mm256_and_si256( mul, _mm256_set1_epi32( 0xffff ) );
+
+		__m256i result = _mm256_srai_epi32( _mm256_mullo_epi32( wave, mul ), MUL_SH );
+		return _mm256_andnot_si256( silent, result );
+	}
+};
+
+static DBOPL_AVX2 void GenerateLanesAVX2( LaneBlock& b, Bitu samples ) {
+	for ( Bitu l = 0; l < b.count; l += LaneBlock::GROUP ) {
+		VectorOp op0( b.op[0], l );
+		VectorOp op1( b.op[1], l );
+		__m256i old0 = Load( b.old0 + l );
+		__m256i old1 = Load( b.old1 + l );
+		const __m256i feedback = Load( b.feedback + l );
+		const __m256i am = Load( b.amMask + l );
+		for ( Bitu i = 0; i < samples; i++ ) {
+			__m256i vol0 = op0.Envelope();
+			__m256i vol1 = op1.Envelope();
+			__m256i mod = _mm256_srlv_epi32( _mm256_add_epi32( old0, old1 ), feedback );
+			old0 = old1;
+			old1 = op0.Wave( vol0, mod );
+			//old0 is now the previous output of the first operator
+			__m256i sum = op1.Wave( vol1, _mm256_andnot_si256( am, old0 ) );
+			sum = _mm256_add_epi32( sum, _mm256_and_si256( old0, am ) );
+			if ( b.outputs == 1 ) {
+				//Silent lanes add 0, so all lanes can be summed up
+				__m128i half = _mm_add_epi32( _mm256_castsi256_si128( sum ), _mm256_extracti128_si256( sum, 1 ) );
+				half = _mm_add_epi32( half, _mm_shuffle_epi32( half, 0x4e ) );
+				half = _mm_add_epi32( half, _mm_shuffle_epi32( half, 0xb1 ) );
+				b.output[0][i] += _mm_cvtsi128_si32( half );
+			} else {
+				Bit32s lanes[ LaneBlock::GROUP ];
+				Store( lanes, sum );
+				LaneOutput( b, i, lanes );
+			}
+		}
+		op0.Save();
+		op1.Save();
+		Store( b.old0 + l, old0 );
+		Store( b.old1 + l, old1 );
+	}
+}
+
+#undef DBOPL_AVX2
+#endif
+
+static void GenerateLaneBlock( LaneBlock& b, Bitu samples ) {
+	b.Finish();
+#ifdef DBOPL_SOA_AVX2
+	static const bool hasAVX2 = __builtin_cpu_supports( "avx2" );
+	if ( hasAVX2 && !getenv("NOAVX") ) {
+		GenerateLanesAVX2( b, samples );
+		return;
+	}
+#endif
+	GenerateLanes( b, samples );
+}
+
+//Render the channels of a chip which can't use lanes for a whole segment and
+//return a mask of the ones which go into lanes, at most count of them
+static Bit16u LaneChannels( ChipBase* chip, Channel* chan, Bit32u samples, Bit32s* output, Bitu count, Bit16u& am ) {
+	Bit16u laned = 0;
+	am = 0;
+	memset(output, 0, sizeof(Bit32s) * samples);
+	for( Channel* ch = chan; ch < chan + 9; ) {
+		const Bitu index = ch - chan;
+		if ( !count ) {
+			ch = ch->Block( chip, samples, output );
+		} else if ( ch->synthMode == sm2AM ) {
+			if ( ch->Op(0)->Silent() && ch->Op(1)->Silent() ) {
+				ch->old[0] = ch->old[1] = 0;
+			} else {
+				laned |= 1 << index;
+				am |= 1 << index;
+				count--;
+				chip->activeChannels++;
+			}
+			ch++;
+		} else if ( ch->synthMode == sm2FM ) {
+			if ( ch->Op(1)->Silent() ) {
+				ch->old[0] = ch->old[1] = 0;
+			} else {
+				laned |= 1 << index;
+				count--;
+				chip->activeChannels++;
+			}
+			ch++;
+		} else {
+			ch = ch->Block( chip, samples, output );
+		}
+	}
+	return laned;
+}
+
+//Count the channels LaneChannels would put into lanes
+static Bitu LaneCount( Channel* chan ) {
+	Bitu count = 0;
+	for ( Channel* ch = chan; ch < chan + 9; ch++ ) {
+		if ( ch->synthMode == sm2AM )
+			count += !( ch->Op(0)->Silent() && ch->Op(1)->Silent() );
+		else if ( ch->synthMode == sm2FM )
+			count += !ch->Op(1)->Silent();
+	}
+	return count;
+}
+
+//Add the channels of a chip to the lanes, starting with a lane and
+//stepping over stride lanes for every channel
+static void LaneAdd( LaneBlock& block, const ChipBase* chip, Channel* chan, Bit16u laned, Bit16u am, Bitu lane, Bitu stride ) {
+	for ( Bitu c = 0; c < 9; c++ ) {
+		if ( !( laned & ( 1 << c ) ) )
+			continue;
+		block.Add( chip, chan + c, ( am >> c ) & 1, lane );
+		lane += stride;
+	}
+}
+
+template< Bitu CHANNELS >
+void ChipTemplate< CHANNELS >::GenerateBlock2SoA( Bitu total, Bit32s* output ) {
+	if ( waveMode != wmTableMul ) {
+		GenerateBlock2( total, output );
+		return;
+	}
+	LaneBlock block;
+	block.outputs = 1;
+	//A single chip spreads its channels over one group, with too few
+	//channels for that all of them are rendered one by one. Channels rarely
+	//fall silent within a block, so this is decided once for all of it.
+	const Bitu count = LaneCount( chan ) >= LaneBlock::MIN_CHANNELS ? LaneBlock::GROUP : 0;
+	while ( total > 0 ) {
+		Bit32u samples = ForwardLFO( total );
+		if ( trace )
+			trace->BeginSpan( "ForwardLFO segment", "samples", samples );
+		Bit16u am;
+		Bit16u laned = LaneChannels( this, chan, samples, output, count, am );
+		if ( laned ) {
+			LaneAdd( block, this, chan, laned, am, 0, 1 );
+			block.output[0] = output;
+			if ( trace )
+				trace->BeginSpan( "GenerateLaneBlock", "channels", block.count );
+			GenerateLaneBlock( block, samples );
+			block.Store();
+			if ( trace )
+				trace->EndSpan();
+		}
+		if ( trace )
+			trace->EndSpan();
+		total -= samples;
+		output += samples;
+	}
+}
+
+ChipLanes::ChipLanes() {
+	memset( lane, 0, sizeof( lane ) );
+}
+
+template< Bitu CHANNELS >
+void ChipLanes::Begin( Bitu slot, ChipTemplate< CHANNELS >* chip, Bitu samples, Bit32s* output ) {
+	Slot& s = lane[slot];
+	s.chip = chip;
+	s.chan = chip->chan;
+	s.output = output;
+	s.left = samples;
+	s.segment = 0;
+	//Only the multiplication tables are supported, the whole block of other
+	//wave modes is generated right away
+	s.direct = chip->waveMode != wmTableMul;
+	if ( s.direct )
+		chip->GenerateBlock2( samples, output );
+}
+
+void ChipLanes::Generate( Bitu total ) {
+	LaneBlock block;
+	block.outputs = MAX_CHIPS;
+	while ( total > 0 ) {
+		//Start the next LFO segment of the chips which reached one
+		Bitu samples = total;
+		for ( Bitu c = 0; c < MAX_CHIPS; c++ ) {
+			Slot& s = lane[c];
+			block.output[c] = 0;
+			if ( !s.left || s.direct )
+				continue;
+			if ( !s.segment ) {
+				s.segment = s.chip->ForwardLFO( s.left );
+				s.laned = LaneChannels( s.chip, s.chan, s.segment, s.output, 9, s.am );
+			}
+			if ( s.segment < samples )
+				samples = s.segment;
+			//Every chip gets its own lane in each group
+			LaneAdd( block, s.chip, s.chan, s.laned, s.am, c, LaneBlock::GROUP );
+			block.output[c] = s.output;
+		}
+		if ( block.count )
+			GenerateLaneBlock( block, samples );
+		block.Store();
+		for ( Bitu c = 0; c < MAX_CHIPS; c++ ) {
+			Slot& s = lane[c];
+			if ( !s.left )
+				continue;
+			s.output += samples;
+			s.left -= samples;
+			s.segment -= samples;
+		}
+		total -= samples;
+	}
 }
 
-void Chip::Setup( Bit32u rate ) {
+void ChipBase::SetupRate( Bit32u rate ) {
 	double scale = OPLRATE / (double)rate;
 
 	//Noise counter is run at the same precision as general waves
 	noiseAdd = (Bit32u)( 0.5 + scale * ( 1 << LFO_SH ) );
 	noiseCounter = 0;
 	noiseValue = 1;	//Make sure it triggers the noise xor the first time
+	idleChannels = 0;
 	//The low frequency oscillation counter
 	//Every time his overflows vibrato and tremoloindex are increased
 	lfoAdd = (Bit32u)( 0.5 + scale * ( 1 << LFO_SH ) );
@@ -1331,21 +2137,22 @@ void Chip::Setup( Bit32u rate ) {
 		//This should provide instant volume maximizing
 		attackRates[i] = 8 << RATE_SH;
 	}
+}
+
+template< Bitu CHANNELS >
+void ChipTemplate< CHANNELS >::Setup( Bit32u rate ) {
+	SetupRate( rate );
 	//Setup the channels with the correct four op flags
 	//Channels are accessed through a table so they appear linear here
-	chan[ 0].fourMask = 0x00 | ( 1 << 0 );
-	chan[ 1].fourMask = 0x80 | ( 1 << 0 );
-	chan[ 2].fourMask = 0x00 | ( 1 << 1 );
-	chan[ 3].fourMask = 0x80 | ( 1 << 1 );
-	chan[ 4].fourMask = 0x00 | ( 1 << 2 );
-	chan[ 5].fourMask = 0x80 | ( 1 << 2 );
-
-	chan[ 9].fourMask = 0x00 | ( 1 << 3 );
-	chan[10].fourMask = 0x80 | ( 1 << 3 );
-	chan[11].fourMask = 0x00 | ( 1 << 4 );
-	chan[12].fourMask = 0x80 | ( 1 << 4 );
-	chan[13].fourMask = 0x00 | ( 1 << 5 );
-	chan[14].fourMask = 0x80 | ( 1 << 5 );
+	for ( Bitu bank = 0; bank < CHANNELS; bank += 9 ) {
+		const Bit8u four = (Bit8u)( bank / 3 );
+		chan[ bank + 0].fourMask = 0x00 | ( 1 << ( four + 0 ) );
+		chan[ bank + 1].fourMask = 0x80 | ( 1 << ( four + 0 ) );
+		chan[ bank + 2].fourMask = 0x00 | ( 1 << ( four + 1 ) );
+		chan[ bank + 3].fourMask = 0x80 | ( 1 << ( four + 1 ) );
+		chan[ bank + 4].fourMask = 0x00 | ( 1 << ( four + 2 ) );
+		chan[ bank + 5].fourMask = 0x80 | ( 1 << ( four + 2 ) );
+	}
 
 	//mark the percussion channels
 	chan[ 6].fourMask = 0x40;
@@ -1353,14 +2160,16 @@ void Chip::Setup( Bit32u rate ) {
 	chan[ 8].fourMask = 0x40;
 
 	//Clear Everything in opl3 mode
-	WriteReg( 0x105, 0x1 );
-	for ( int i = 0; i < 512; i++ ) {
-		if ( i == 0x105 )
-			continue;
-		WriteReg( i, 0xff );
-		WriteReg( i, 0x0 );
+	if ( CHANNELS > 9 ) {
+		WriteReg( 0x105, 0x1 );
+		for ( int i = 0; i < 512; i++ ) {
+			if ( i == 0x105 )
+				continue;
+			WriteReg( i, 0xff );
+			WriteReg( i, 0x0 );
+		}
+		WriteReg( 0x105, 0x0 );
 	}
-	WriteReg( 0x105, 0x0 );
 	//Clear everything in opl2 mode
 	for ( int i = 0; i < 255; i++ ) {
 		WriteReg( i, 0xff );
@@ -1368,160 +2177,235 @@ void Chip::Setup( Bit32u rate ) {
 	}
 }
 
-static bool doneTables = false;
-void InitTables( void ) {
-	if ( doneTables )
-		return;
-	doneTables = true;
-#if ( DBOPL_WAVE == WAVE_HANDLER ) || ( DBOPL_WAVE == WAVE_TABLELOG )
-	//Exponential volume table, same as the real adlib
-	for ( int i = 0; i < 256; i++ ) {
-		//Save them in reverse
-		ExpTable[i] = (int)( 0.5 + ( pow(2.0, ( 255 - i) * ( 1.0 /256 ) )-1) * 1024 );
-		ExpTable[i] += 1024; //or remove the -1 oh well :)
-		//Preshift to the left once so the final volume can shift to the right
-		ExpTable[i] *= 2;
-	}
-#endif
-#if ( DBOPL_WAVE == WAVE_HANDLER )
-	//Add 0.5 for the trunc rounding of the integer cast
-	//Do a PI sinetable instead of the original 0.5 PI
-	for ( int i = 0; i < 512; i++ ) {
-		SinTable[i] = (Bit16s)( 0.5 - log10( sin( (i + 0.5) * (M_PI / 512.0) ) ) / log10(2.0)*256 );
-	}
-#endif
-#if ( DBOPL_WAVE == WAVE_TABLEMUL )
-	//Multiplication based tables
-	for ( int i = 0; i < 384; i++ ) {
-		int s = i * 8;
-		//TODO maybe keep some of the precision errors of the original table?
-		double val = ( 0.5 + ( pow(2.0, -1.0 + ( 255 - s) * ( 1.0 /256 ) )) * ( 1 << MUL_SH ));
-		MulTable[i] = (Bit16u)(val);
-	}
+/*
+	State
 
-	//Sine Wave Base
-	for ( int i = 0; i < 512; i++ ) {
-		WaveTable[ 0x0200 + i ] = (Bit16s)(sin( (i + 0.5) * (M_PI / 512.0) ) * 4084);
-		WaveTable[ 0x0000 + i ] = -WaveTable[ 0x200 + i ];
-	}
-	//Exponential wave
-	for ( int i = 0; i < 256; i++ ) {
-		WaveTable[ 0x700 + i ] = (Bit16s)( 0.5 + ( pow(2.0, -1.0 + ( 255 - i * 8) * ( 1.0 /256 ) ) ) * 4085 );
-		WaveTable[ 0x6ff - i ] = -WaveTable[ 0x700 + i ];
-	}
-#endif
-#if ( DBOPL_WAVE == WAVE_TABLELOG )
-	//Sine Wave Base
-	for ( int i = 0; i < 512; i++ ) {
-		WaveTable[ 0x0200 + i ] = (Bit16s)( 0.5 - log10( sin( (i + 0.5) * (M_PI / 512.0) ) ) / log10(2.0)*256 );
-		WaveTable[ 0x0000 + i ] = ((Bit16s)0x8000) | WaveTable[ 0x200 + i];
+	The state is stored as little endian values of fixed size. Table pointers
+	are stored as the index of the waveform they were selected for, so the
+	state does not depend on the build or the host. Wave phases are stored as
+	wmTableMul uses them, so a state can be loaded with any wave mode.
+*/
+
+enum {
+	STATE_VERSION = 2
+};
+
+struct StateSaver {
+	std::vector<Bit8u>& data;
+	StateSaver( std::vector<Bit8u>& d ) : data( d ) {}
+	template< typename T >
+	void operator()( const T& value ) {
+		for ( Bitu i = 0; i < sizeof( T ); i++ )
+			data.push_back( (Bit8u)( (Bit32u)value >> ( i * 8 ) ) );
 	}
-	//Exponential wave
-	for ( int i = 0; i < 256; i++ ) {
-		WaveTable[ 0x700 + i ] = i * 8;
-		WaveTable[ 0x6ff - i ] = ((Bit16s)0x8000) | i * 8;
+};
+
+struct StateLoader {
+	const Bit8u* data;
+	Bitu left;
+	bool valid;
+	StateLoader( const Bit8u* d, Bitu size ) : data( d ), left( size ), valid( true ) {}
+	template< typename T >
+	void operator()( T& value ) {
+		if ( left < sizeof( T ) ) {
+			valid = false;
+			return;
+		}
+		Bit32u v = 0;
+		for ( Bitu i = 0; i < sizeof( T ); i++ )
+			v |= (Bit32u)data[i] << ( i * 8 );
+		value = (T)v;
+		data += sizeof( T );
+		left -= sizeof( T );
 	}
-#endif
+};
 
-	//	|    |//\\|____|WAV7|//__|/\  |____|/\/\|
-	//	|\\//|    |    |WAV7|    |  \/|    |    |
-	//	|06  |0126|27  |7   |3   |4   |4 5 |5   |
-
-#if (( DBOPL_WAVE == WAVE_TABLELOG ) || ( DBOPL_WAVE == WAVE_TABLEMUL ))
-	for ( int i = 0; i < 256; i++ ) {
-		//Fill silence gaps
-		WaveTable[ 0x400 + i ] = WaveTable[0];
-		WaveTable[ 0x500 + i ] = WaveTable[0];
-		WaveTable[ 0x900 + i ] = WaveTable[0];
-		WaveTable[ 0xc00 + i ] = WaveTable[0];
-		WaveTable[ 0xd00 + i ] = WaveTable[0];
-		//Replicate sines in other pieces
-		WaveTable[ 0x800 + i ] = WaveTable[ 0x200 + i ];
-		//double speed sines
-		WaveTable[ 0xa00 + i ] = WaveTable[ 0x200 + i * 2 ];
-		WaveTable[ 0xb00 + i ] = WaveTable[ 0x000 + i * 2 ];
-		WaveTable[ 0xe00 + i ] = WaveTable[ 0x200 + i * 2 ];
-		WaveTable[ 0xf00 + i ] = WaveTable[ 0x200 + i * 2 ];
+//Find the waveform the wave generator of an operator was setup for
+static Bit8u OperatorWaveForm( const Operator& op ) {
+	for ( Bit8u i = 0; i < 8; i++ ) {
+		if ( op.waveHandler == WaveHandlerTable[ i ] )
+			return i;
 	}
-#endif
+	return 0;
+}
 
-	//Create the ksl table
-	for ( int oct = 0; oct < 8; oct++ ) {
-		int base = oct * 8;
-		for ( int i = 0; i < 16; i++ ) {
-			int val = base - KslCreateTable[i];
-			if ( val < 0 )
-				val = 0;
-			//*4 for the final range to match attenuation range
-			KslTable[ oct * 16 + i ] = val * 4;
+template< Bitu CHANNELS >
+void ChipTemplate< CHANNELS >::SetWaveMode( WaveMode mode ) {
+	for ( Bitu c = 0; c < CHANNELS; c++ ) {
+		for ( Bitu o = 0; o < 2; o++ ) {
+			Operator& op = chan[c].op[o];
+			//Keep the position relative to the start of the wave
+			op.waveIndex -= op.waveStart;
+			op.SetWaveForm( mode, OperatorWaveForm( op ) );
+			op.waveIndex += op.waveStart;
 		}
 	}
-	//Create the Tremolo table, just increase and decrease a triangle wave
-	for ( Bit8u i = 0; i < TREMOLO_TABLE / 2; i++ ) {
-		Bit8u val = i << ENV_EXTRA;
-		TremoloTable[i] = val;
-		TremoloTable[TREMOLO_TABLE - 1 - i] = val;
-	}
-	//Create a table with offsets of the channels from the start of the chip
-	DBOPL::Chip* chip = 0;
-	for ( Bitu i = 0; i < 32; i++ ) {
-		Bitu index = i & 0xf;
-		if ( index >= 9 ) {
-			ChanOffsetTable[i] = 0;
-			continue;
-		}
-		//Make sure the four op channels follow eachother
-		if ( index < 6 ) {
-			index = (index % 3) * 2 + ( index / 3 );
-		}
-		//Add back the bits for highest ones
-		if ( i >= 16 )
-			index += 9;
-		Bitu blah = reinterpret_cast<size_t>( &(chip->chan[ index ]) );
-		ChanOffsetTable[i] = blah;
-	}
-	//Same for operators
-	for ( Bitu i = 0; i < 64; i++ ) {
-		if ( i % 8 >= 6 || ( (i / 8) % 4 == 3 ) ) {
-			OpOffsetTable[i] = 0;
-			continue;
+	waveMode = mode;
+}
+
+//Pass all plain values of the chip to the stream, used for saving and loading
+template< typename Stream, Bitu CHANNELS >
+static void TransferState( Stream& s, ChipTemplate< CHANNELS >& chip ) {
+	s( chip.lfoCounter );
+	s( chip.noiseCounter );
+	s( chip.noiseValue );
+	s( chip.reg104 );
+	s( chip.reg08 );
+	s( chip.reg04 );
+	s( chip.regBD );
+	s( chip.vibratoIndex );
+	s( chip.tremoloIndex );
+	s( chip.vibratoSign );
+	s( chip.vibratoShift );
+	s( chip.tremoloValue );
+	s( chip.vibratoStrength );
+	s( chip.tremoloStrength );
+	s( chip.waveFormMask );
+	s( chip.opl3Active );
+	for ( Bitu c = 0; c < CHANNELS; c++ ) {
+		Channel& ch = chip.chan[c];
+		s( ch.chanData );
+		s( ch.old[0] );
+		s( ch.old[1] );
+		s( ch.feedback );
+		s( ch.regB0 );
+		s( ch.regC0 );
+		s( ch.fourMask );
+		s( ch.maskLeft );
+		s( ch.maskRight );
+		for ( Bitu o = 0; o < 2; o++ ) {
+			Operator& op = ch.op[o];
+			s( op.waveIndex );
+			s( op.waveAdd );
+			s( op.waveCurrent );
+			s( op.chanData );
+			s( op.freqMul );
+			s( op.vibrato );
+			s( op.sustainLevel );
+			s( op.totalLevel );
+			s( op.currentLevel );
+			s( op.volume );
+			s( op.attackAdd );
+			s( op.decayAdd );
+			s( op.releaseAdd );
+			s( op.rateIndex );
+			s( op.rateZero );
+			s( op.keyOn );
+			s( op.reg20 );
+			s( op.reg40 );
+			s( op.reg60 );
+			s( op.reg80 );
+			s( op.regE0 );
+			s( op.state );
+			s( op.tremoloMask );
+			s( op.vibStrength );
+			s( op.ksr );
 		}
-		Bitu chNum = (i / 8) * 3 + (i % 8) % 3;
-		//Make sure we use 16 and up for the 2nd range to match the chanoffset gap
-		if ( chNum >= 12 )
-			chNum += 16 - 12;
-		Bitu opNum = ( i % 8 ) / 3;
-		DBOPL::Channel* chan = 0;
-		Bitu blah = reinterpret_cast<size_t>( &(chan->op[opNum]) );
-		OpOffsetTable[i] = ChanOffsetTable[ chNum ] + blah;
 	}
-#if 0
-	//Stupid checks if table's are correct
-	for ( Bitu i = 0; i < 18; i++ ) {
-		Bit32u find = (Bit16u)( &(chip->chan[ i ]) );
-		for ( Bitu c = 0; c < 32; c++ ) {
-			if ( ChanOffsetTable[c] == find ) {
-				find = 0;
-				break;
-			}
-		}
-		if ( find ) {
-			find = find;
-		}
+}
+
+template< Bitu CHANNELS >
+void ChipTemplate< CHANNELS >::SaveState( std::vector<Bit8u>& state ) const {
+	StateSaver s( state );
+	s( (Bit8u)STATE_VERSION );
+	s( (Bit8u)CHANNELS );
+	//The rate dependant tables are not stored, they only have to match
+	s( lfoAdd );
+	if ( waveMode != wmTableMul ) {
+		ChipTemplate chip( *this );
+		chip.SetWaveMode( wmTableMul );
+		TransferState( s, chip );
+	} else {
+		TransferState( s, const_cast< ChipTemplate& >( *this ) );
 	}
-	for ( Bitu i = 0; i < 36; i++ ) {
-		Bit32u find = (Bit16u)( &(chip->chan[ i / 2 ].op[i % 2]) );
-		for ( Bitu c = 0; c < 64; c++ ) {
-			if ( OpOffsetTable[c] == find ) {
-				find = 0;
-				break;
-			}
-		}
-		if ( find ) {
-			find = find;
+	for ( Bitu c = 0; c < CHANNELS; c++ ) {
+		s( (Bit8u)chan[c].synthMode );
+		s( OperatorWaveForm( chan[c].op[0] ) );
+		s( OperatorWaveForm( chan[c].op[1] ) );
+	}
+}
+
+template< Bitu CHANNELS >
+Bitu ChipTemplate< CHANNELS >::LoadState( const Bit8u* state, Bitu size ) {
+	StateLoader s( state, size );
+	Bit8u version = 0;
+	Bit8u channels = 0;
+	Bit32u rateAdd = 0;
+	s( version );
+	s( channels );
+	s( rateAdd );
+	if ( !s.valid || version != STATE_VERSION || channels != CHANNELS || rateAdd != lfoAdd )
+		return 0;
+	//Load into a copy, so a broken state leaves the chip untouched
+	ChipTemplate chip( *this );
+	TransferState( s, chip );
+	chip.idleChannels = 0;
+	for ( Bitu c = 0; c < CHANNELS && s.valid; c++ ) {
+		Bit8u mode = 0, wave0 = 0, wave1 = 0;
+		s( mode );
+		s( wave0 );
+		s( wave1 );
+		Channel& ch = chip.chan[c];
+		if ( mode >= 12 || mode == sm4Start || mode == sm6Start || wave0 >= 8 || wave1 >= 8 || ch.op[0].state > Operator::ATTACK || ch.op[1].state > Operator::ATTACK ) {
+			s.valid = false;
+			break;
 		}
+		ch.synthMode = (SynthMode)mode;
+		ch.op[0].SetState( ch.op[0].state );
+		ch.op[1].SetState( ch.op[1].state );
+		ch.op[0].SetWaveForm( wmTableMul, wave0 );
+		ch.op[1].SetWaveForm( wmTableMul, wave1 );
 	}
-#endif
+	if ( !s.valid )
+		return 0;
+	chip.waveMode = wmTableMul;
+	chip.SetWaveMode( waveMode );
+	*this = chip;
+	return size - s.left;
 }
 
+/*
+	Tracing
+*/
+
+//Names of the synth modes, indexed by SynthMode
+static const char* const SynthModeNames[12] = {
+	"BlockTemplate<sm2AM>",
+	"BlockTemplate<sm2FM>",
+	"BlockTemplate<sm3AM>",
+	"BlockTemplate<sm3FM>",
+	"BlockTemplate<sm4Start>",
+	"BlockTemplate<sm3FMFM>",
+	"BlockTemplate<sm3AMFM>",
+	"BlockTemplate<sm3FMAM>",
+	"BlockTemplate<sm3AMAM>",
+	"BlockTemplate<sm6Start>",
+	"BlockTemplate<sm2Percussion>",
+	"BlockTemplate<sm3Percussion>"
+};
+
+template< Bitu CHANNELS >
+Channel* ChipTemplate< CHANNELS >::TraceChannel( Channel* ch, Bit32u samples, Bit32s* output ) {
+	trace->BeginSpan( SynthModeNames[ ch->synthMode ], "channel", ch - chan );
+	ch = ch->Block( this, samples, output );
+	trace->EndSpan();
+	return ch;
+}
+
+//The OPL3 chip and the OPL2 only chip, which has no GenerateBlock3
+template struct ChipTemplate< 18 >;
+template void ChipLanes::Begin( Bitu slot, ChipTemplate< 18 >* chip, Bitu samples, Bit32s* output );
+
+template Channel* ChipTemplate< 9 >::TraceChannel( Channel* ch, Bit32u samples, Bit32s* output );
+template void ChipTemplate< 9 >::WriteBD( Bit8u val );
+template void ChipTemplate< 9 >::WriteReg( Bit32u reg, Bit8u val );
+template void ChipTemplate< 9 >::GenerateBlock2( Bitu samples, Bit32s* output );
+template void ChipTemplate< 9 >::GenerateBlock2SoA( Bitu samples, Bit32s* output );
+template void ChipTemplate< 9 >::GenerateIdle( Bitu samples, Bit32s* output, Bitu outputs );
+template void ChipTemplate< 9 >::Setup( Bit32u r );
+template void ChipTemplate< 9 >::SetWaveMode( WaveMode mode );
+template void ChipTemplate< 9 >::SaveState( std::vector<Bit8u>& state ) const;
+template Bitu ChipTemplate< 9 >::LoadState( const Bit8u* state, Bitu size );
+template void ChipLanes::Begin( Bitu slot, ChipTemplate< 9 >* chip, Bitu samples, Bit32s* output );
+
 }		//Namespace DBOPL
@@ -22,16 +22,7 @@
 #define DBOPL_H
 
 #include <stdint.h>
-
-//Use 8 handlers based on a small logatirmic wavetabe and an exponential table for volume
-#define WAVE_HANDLER	10
-//Use a logarithmic wavetable with an exponential table for volume
-#define WAVE_TABLELOG	11
-//Use a linear wavetable with a multiply table for volume
-#define WAVE_TABLEMUL	12
-
-//Select the type of wave generator routine
-#define DBOPL_WAVE WAVE_TABLEMUL
+#include <vector>
 
 namespace DBOPL {
 
@@ -53,16 +44,21 @@ typedef uint32_t Bit32u;
 #define INLINE inline
 // -------------------------------
 
-struct Chip;
+struct ChipBase;
 struct Operator;
 struct Channel;
 
-#if (DBOPL_WAVE == WAVE_HANDLER)
 typedef Bits ( DB_FASTCALL *WaveHandler) ( Bitu i, Bitu volume );
-#endif
 
-typedef Bits ( DBOPL::Operator::*VolumeHandler) ( );
-typedef Channel* ( DBOPL::Channel::*SynthHandler) ( Chip* chip, Bit32u samples, Bit32s* output );
+//Different wave generator routines, selected per chip with Chip::SetWaveMode
+typedef enum {
+	//Use 8 handlers based on a small logatirmic wavetabe and an exponential table for volume
+	wmHandler,
+	//Use a logarithmic wavetable with an exponential table for volume
+	wmTableLog,
+	//Use a linear wavetable with a multiply table for volume
+	wmTableMul
+} WaveMode;
 
 //Different synth modes that can generate blocks of data
 typedef enum {
@@ -80,6 +76,21 @@ typedef enum {
 	sm3Percussion
 } SynthMode;
 
+//Engines to generate the output of a chip, they all produce identical output
+typedef enum {
+	//Every channel renders its block in its synth mode
+	engineScalar,
+	//All regular 2 op channels render in lockstep out of structure of arrays
+	engineSoA
+} Engine;
+
+//Receives the work of a chip as nested spans for profiling, see Chip::trace
+struct TraceHandler {
+	virtual ~TraceHandler() {}
+	virtual void BeginSpan( const char* name, const char* argName, Bitu arg ) = 0;
+	virtual void EndSpan() = 0;
+};
+
 //Shifts for the values contained in chandata variable
 enum {
 	SHIFT_KSLBASE = 16,
@@ -104,15 +115,11 @@ public:
 		ATTACK
 	} State;
 
-	VolumeHandler volHandler;
-
-#if (DBOPL_WAVE == WAVE_HANDLER)
+	//The wave of every wave mode is kept up to date
 	WaveHandler waveHandler;	//Routine that generate a wave
-#else
-	Bit16s* waveBase;
+	const Bit16s* waveBase;
 	Bit32u waveMask;
 	Bit32u waveStart;
-#endif
 	Bit32u waveIndex;			//WAVE_BITS shifted counter of the frequency index
 	Bit32u waveAdd;				//The base frequency without vibrato
 	Bit32u waveCurrent;			//waveAdd + vibratao
@@ -143,23 +150,27 @@ public:
 	//Keep track of the calculated KSR so we can check for changes
 	Bit8u ksr;
 private:
-	void SetState( Bit8u s );
-	void UpdateAttack( const Chip* chip );
-	void UpdateRelease( const Chip* chip );
-	void UpdateDecay( const Chip* chip );
+	void UpdateAttack( const ChipBase* chip );
+	void UpdateRelease( const ChipBase* chip );
+	void UpdateDecay( const ChipBase* chip );
 public:
+	void SetState( Bit8u s );
 	void UpdateAttenuation();
-	void UpdateRates( const Chip* chip );
+	void UpdateRates( const ChipBase* chip );
 	void UpdateFrequency( );
 
-	void Write20( const Chip* chip, Bit8u val );
-	void Write40( const Chip* chip, Bit8u val );
-	void Write60( const Chip* chip, Bit8u val );
-	void Write80( const Chip* chip, Bit8u val );
-	void WriteE0( const Chip* chip, Bit8u val );
+	void Write20( const ChipBase* chip, Bit8u val );
+	void Write40( const ChipBase* chip, Bit8u val );
+	void Write60( const ChipBase* chip, Bit8u val );
+	void Write80( const ChipBase* chip, Bit8u val );
+	void WriteE0( const ChipBase* chip, Bit8u val );
 
 	bool Silent() const;
-	void Prepare( const Chip* chip );
+	//The envelope doesn't change anymore until the next write
+	bool Constant() const;
+	//Silent with a constant envelope
+	bool Frozen() const;
+	void Prepare( const ChipBase* chip );
 
 	void KeyOn( Bit8u mask);
 	void KeyOff( Bit8u mask);
@@ -171,8 +182,19 @@ public:
 	Bitu ForwardWave();
 	Bitu ForwardVolume();
 
+	template< WaveMode wave >
 	Bits GetSample( Bits modulation );
+	template< WaveMode wave >
 	Bits GetWave( Bitu index, Bitu vol );
+
+	//Volume of an operator with a constant envelope for the whole block
+	Bitu HeldVolume() const;
+	//GetSample with the volume taken from HeldVolume, mul is the matching
+	//factor of the multiplication table for wmTableMul
+	template< WaveMode wave >
+	Bits GetHeldSample( Bits modulation, Bitu vol, Bits mul );
+	//Setup the wave generator for a waveform, waveIndex isn't changed
+	void SetWaveForm( WaveMode mode, Bit8u waveForm );
 public:
 	Operator();
 };
@@ -182,7 +204,8 @@ struct Channel {
 	inline Operator* Op( Bitu index ) {
 		return &( ( this + (index >> 1) )->op[ index & 1 ]);
 	}
-	SynthHandler synthHandler;
+	//Selects the BlockTemplate generating the channel
+	SynthMode synthMode;
 	Bit32u chanData;		//Frequency/octave and derived values
 	Bit32s old[2];			//Old data for feedback
 
@@ -195,25 +218,40 @@ struct Channel {
 	Bit8s maskRight;
 
 	//Forward the channel data to the operators of the channel
-	void SetChanData( const Chip* chip, Bit32u data );
+	void SetChanData( const ChipBase* chip, Bit32u data );
 	//Change in the chandata, check for new values and if we have to forward to operators
-	void UpdateFrequency( const Chip* chip, Bit8u fourOp );
-	void WriteA0( const Chip* chip, Bit8u val );
-	void WriteB0( const Chip* chip, Bit8u val );
-	void WriteC0( const Chip* chip, Bit8u val );
-	void ResetC0( const Chip* chip );
+	void UpdateFrequency( const ChipBase* chip, Bit8u fourOp );
+	void WriteA0( const ChipBase* chip, Bit8u val );
+	void WriteB0( const ChipBase* chip, Bit8u val );
+	void WriteC0( const ChipBase* chip, Bit8u val );
+	void ResetC0( const ChipBase* chip );
 
 	//call this for the first channel
-	template< bool opl3Mode >
-	void GeneratePercussion( Chip* chip, Bit32s* output );
+	template< WaveMode wave, bool opl3Mode >
+	void GeneratePercussion( ChipBase* chip, Bit32s* output );
+	//Forward the phases and the noise like GeneratePercussion does when
+	//all operators are frozen
+	void SkipPercussion( ChipBase* chip, Bit32u samples );
 
 	//Generate blocks of data in specific modes
-	template<SynthMode mode>
-	Channel* BlockTemplate( Chip* chip, Bit32u samples, Bit32s* output );
+	template<SynthMode mode, WaveMode wave>
+	Channel* BlockTemplate( ChipBase* chip, Bit32u samples, Bit32s* output );
+	//Generate a block of a 2 op mode where the operators selected by held0
+	//and held1 have a constant envelope, which is only calculated once
+	template<SynthMode mode, WaveMode wave, bool held0, bool held1>
+	void BlockHeld( Bit32u samples, Bit32s* output );
+	//Generate a block in the synth mode of the channel with the wave
+	//routine of the chip, returns the next channel
+	template<WaveMode wave>
+	Channel* BlockWave( ChipBase* chip, Bit32u samples, Bit32s* output );
+	Channel* Block( ChipBase* chip, Bit32u samples, Bit32s* output );
 	Channel();
 };
 
-struct Chip {
+//The part of a chip which does not depend on the number of channels. The
+//values used while generating come first and share a single cache line, the
+//rate tables are only used by register writes
+struct ChipBase {
 	//This is used as the base counter for vibrato and tremolo
 	Bit32u lfoCounter;
 	Bit32u lfoAdd;
@@ -223,16 +261,6 @@ struct Chip {
 	Bit32u noiseAdd;
 	Bit32u noiseValue;
 
-	//Frequency scales for the different multiplications
-	Bit32u freqMul[16];
-	//Rates for decay and release for rate of this chip
-	Bit32u linearRates[76];
-	//Best match attack rates for the rate of this chip
-	Bit32u attackRates[76];
-
-	//18 channels with 2 operators each
-	Channel chan[18];
-
 	Bit8u reg104;
 	Bit8u reg08;
 	Bit8u reg04;
@@ -248,26 +276,112 @@ struct Chip {
 	Bit8u waveFormMask;
 	//0 or -1 when enabled
 	Bit8s opl3Active;
+	//Number of channels from the start which stay silent until the next
+	//register write, 9 or 18 once a whole block of GenerateBlock2 or
+	//GenerateBlock3 had no output. Only the LFO and the percussion phases
+	//are forwarded then, it is not part of the state
+	Bit8u idleChannels;
+	//Engine used by GenerateBlock2
+	Engine engine;
+	//Wave generator routine of all operators, changed with SetWaveMode. It
+	//is not part of the state
+	WaveMode waveMode;
+	//Receives the LFO segments and channel blocks of GenerateBlock2 and
+	//GenerateBlock3 when set, it is not part of the state
+	TraceHandler* trace;
+	//Channels which generated samples in the current block
+	Bitu activeChannels;
+
+	//Frequency scales for the different multiplications
+	Bit32u freqMul[16];
+	//Rates for decay and release for rate of this chip
+	Bit32u linearRates[76];
+	//Best match attack rates for the rate of this chip
+	Bit32u attackRates[76];
 
 	//Return the maximum amount of samples before and LFO change
 	Bit32u ForwardLFO( Bit32u samples );
 	Bit32u ForwardNoise();
+	//Forward the noise by the amount of samples without using it
+	void SkipNoise( Bit32u samples );
+
+	Bit32u WriteAddr( Bit32u port, Bit8u val );
+
+	//Setup the counters and the rate tables for a rate
+	void SetupRate( Bit32u r );
+
+	ChipBase();
+};
+
+//A chip with 18 channels for an OPL3 or with 9 channels for an OPL2 only.
+//The OPL2 variant has half the size, ignores the registers of the second
+//bank, 0x104 and 0x105 and leaves the OPL3 checks out of WriteReg and
+//WriteBD. GenerateBlock3 is only available with 18 channels
+template< Bitu CHANNELS >
+struct ChipTemplate : public ChipBase {
+	//Channels with 2 operators each
+	Channel chan[ CHANNELS ];
+
+	//Generate the block of a channel inside a trace span
+	Channel* TraceChannel( Channel* ch, Bit32u samples, Bit32s* output );
 
 	void WriteBD( Bit8u val );
 	void WriteReg(Bit32u reg, Bit8u val );
 
-	Bit32u WriteAddr( Bit32u port, Bit8u val );
-
 	void GenerateBlock2( Bitu samples, Bit32s* output );
+	void GenerateBlock2SoA( Bitu samples, Bit32s* output );
 	void GenerateBlock3( Bitu samples, Bit32s* output );
+	//Generate a block of silence while idle, with 1 or 2 outputs per sample
+	void GenerateIdle( Bitu samples, Bit32s* output, Bitu outputs );
 
-	void Generate( Bit32u samples );
 	void Setup( Bit32u r );
-
-	Chip();
+	//Switch all operators to another wave generator routine, the waves
+	//continue at the same phase. The modes differ in their rounding, thus
+	//the output is close to, but not the same as, the one of wmTableMul
+	void SetWaveMode( WaveMode mode );
+	//Append the complete state of the chip to state
+	void SaveState( std::vector<Bit8u>& state ) const;
+	//Restore a state made by SaveState of a chip with the same number of
+	//channels setup for the same rate, returns the number of bytes used or 0
+	//when the state is not valid
+	Bitu LoadState( const Bit8u* state, Bitu size );
 };
+typedef ChipTemplate< 18 > Chip;
+typedef ChipTemplate< 9 > Opl2Chip;
+
+struct ChipLanes {
+	enum {
+		MAX_CHIPS = 8
+	};
 
-void InitTables();
+	ChipLanes();
+
+	//Start a block of samples for the chip in a slot, the output is written
+	//to output while the block is generated
+	template< Bitu CHANNELS >
+	void Begin( Bitu slot, ChipTemplate< CHANNELS >* chip, Bitu samples, Bit32s* output );
+	//Samples left in the current block of a slot
+	Bitu Left( Bitu slot ) const { return lane[slot].left; }
+	//Generate samples for all slots with a block, may not be more than the
+	//smallest number of samples left in a block
+	void Generate( Bitu samples );
+private:
+	struct Slot {
+		ChipBase* chip;
+		Channel* chan;
+		Bit32s* output;
+		//Samples left in the block and the current LFO segment of it
+		Bitu left;
+		Bitu segment;
+		//The block was generated by Begin already
+		bool direct;
+		//Channels rendered in lanes during the segment and which of them
+		//are in AM mode
+		Bit16u laned;
+		Bit16u am;
+	};
+	Slot lane[ MAX_CHIPS ];
+};
 
 }		//Namespace
 
@@ -0,0 +1,1910 @@
+// This file is generated by gentables.cpp, do not edit it.
+// Run "make tables" to regenerate it.
+
+//Volume table used by wmHandler and wmTableLog
+static const Bit16u ExpTable[ 256 ] = {
+	4084, 4074, 4062, 4052, 4040, 4030, 4020, 4008, 3998, 3986, 3976, 3966, 3954, 3944, 3932, 3922,
+	3912, 3902, 3890, 3880, 3870, 3860, 3848, 3838, 3828, 3818, 3808, 3796, 3786, 3776, 3766, 3756,
+	3746, 3736, 3726, 3716, 3706, 3696, 3686, 3676, 3666, 3656, 3646, 3636, 3626, 3616, 3606, 3596,
+	3588, 3578, 3568, 3558, 3548, 3538, 3530, 3520, 3510, 3500, 3492, 3482, 3472, 3464, 3454, 3444,
+	3434, 3426, 3416, 3408, 3398, 3388, 3380, 3370, 3362, 3352, 3344, 3334, 3326, 3316, 3308, 3298,
+	3290, 3280, 3272, 3262, 3254, 3246, 3236, 3228, 3218, 3210, 3202, 3192, 3184, 3176, 3168, 3158,
+	3150, 3142, 3132, 3124, 3116, 3108, 3100, 3090, 3082, 3074, 3066, 3058, 3050, 3040, 3032, 3024,
+	3016, 3008, 3000, 2992, 2984, 2976, 2968, 2960, 2952, 2944, 2936, 2928, 2920, 2912, 2904, 2896,
+	2888, 2880, 2872, 2866, 2858, 2850, 2842, 2834, 2826, 2818, 2812, 2804, 2796, 2788, 2782, 2774,
+	2766, 2758, 2752, 2744, 2736, 2728, 2722, 2714, 2706, 2700, 2692, 2684, 2678, 2670, 2664, 2656,
+	2648, 2642, 2634, 2628, 2620, 2614, 2606, 2600, 2592, 2584, 2578, 2572, 2564, 2558, 2550, 2544,
+	2536, 2530, 2522, 2516, 2510, 2502, 2496, 2488, 2482, 2476, 2468, 2462, 2456, 2448, 2442, 2436,
+	2428, 2422, 2416, 2410, 2402, 2396, 2390, 2384, 2376, 2370, 2364, 2358, 2352, 2344, 2338, 2332,
+	2326, 2320, 2314, 2308, 2300, 2294, 2288, 2282, 2276, 2270, 2264, 2258, 2252, 2246, 2240, 2234,
+	2228, 2222, 2216, 2210, 2204, 2198, 2192, 2186, 2180, 2174, 2168, 2162, 2156, 2150, 2144, 2138,
+	2132, 2128, 2122, 2116, 2110, 2104, 2098, 2092, 2088, 2082, 2076, 2070, 2064, 2060, 2054, 2048,
+};
+
+//PI table used by wmHandler
+static const Bit16u SinTable[ 512 ] = {
+	2137, 1731, 1543, 1419, 1326, 1252, 1190, 1137, 1091, 1050, 1013, 979, 949, 920, 894, 869,
+	846, 825, 804, 785, 767, 749, 732, 717, 701, 687, 672, 659, 646, 633, 621, 609,
+	598, 587, 576, 566, 556, 546, 536, 527, 518, 509, 501, 492, 484, 476, 468, 461,
+	453, 446, 439, 432, 425, 418, 411, 405, 399, 392, 386, 380, 375, 369, 363, 358,
+	352, 347, 341, 336, 331, 326, 321, 316, 311, 307, 302, 297, 293, 289, 284, 280,
+	276, 271, 267, 263, 259, 255, 251, 248, 244, 240, 236, 233, 229, 226, 222, 219,
+	215, 212, 209, 205, 202, 199, 196, 193, 190, 187, 184, 181, 178, 175, 172, 169,
+	167, 164, 161, 159, 156, 153, 151, 148, 146, 143, 141, 138, 136, 134, 131, 129,
+	127, 125, 122, 120, 118, 116, 114, 112, 110, 108, 106, 104, 102, 100, 98, 96,
+	94, 92, 91, 89, 87, 85, 83, 82, 80, 78, 77, 75, 74, 72, 70, 69,
+	67, 66, 64, 63, 62, 60, 59, 57, 56, 55, 53, 52, 51, 49, 48, 47,
+	46, 45, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30,
+	29, 28, 27, 26, 25, 24, 23, 23, 22, 21, 20, 20, 19, 18, 17, 17,
+	16, 15, 15, 14, 13, 13, 12, 12, 11, 10, 10, 9, 9, 8, 8, 7,
+	7, 7, 6, 6, 5, 5, 5, 4, 4, 4, 3, 3, 3, 2, 2, 2,
+	2, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 2,
+	2, 2, 2, 3, 3, 3, 4, 4, 4, 5, 5, 5, 6, 6, 7, 7,
+	7, 8, 8, 9, 9, 10, 10, 11, 12, 12, 13, 13, 14, 15, 15, 16,
+	17, 17, 18, 19, 20, 20, 21, 22, 23, 23, 24, 25, 26, 27, 28, 29,
+	30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 45, 46,
+	47, 48, 49, 51, 52, 53, 55, 56, 57, 59, 60, 62, 63, 64, 66, 67,
+	69, 70, 72, 74, 75, 77, 78, 80, 82, 83, 85, 87, 89, 91, 92, 94,
+	96, 98, 100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 125, 127,
+	129, 131, 134, 136, 138, 141, 143, 146, 148, 151, 153, 156, 159, 161, 164, 167,
+	169, 172, 175, 178, 181, 184, 187, 190, 193, 196, 199, 202, 205, 209, 212, 215,
+	219, 222, 226, 229, 233, 236, 240, 244, 248, 251, 255, 259, 263, 267, 271, 276,
+	280, 284, 289, 293, 297, 302, 307, 311, 316, 321, 326, 331, 336, 341, 347, 352,
+	358, 363, 369, 375, 380, 386, 392, 399, 405, 411, 418, 425, 432, 439, 446, 453,
+	461, 468, 476, 484, 492, 501, 509, 518, 527, 536, 546, 556, 566, 576, 587, 598,
+	609, 621, 633, 646, 659, 672, 687, 701, 717, 732, 749, 767, 785, 804, 825, 846,
+	869, 894, 920, 949, 979, 1013, 1050, 1091, 1137, 1190, 1252, 1326, 1419, 1543, 1731, 2137,
+};
+
+//Tables used by wmTableMul
+static const Bit16u MulTable[ 384 ] = {
+	65359, 63958, 62588, 61247, 59934, 58650, 57393, 56163, 54960, 53782, 52630, 51502, 50399, 49319, 48262, 47228,
+	46216, 45225, 44256, 43308, 42380, 41472, 40583, 39714, 38863, 38030, 37215, 36417, 35637, 34874, 34126, 33395,
+	32679, 31979, 31294, 30623, 29967, 29325, 28697, 28082, 27480, 26891, 26315, 25751, 25199, 24659, 24131, 23614,
+	23108, 22613, 22128, 21654, 21190, 20736, 20292, 19857, 19431, 19015, 18607, 18209, 17819, 17437, 17063, 16697,
+	16340, 15990, 15647, 15312, 14984, 14663, 14348, 14041, 13740, 13446, 13157, 12876, 12600, 12330, 12065, 11807,
+	11554, 11306, 11064, 10827, 10595, 10368, 10146, 9928, 9716, 9507, 9304, 9104, 8909, 8718, 8532, 8349,
+	8170, 7995, 7823, 7656, 7492, 7331, 7174, 7020, 6870, 6723, 6579, 6438, 6300, 6165, 6033, 5903,
+	5777, 5653, 5532, 5413, 5297, 5184, 5073, 4964, 4858, 4754, 4652, 4552, 4455, 4359, 4266, 4174,
+	4085, 3997, 3912, 3828, 3746, 3666, 3587, 3510, 3435, 3361, 3289, 3219, 3150, 3082, 3016, 2952,
+	2888, 2827, 2766, 2707, 2649, 2592, 2536, 2482, 2429, 2377, 2326, 2276, 2227, 2180, 2133, 2087,
+	2042, 1999, 1956, 1914, 1873, 1833, 1794, 1755, 1717, 1681, 1645, 1609, 1575, 1541, 1508, 1476,
+	1444, 1413, 1383, 1353, 1324, 1296, 1268, 1241, 1214, 1188, 1163, 1138, 1114, 1090, 1066, 1044,
+	1021, 999, 978, 957, 936, 916, 897, 878, 859, 840, 822, 805, 787, 771, 754, 738,
+	722, 707, 692, 677, 662, 648, 634, 621, 607, 594, 581, 569, 557, 545, 533, 522,
+	511, 500, 489, 478, 468, 458, 448, 439, 429, 420, 411, 402, 394, 385, 377, 369,
+	361, 353, 346, 338, 331, 324, 317, 310, 304, 297, 291, 285, 278, 272, 267, 261,
+	255, 250, 244, 239, 234, 229, 224, 219, 215, 210, 206, 201, 197, 193, 189, 184,
+	181, 177, 173, 169, 166, 162, 159, 155, 152, 149, 145, 142, 139, 136, 133, 130,
+	128, 125, 122, 120, 117, 115, 112, 110, 107, 105, 103, 101, 98, 96, 94, 92,
+	90, 88, 86, 85, 83, 81, 79, 78, 76, 74, 73, 71, 70, 68, 67, 65,
+	64, 62, 61, 60, 59, 57, 56, 55, 54, 53, 51, 50, 49, 48, 47, 46,
+	45, 44, 43, 42, 41, 40, 40, 39, 38, 37, 36, 36, 35, 34, 33, 33,
+	32, 31, 31, 30, 29, 29, 28, 27, 27, 26, 26, 25, 25, 24, 24, 23,
+	23, 22, 22, 21, 21, 20, 20, 19, 19, 19, 18, 18, 17, 17, 17, 16,
+};
+static const Bit16s MulWaveTable[ 4096 ] = {
+	-12, -37, -62, -87, -112, -137, -162, -187, -212, -237, -262, -287, -312, -337, -362, -387,
+	-412, -437, -462, -487, -512, -537, -562, -586, -611, -636, -661, -685, -710, -735, -759, -784,
+	-809, -833, -858, -882, -907, -931, -955, -980, -1004, -1028, -1052, -1077, -1101, -1125, -1149, -1173,
+	-1197, -1221, -1245, -1269, -1292, -1316, -1340, -1364, -1387, -1411, -1434, -1458, -1481, -1504, -1528, -1551,
+	-1574, -1597, -1620, -1643, -1666, -1689, -1712, -1734, -1757, -1780, -1802, -1825, -1847, -1869, -1891, -1914,
+	-1936, -1958, -1980, -2002, -2023, -2045, -2067, -2088, -2110, -2131, -2153, -2174, -2195, -2216, -2237, -2258,
+	-2279, -2300, -2320, -2341, -2361, -2382, -2402, -2422, -2442, -2462, -2482, -2502, -2522, -2542, -2561, -2581,
+	-2600, -2619, -2638, -2658, -2677, -2695, -2714, -2733, -2751, -2770, -2788, -2806, -2825, -2843, -2861, -2878,
+	-2896, -2914, -2931, -2949, -2966, -2983, -3000, -3017, -3034, -3051, -3067, -3084, -3100, -3116, -3132, -3149,
+	-3164, -3180, -3196, -3211, -3227, -3242, -3257, -3272, -3287, -3302, -3317, -3331, -3346, -3360, -3374, -3388,
+	-3402, -3416, -3430, -3443, -3457, -3470, -3483, -3496, -3509, -3522, -3534, -3547, -3559, -3571, -3583, -3595,
+	-3607, -3619, -3630, -3642, -3653, -3664, -3675, -3686, -3697, -3707, -3718, -3728, -3738, -3748, -3758, -3768,
+	-3777, -3787, -3796, -3805, -3814, -3823, -3832, -3841, -3849, -3857, -3865, -3873, -3881, -3889, -3897, -3904,
+	-3911, -3918, -3925, -3932, -3939, -3945, -3952, -3958, -3964, -3970, -3976, -3982, -3987, -3992, -3998, -4003,
+	-4007, -4012, -4017, -4021, -4025, -4030, -4034, -4037, -4041, -4045, -4048, -4051, -4054, -4057, -4060, -4063,
+	-4065, -4067, -4069, -4071, -4073, -4075, -4077, -4078, -4079, -4080, -4081, -4082, -4083, -4083, -4083, -4083,
+	-4083, -4083, -4083, -4083, -4082, -4081, -4080, -4079, -4078, -4077, -4075, -4073, -4071, -4069, -4067, -4065,
+	-4063, -4060, -4057, -4054, -4051, -4048, -4045, -4041, -4037, -4034, -4030, -4025, -4021, -4017, -4012, -4007,
+	-4003, -3998, -3992, -3987, -3982, -3976, -3970, -3964, -3958, -3952, -3945, -3939, -3932, -3925, -3918, -3911,
+	-3904, -3897, -3889, -3881, -3873, -3865, -3857, -3849, -3841, -3832, -3823, -3814, -3805, -3796, -3787, -3777,
+	-3768, -3758, -3748, -3738, -3728, -3718, -3707, -3697, -3686, -3675, -3664, -3653, -3642, -3630, -3619, -3607,
+	-3595, -3583, -3571, -3559, -3547, -3534, -3522, -3509, -3496, -3483, -3470, -3457, -3443, -3430, -3416, -3402,
+	-3388, -3374, -3360, -3346, -3331, -3317, -3302, -3287, -3272, -3257, -3242, -3227, -3211, -3196, -3180, -3164,
+	-3149, -3132, -3116, -3100, -3084, -3067, -3051, -3034, -3017, -3000, -2983, -2966, -2949, -2931, -2914, -2896,
+	-2878, -2861, -2843, -2825, -2806, -2788, -2770, -2751, -2733, -2714, -2695, -2677, -2658, -2638, -2619, -2600,
+	-2581, -2561, -2542, -2522, -2502, -2482, -2462, -2442, -2422, -2402, -2382, -2361, -2341, -2320, -2300, -2279,
+	-2258, -2237, -2216, -2195, -2174, -2153, -2131, -2110, -2088, -2067, -2045, -2023, -2002, -1980, -1958, -1936,
+	-1914, -1891, -1869, -1847, -1825, -1802, -1780, -1757, -1734, -1712, -1689, -1666, -1643, -1620, -1597, -1574,
+	-1551, -1528, -1504, -1481, -1458, -1434, -1411, -1387, -1364, -1340, -1316, -1292, -1269, -1245, -1221, -1197,
+	-1173, -1149, -1125, -1101, -1077, -1052, -1028, -1004, -980, -955, -931, -907, -882, -858, -833, -809,
+	-784, -759, -735, -710, -685, -661, -636, -611, -586, -562, -537, -512, -487, -462, -437, -412,
+	-387, -362, -337, -312, -287, -262, -237, -212, -187, -162, -137, -112, -87, -62, -37, -12,
+	12, 37, 62, 87, 112, 137, 162, 187, 212, 237, 262, 287, 312, 337, 362, 387,
+	412, 437, 462, 487, 512, 537, 562, 586, 611, 636, 661, 685, 710, 735, 759, 784,
+	809, 833, 858, 882, 907, 931, 955, 980, 1004, 1028, 1052, 1077, 1101, 1125, 1149, 1173,
+	1197, 1221, 1245, 1269, 1292, 1316, 1340, 1364, 1387, 1411, 1434, 1458, 1481, 1504, 1528, 1551,
+	1574, 1597, 1620, 1643, 1666, 1689, 1712, 1734, 1757, 1780, 1802, 1825, 1847, 1869, 1891, 1914,
+	1936, 1958, 1980, 2002, 2023, 2045, 2067, 2088, 2110, 2131, 2153, 2174, 2195, 2216, 2237, 2258,
+	2279, 2300, 2320, 2341, 2361, 2382, 2402, 2422, 2442, 2462, 2482, 2502, 2522, 2542, 2561, 2581,
+	2600, 2619, 2638, 2658, 2677, 2695, 2714, 2733, 2751, 2770, 2788, 2806, 2825, 2843, 2861, 2878,
+	2896, 2914, 2931, 2949, 2966, 2983, 3000, 3017, 3034, 3051, 3067, 3084, 3100, 3116, 3132, 3149,
+	3164, 3180, 3196, 3211, 3227, 3242, 3257, 3272, 3287, 3302, 3317, 3331, 3346, 3360, 3374, 3388,
+	3402, 3416, 3430, 3443, 3457, 3470, 3483, 3496, 3509, 3522, 3534, 3547, 3559, 3571, 3583, 3595,
+	3607, 3619, 3630, 3642, 3653, 3664, 3675, 3686, 3697, 3707, 3718, 3728, 3738, 3748, 3758, 3768,
+	3777, 3787, 3796, 3805, 3814, 3823, 3832, 3841, 3849, 3857, 3865, 3873, 3881, 3889, 3897, 3904,
+	3911, 3918, 3925, 3932, 3939, 3945, 3952, 3958, 3964, 3970, 3976, 3982, 3987, 3992, 3998, 4003,
+	4007, 4012, 4017, 4021, 4025, 4030, 4034, 4037, 4041, 4045, 4048, 4051, 4054, 4057, 4060, 4063,
+	4065, 4067, 4069, 4071, 4073, 4075, 4077, 4078, 4079, 4080, 4081, 4082, 4083, 4083, 4083, 4083,
+	4083, 4083, 4083, 4083, 4082, 4081, 4080, 4079, 4078, 4077, 4075, 4073, 4071, 4069, 4067, 4065,
+	4063, 4060, 4057, 4054, 4051, 4048, 4045, 4041, 4037, 4034, 4030, 4025, 4021, 4017, 4012, 4007,
+	4003, 3998, 3992, 3987, 3982, 3976, 3970, 3964, 3958, 3952, 3945, 3939, 3932, 3925, 3918, 3911,
+	3904, 3897, 3889, 3881, 3873, 3865, 3857, 3849, 3841, 3832, 3823, 3814, 3805, 3796, 3787, 3777,
+	3768, 3758, 3748, 3738, 3728, 3718, 3707, 3697, 3686, 3675, 3664, 3653, 3642, 3630, 3619, 3607,
+	3595, 3583, 3571, 3559, 3547, 3534, 3522, 3509, 3496, 3483, 3470, 3457, 3443, 3430, 3416, 3402,
+	3388, 3374, 3360, 3346, 3331, 3317, 3302, 3287, 3272, 3257, 3242, 3227, 3211, 3196, 3180, 3164,
+	3149, 3132, 3116, 3100, 3084, 3067, 3051, 3034, 3017, 3000, 2983, 2966, 2949, 2931, 2914, 2896,
+	2878, 2861, 2843, 2825, 2806, 2788, 2770, 2751, 2733, 2714, 2695, 2677, 2658, 2638, 2619, 2600,
+	2581, 2561, 2542, 2522, 2502, 2482, 2462, 2442, 2422, 2402, 2382, 2361, 2341, 2320, 2300, 2279,
+	2258, 2237, 2216, 2195, 2174, 2153, 2131, 2110, 2088, 2067, 2045, 2023, 2002, 1980, 1958, 1936,
+	1914, 1891, 1869, 1847, 1825, 1802, 1780, 1757, 1734, 1712, 1689, 1666, 1643, 1620, 1597, 1574,
+	1551, 1528, 1504, 1481, 1458, 1434, 1411, 1387, 1364, 1340, 1316, 1292, 1269, 1245, 1221, 1197,
+	1173, 1149, 1125, 1101, 1077, 1052, 1028, 1004, 980, 955, 931, 907, 882, 858, 833, 809,
+	784, 759, 735, 710, 685, 661, 636, 611, 586, 562, 537, 512, 487, 462, 437, 412,
+	387, 362, 337, 312, 287, 262, 237, 212, 187, 162, 137, 112, 87, 62, 37, 12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-16, -17, -17, -17, -18, -18, -19, -19, -19, -20, -20, -21, -21, -22, -22, -23,
+	-23, -24, -24, -25, -25, -26, -26, -27, -27, -28, -29, -29, -30, -30, -31, -32,
+	-33, -33, -34, -35, -35, -36, -37, -38, -39, -40, -40, -41, -42, -43, -44, -45,
+	-46, -47, -48, -49, -50, -51, -52, -54, -55, -56, -57, -58, -60, -61, -62, -64,
+	-65, -66, -68, -69, -71, -72, -74, -76, -77, -79, -81, -83, -84, -86, -88, -90,
+	-92, -94, -96, -98, -100, -103, -105, -107, -109, -112, -114, -117, -119, -122, -125, -127,
+	-130, -133, -136, -139, -142, -145, -148, -151, -155, -158, -162, -165, -169, -172, -176, -180,
+	-184, -188, -192, -196, -201, -205, -210, -214, -219, -224, -228, -233, -239, -244, -249, -255,
+	-260, -266, -272, -278, -284, -290, -296, -303, -309, -316, -323, -330, -337, -345, -352, -360,
+	-368, -376, -384, -393, -401, -410, -419, -428, -438, -447, -457, -467, -477, -488, -498, -509,
+	-520, -532, -543, -555, -567, -580, -593, -606, -619, -632, -646, -660, -675, -690, -705, -720,
+	-736, -752, -769, -785, -803, -820, -838, -856, -875, -894, -914, -934, -954, -975, -997, -1018,
+	-1041, -1064, -1087, -1111, -1135, -1160, -1185, -1211, -1238, -1265, -1293, -1321, -1350, -1379, -1409, -1440,
+	-1472, -1504, -1537, -1571, -1605, -1640, -1676, -1713, -1750, -1789, -1828, -1868, -1909, -1951, -1993, -2037,
+	-2082, -2127, -2174, -2221, -2270, -2320, -2370, -2422, -2475, -2530, -2585, -2642, -2699, -2759, -2819, -2881,
+	-2944, -3008, -3074, -3141, -3210, -3281, -3352, -3426, -3501, -3577, -3656, -3736, -3818, -3901, -3987, -4074,
+	4074, 3987, 3901, 3818, 3736, 3656, 3577, 3501, 3426, 3352, 3281, 3210, 3141, 3074, 3008, 2944,
+	2881, 2819, 2759, 2699, 2642, 2585, 2530, 2475, 2422, 2370, 2320, 2270, 2221, 2174, 2127, 2082,
+	2037, 1993, 1951, 1909, 1868, 1828, 1789, 1750, 1713, 1676, 1640, 1605, 1571, 1537, 1504, 1472,
+	1440, 1409, 1379, 1350, 1321, 1293, 1265, 1238, 1211, 1185, 1160, 1135, 1111, 1087, 1064, 1041,
+	1018, 997, 975, 954, 934, 914, 894, 875, 856, 838, 820, 803, 785, 769, 752, 736,
+	720, 705, 690, 675, 660, 646, 632, 619, 606, 593, 580, 567, 555, 543, 532, 520,
+	509, 498, 488, 477, 467, 457, 447, 438, 428, 419, 410, 401, 393, 384, 376, 368,
+	360, 352, 345, 337, 330, 323, 316, 309, 303, 296, 290, 284, 278, 272, 266, 260,
+	255, 249, 244, 239, 233, 228, 224, 219, 214, 210, 205, 201, 196, 192, 188, 184,
+	180, 176, 172, 169, 165, 162, 158, 155, 151, 148, 145, 142, 139, 136, 133, 130,
+	127, 125, 122, 119, 117, 114, 112, 109, 107, 105, 103, 100, 98, 96, 94, 92,
+	90, 88, 86, 84, 83, 81, 79, 77, 76, 74, 72, 71, 69, 68, 66, 65,
+	64, 62, 61, 60, 58, 57, 56, 55, 54, 52, 51, 50, 49, 48, 47, 46,
+	45, 44, 43, 42, 41, 40, 40, 39, 38, 37, 36, 35, 35, 34, 33, 33,
+	32, 31, 30, 30, 29, 29, 28, 27, 27, 26, 26, 25, 25, 24, 24, 23,
+	23, 22, 22, 21, 21, 20, 20, 19, 19, 19, 18, 18, 17, 17, 17, 16,
+	12, 37, 62, 87, 112, 137, 162, 187, 212, 237, 262, 287, 312, 337, 362, 387,
+	412, 437, 462, 487, 512, 537, 562, 586, 611, 636, 661, 685, 710, 735, 759, 784,
+	809, 833, 858, 882, 907, 931, 955, 980, 1004, 1028, 1052, 1077, 1101, 1125, 1149, 1173,
+	1197, 1221, 1245, 1269, 1292, 1316, 1340, 1364, 1387, 1411, 1434, 1458, 1481, 1504, 1528, 1551,
+	1574, 1597, 1620, 1643, 1666, 1689, 1712, 1734, 1757, 1780, 1802, 1825, 1847, 1869, 1891, 1914,
+	1936, 1958, 1980, 2002, 2023, 2045, 2067, 2088, 2110, 2131, 2153, 2174, 2195, 2216, 2237, 2258,
+	2279, 2300, 2320, 2341, 2361, 2382, 2402, 2422, 2442, 2462, 2482, 2502, 2522, 2542, 2561, 2581,
+	2600, 2619, 2638, 2658, 2677, 2695, 2714, 2733, 2751, 2770, 2788, 2806, 2825, 2843, 2861, 2878,
+	2896, 2914, 2931, 2949, 2966, 2983, 3000, 3017, 3034, 3051, 3067, 3084, 3100, 3116, 3132, 3149,
+	3164, 3180, 3196, 3211, 3227, 3242, 3257, 3272, 3287, 3302, 3317, 3331, 3346, 3360, 3374, 3388,
+	3402, 3416, 3430, 3443, 3457, 3470, 3483, 3496, 3509, 3522, 3534, 3547, 3559, 3571, 3583, 3595,
+	3607, 3619, 3630, 3642, 3653, 3664, 3675, 3686, 3697, 3707, 3718, 3728, 3738, 3748, 3758, 3768,
+	3777, 3787, 3796, 3805, 3814, 3823, 3832, 3841, 3849, 3857, 3865, 3873, 3881, 3889, 3897, 3904,
+	3911, 3918, 3925, 3932, 3939, 3945, 3952, 3958, 3964, 3970, 3976, 3982, 3987, 3992, 3998, 4003,
+	4007, 4012, 4017, 4021, 4025, 4030, 4034, 4037, 4041, 4045, 4048, 4051, 4054, 4057, 4060, 4063,
+	4065, 4067, 4069, 4071, 4073, 4075, 4077, 4078, 4079, 4080, 4081, 4082, 4083, 4083, 4083, 4083,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	12, 62, 112, 162, 212, 262, 312, 362, 412, 462, 512, 562, 611, 661, 710, 759,
+	809, 858, 907, 955, 1004, 1052, 1101, 1149, 1197, 1245, 1292, 1340, 1387, 1434, 1481, 1528,
+	1574, 1620, 1666, 1712, 1757, 1802, 1847, 1891, 1936, 1980, 2023, 2067, 2110, 2153, 2195, 2237,
+	2279, 2320, 2361, 2402, 2442, 2482, 2522, 2561, 2600, 2638, 2677, 2714, 2751, 2788, 2825, 2861,
+	2896, 2931, 2966, 3000, 3034, 3067, 3100, 3132, 3164, 3196, 3227, 3257, 3287, 3317, 3346, 3374,
+	3402, 3430, 3457, 3483, 3509, 3534, 3559, 3583, 3607, 3630, 3653, 3675, 3697, 3718, 3738, 3758,
+	3777, 3796, 3814, 3832, 3849, 3865, 3881, 3897, 3911, 3925, 3939, 3952, 3964, 3976, 3987, 3998,
+	4007, 4017, 4025, 4034, 4041, 4048, 4054, 4060, 4065, 4069, 4073, 4077, 4079, 4081, 4083, 4083,
+	4083, 4083, 4082, 4080, 4078, 4075, 4071, 4067, 4063, 4057, 4051, 4045, 4037, 4030, 4021, 4012,
+	4003, 3992, 3982, 3970, 3958, 3945, 3932, 3918, 3904, 3889, 3873, 3857, 3841, 3823, 3805, 3787,
+	3768, 3748, 3728, 3707, 3686, 3664, 3642, 3619, 3595, 3571, 3547, 3522, 3496, 3470, 3443, 3416,
+	3388, 3360, 3331, 3302, 3272, 3242, 3211, 3180, 3149, 3116, 3084, 3051, 3017, 2983, 2949, 2914,
+	2878, 2843, 2806, 2770, 2733, 2695, 2658, 2619, 2581, 2542, 2502, 2462, 2422, 2382, 2341, 2300,
+	2258, 2216, 2174, 2131, 2088, 2045, 2002, 1958, 1914, 1869, 1825, 1780, 1734, 1689, 1643, 1597,
+	1551, 1504, 1458, 1411, 1364, 1316, 1269, 1221, 1173, 1125, 1077, 1028, 980, 931, 882, 833,
+	784, 735, 685, 636, 586, 537, 487, 437, 387, 337, 287, 237, 187, 137, 87, 37,
+	-12, -62, -112, -162, -212, -262, -312, -362, -412, -462, -512, -562, -611, -661, -710, -759,
+	-809, -858, -907, -955, -1004, -1052, -1101, -1149, -1197, -1245, -1292, -1340, -1387, -1434, -1481, -1528,
+	-1574, -1620, -1666, -1712, -1757, -1802, -1847, -1891, -1936, -1980, -2023, -2067, -2110, -2153, -2195, -2237,
+	-2279, -2320, -2361, -2402, -2442, -2482, -2522, -2561, -2600, -2638, -2677, -2714, -2751, -2788, -2825, -2861,
+	-2896, -2931, -2966, -3000, -3034, -3067, -3100, -3132, -3164, -3196, -3227, -3257, -3287, -3317, -3346, -3374,
+	-3402, -3430, -3457, -3483, -3509, -3534, -3559, -3583, -3607, -3630, -3653, -3675, -3697, -3718, -3738, -3758,
+	-3777, -3796, -3814, -3832, -3849, -3865, -3881, -3897, -3911, -3925, -3939, -3952, -3964, -3976, -3987, -3998,
+	-4007, -4017, -4025, -4034, -4041, -4048, -4054, -4060, -4065, -4069, -4073, -4077, -4079, -4081, -4083, -4083,
+	-4083, -4083, -4082, -4080, -4078, -4075, -4071, -4067, -4063, -4057, -4051, -4045, -4037, -4030, -4021, -4012,
+	-4003, -3992, -3982, -3970, -3958, -3945, -3932, -3918, -3904, -3889, -3873, -3857, -3841, -3823, -3805, -3787,
+	-3768, -3748, -3728, -3707, -3686, -3664, -3642, -3619, -3595, -3571, -3547, -3522, -3496, -3470, -3443, -3416,
+	-3388, -3360, -3331, -3302, -3272, -3242, -3211, -3180, -3149, -3116, -3084, -3051, -3017, -2983, -2949, -2914,
+	-2878, -2843, -2806, -2770, -2733, -2695, -2658, -2619, -2581, -2542, -2502, -2462, -2422, -2382, -2341, -2300,
+	-2258, -2216, -2174, -2131, -2088, -2045, -2002, -1958, -1914, -1869, -1825, -1780, -1734, -1689, -1643, -1597,
+	-1551, -1504, -1458, -1411, -1364, -1316, -1269, -1221, -1173, -1125, -1077, -1028, -980, -931, -882, -833,
+	-784, -735, -685, -636, -586, -537, -487, -437, -387, -337, -287, -237, -187, -137, -87, -37,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	-12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12, -12,
+	12, 62, 112, 162, 212, 262, 312, 362, 412, 462, 512, 562, 611, 661, 710, 759,
+	809, 858, 907, 955, 1004, 1052, 1101, 1149, 1197, 1245, 1292, 1340, 1387, 1434, 1481, 1528,
+	1574, 1620, 1666, 1712, 1757, 1802, 1847, 1891, 1936, 1980, 2023, 2067, 2110, 2153, 2195, 2237,
+	2279, 2320, 2361, 2402, 2442, 2482, 2522, 2561, 2600, 2638, 2677, 2714, 2751, 2788, 2825, 2861,
+	2896, 2931, 2966, 3000, 3034, 3067, 3100, 3132, 3164, 3196, 3227, 3257, 3287, 3317, 3346, 3374,
+	3402, 3430, 3457, 3483, 3509, 3534, 3559, 3583, 3607, 3630, 3653, 3675, 3697, 3718, 3738, 3758,
+	3777, 3796, 3814, 3832, 3849, 3865, 3881, 3897, 3911, 3925, 3939, 3952, 3964, 3976, 3987, 3998,
+	4007, 4017, 4025, 4034, 4041, 4048, 4054, 4060, 4065, 4069, 4073, 4077, 4079, 4081, 4083, 4083,
+	4083, 4083, 4082, 4080, 4078, 4075, 4071, 4067, 4063, 4057, 4051, 4045, 4037, 4030, 4021, 4012,
+	4003, 3992, 3982, 3970, 3958, 3945, 3932, 3918, 3904, 3889, 3873, 3857, 3841, 3823, 3805, 3787,
+	3768, 3748, 3728, 3707, 3686, 3664, 3642, 3619, 3595, 3571, 3547, 3522, 3496, 3470, 3443, 3416,
+	3388, 3360, 3331, 3302, 3272, 3242, 3211, 3180, 3149, 3116, 3084, 3051, 3017, 2983, 2949, 2914,
+	2878, 2843, 2806, 2770, 2733, 2695, 2658, 2619, 2581, 2542, 2502, 2462, 2422, 2382, 2341, 2300,
+	2258, 2216, 2174, 2131, 2088, 2045, 2002, 1958, 1914, 1869, 1825, 1780, 1734, 1689, 1643, 1597,
+	1551, 1504, 1458, 1411, 1364, 1316, 1269, 1221, 1173, 1125, 1077, 1028, 980, 931, 882, 833,
+	784, 735, 685, 636, 586, 537, 487, 437, 387, 337, 287, 237, 187, 137, 87, 37,
+	12, 62, 112, 162, 212, 262, 312, 362, 412, 462, 512, 562, 611, 661, 710, 759,
+	809, 858, 907, 955, 1004, 1052, 1101, 1149, 1197, 1245, 1292, 1340, 1387, 1434, 1481, 1528,
+	1574, 1620, 1666, 1712, 1757, 1802, 1847, 1891, 1936, 1980, 2023, 2067, 2110, 2153, 2195, 2237,
+	2279, 2320, 2361, 2402, 2442, 2482, 2522, 2561, 2600, 2638, 2677, 2714, 2751, 2788, 2825, 2861,
+	2896, 2931, 2966, 3000, 3034, 3067, 3100, 3132, 3164, 3196, 3227, 3257, 3287, 3317, 3346, 3374,
+	3402, 3430, 3457, 3483, 3509, 3534, 3559, 3583, 3607, 3630, 3653, 3675, 3697, 3718, 3738, 3758,
+	3777, 3796, 3814, 3832, 3849, 3865, 3881, 3897, 3911, 3925, 3939, 3952, 3964, 3976, 3987, 3998,
+	4007, 4017, 4025, 4034, 4041, 4048, 4054, 4060, 4065, 4069, 4073, 4077, 4079, 4081, 4083, 4083,
+	4083, 4083, 4082, 4080, 4078, 4075, 4071, 4067, 4063, 4057, 4051, 4045, 4037, 4030, 4021, 4012,
+	4003, 3992, 3982, 3970, 3958, 3945, 3932, 3918, 3904, 3889, 3873, 3857, 3841, 3823, 3805, 3787,
+	3768, 3748, 3728, 3707, 3686, 3664, 3642, 3619, 3595, 3571, 3547, 3522, 3496, 3470, 3443, 3416,
+	3388, 3360, 3331, 3302, 3272, 3242, 3211, 3180, 3149, 3116, 3084, 3051, 3017, 2983, 2949, 2914,
+	2878, 2843, 2806, 2770, 2733, 2695, 2658, 2619, 2581, 2542, 2502, 2462, 2422, 2382, 2341, 2300,
+	2258, 2216, 2174, 2131, 2088, 2045, 2002, 1958, 1914, 1869, 1825, 1780, 1734, 1689, 1643, 1597,
+	1551, 1504, 1458, 1411, 1364, 1316, 1269, 1221, 1173, 1125, 1077, 1028, 980, 931, 882, 833,
+	784, 735, 685, 636, 586, 537, 487, 437, 387, 337, 287, 237, 187, 137, 87, 37,
+};
+
+//Table used by wmTableLog
+static const Bit16s LogWaveTable[ 4096 ] = {
+	-30631, -31037, -31225, -31349, -31442, -31516, -31578, -31631, -31677, -31718, -31755, -31789, -31819, -31848, -31874, -31899,
+	-31922, -31943, -31964, -31983, -32001, -32019, -32036, -32051, -32067, -32081, -32096, -32109, -32122, -32135, -32147, -32159,
+	-32170, -32181, -32192, -32202, -32212, -32222, -32232, -32241, -32250, -32259, -32267, -32276, -32284, -32292, -32300, -32307,
+	-32315, -32322, -32329, -32336, -32343, -32350, -32357, -32363, -32369, -32376, -32382, -32388, -32393, -32399, -32405, -32410,
+	-32416, -32421, -32427, -32432, -32437, -32442, -32447, -32452, -32457, -32461, -32466, -32471, -32475, -32479, -32484, -32488,
+	-32492, -32497, -32501, -32505, -32509, -32513, -32517, -32520, -32524, -32528, -32532, -32535, -32539, -32542, -32546, -32549,
+	-32553, -32556, -32559, -32563, -32566, -32569, -32572, -32575, -32578, -32581, -32584, -32587, -32590, -32593, -32596, -32599,
+	-32601, -32604, -32607, -32609, -32612, -32615, -32617, -32620, -32622, -32625, -32627, -32630, -32632, -32634, -32637, -32639,
+	-32641, -32643, -32646, -32648, -32650, -32652, -32654, -32656, -32658, -32660, -32662, -32664, -32666, -32668, -32670, -32672,
+	-32674, -32676, -32677, -32679, -32681, -32683, -32685, -32686, -32688, -32690, -32691, -32693, -32694, -32696, -32698, -32699,
+	-32701, -32702, -32704, -32705, -32706, -32708, -32709, -32711, -32712, -32713, -32715, -32716, -32717, -32719, -32720, -32721,
+	-32722, -32723, -32725, -32726, -32727, -32728, -32729, -32730, -32731, -32732, -32733, -32734, -32735, -32736, -32737, -32738,
+	-32739, -32740, -32741, -32742, -32743, -32744, -32745, -32745, -32746, -32747, -32748, -32748, -32749, -32750, -32751, -32751,
+	-32752, -32753, -32753, -32754, -32755, -32755, -32756, -32756, -32757, -32758, -32758, -32759, -32759, -32760, -32760, -32761,
+	-32761, -32761, -32762, -32762, -32763, -32763, -32763, -32764, -32764, -32764, -32765, -32765, -32765, -32766, -32766, -32766,
+	-32766, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+	-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32766,
+	-32766, -32766, -32766, -32765, -32765, -32765, -32764, -32764, -32764, -32763, -32763, -32763, -32762, -32762, -32761, -32761,
+	-32761, -32760, -32760, -32759, -32759, -32758, -32758, -32757, -32756, -32756, -32755, -32755, -32754, -32753, -32753, -32752,
+	-32751, -32751, -32750, -32749, -32748, -32748, -32747, -32746, -32745, -32745, -32744, -32743, -32742, -32741, -32740, -32739,
+	-32738, -32737, -32736, -32735, -32734, -32733, -32732, -32731, -32730, -32729, -32728, -32727, -32726, -32725, -32723, -32722,
+	-32721, -32720, -32719, -32717, -32716, -32715, -32713, -32712, -32711, -32709, -32708, -32706, -32705, -32704, -32702, -32701,
+	-32699, -32698, -32696, -32694, -32693, -32691, -32690, -32688, -32686, -32685, -32683, -32681, -32679, -32677, -32676, -32674,
+	-32672, -32670, -32668, -32666, -32664, -32662, -32660, -32658, -32656, -32654, -32652, -32650, -32648, -32646, -32643, -32641,
+	-32639, -32637, -32634, -32632, -32630, -32627, -32625, -32622, -32620, -32617, -32615, -32612, -32609, -32607, -32604, -32601,
+	-32599, -32596, -32593, -32590, -32587, -32584, -32581, -32578, -32575, -32572, -32569, -32566, -32563, -32559, -32556, -32553,
+	-32549, -32546, -32542, -32539, -32535, -32532, -32528, -32524, -32520, -32517, -32513, -32509, -32505, -32501, -32497, -32492,
+	-32488, -32484, -32479, -32475, -32471, -32466, -32461, -32457, -32452, -32447, -32442, -32437, -32432, -32427, -32421, -32416,
+	-32410, -32405, -32399, -32393, -32388, -32382, -32376, -32369, -32363, -32357, -32350, -32343, -32336, -32329, -32322, -32315,
+	-32307, -32300, -32292, -32284, -32276, -32267, -32259, -32250, -32241, -32232, -32222, -32212, -32202, -32192, -32181, -32170,
+	-32159, -32147, -32135, -32122, -32109, -32096, -32081, -32067, -32051, -32036, -32019, -32001, -31983, -31964, -31943, -31922,
+	-31899, -31874, -31848, -31819, -31789, -31755, -31718, -31677, -31631, -31578, -31516, -31442, -31349, -31225, -31037, -30631,
+	2137, 1731, 1543, 1419, 1326, 1252, 1190, 1137, 1091, 1050, 1013, 979, 949, 920, 894, 869,
+	846, 825, 804, 785, 767, 749, 732, 717, 701, 687, 672, 659, 646, 633, 621, 609,
+	598, 587, 576, 566, 556, 546, 536, 527, 518, 509, 501, 492, 484, 476, 468, 461,
+	453, 446, 439, 432, 425, 418, 411, 405, 399, 392, 386, 380, 375, 369, 363, 358,
+	352, 347, 341, 336, 331, 326, 321, 316, 311, 307, 302, 297, 293, 289, 284, 280,
+	276, 271, 267, 263, 259, 255, 251, 248, 244, 240, 236, 233, 229, 226, 222, 219,
+	215, 212, 209, 205, 202, 199, 196, 193, 190, 187, 184, 181, 178, 175, 172, 169,
+	167, 164, 161, 159, 156, 153, 151, 148, 146, 143, 141, 138, 136, 134, 131, 129,
+	127, 125, 122, 120, 118, 116, 114, 112, 110, 108, 106, 104, 102, 100, 98, 96,
+	94, 92, 91, 89, 87, 85, 83, 82, 80, 78, 77, 75, 74, 72, 70, 69,
+	67, 66, 64, 63, 62, 60, 59, 57, 56, 55, 53, 52, 51, 49, 48, 47,
+	46, 45, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30,
+	29, 28, 27, 26, 25, 24, 23, 23, 22, 21, 20, 20, 19, 18, 17, 17,
+	16, 15, 15, 14, 13, 13, 12, 12, 11, 10, 10, 9, 9, 8, 8, 7,
+	7, 7, 6, 6, 5, 5, 5, 4, 4, 4, 3, 3, 3, 2, 2, 2,
+	2, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 2,
+	2, 2, 2, 3, 3, 3, 4, 4, 4, 5, 5, 5, 6, 6, 7, 7,
+	7, 8, 8, 9, 9, 10, 10, 11, 12, 12, 13, 13, 14, 15, 15, 16,
+	17, 17, 18, 19, 20, 20, 21, 22, 23, 23, 24, 25, 26, 27, 28, 29,
+	30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 45, 46,
+	47, 48, 49, 51, 52, 53, 55, 56, 57, 59, 60, 62, 63, 64, 66, 67,
+	69, 70, 72, 74, 75, 77, 78, 80, 82, 83, 85, 87, 89, 91, 92, 94,
+	96, 98, 100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 125, 127,
+	129, 131, 134, 136, 138, 141, 143, 146, 148, 151, 153, 156, 159, 161, 164, 167,
+	169, 172, 175, 178, 181, 184, 187, 190, 193, 196, 199, 202, 205, 209, 212, 215,
+	219, 222, 226, 229, 233, 236, 240, 244, 248, 251, 255, 259, 263, 267, 271, 276,
+	280, 284, 289, 293, 297, 302, 307, 311, 316, 321, 326, 331, 336, 341, 347, 352,
+	358, 363, 369, 375, 380, 386, 392, 399, 405, 411, 418, 425, 432, 439, 446, 453,
+	461, 468, 476, 484, 492, 501, 509, 518, 527, 536, 546, 556, 566, 576, 587, 598,
+	609, 621, 633, 646, 659, 672, 687, 701, 717, 732, 749, 767, 785, 804, 825, 846,
+	869, 894, 920, 949, 979, 1013, 1050, 1091, 1137, 1190, 1252, 1326, 1419, 1543, 1731, 2137,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30728, -30736, -30744, -30752, -30760, -30768, -30776, -30784, -30792, -30800, -30808, -30816, -30824, -30832, -30840, -30848,
+	-30856, -30864, -30872, -30880, -30888, -30896, -30904, -30912, -30920, -30928, -30936, -30944, -30952, -30960, -30968, -30976,
+	-30984, -30992, -31000, -31008, -31016, -31024, -31032, -31040, -31048, -31056, -31064, -31072, -31080, -31088, -31096, -31104,
+	-31112, -31120, -31128, -31136, -31144, -31152, -31160, -31168, -31176, -31184, -31192, -31200, -31208, -31216, -31224, -31232,
+	-31240, -31248, -31256, -31264, -31272, -31280, -31288, -31296, -31304, -31312, -31320, -31328, -31336, -31344, -31352, -31360,
+	-31368, -31376, -31384, -31392, -31400, -31408, -31416, -31424, -31432, -31440, -31448, -31456, -31464, -31472, -31480, -31488,
+	-31496, -31504, -31512, -31520, -31528, -31536, -31544, -31552, -31560, -31568, -31576, -31584, -31592, -31600, -31608, -31616,
+	-31624, -31632, -31640, -31648, -31656, -31664, -31672, -31680, -31688, -31696, -31704, -31712, -31720, -31728, -31736, -31744,
+	-31752, -31760, -31768, -31776, -31784, -31792, -31800, -31808, -31816, -31824, -31832, -31840, -31848, -31856, -31864, -31872,
+	-31880, -31888, -31896, -31904, -31912, -31920, -31928, -31936, -31944, -31952, -31960, -31968, -31976, -31984, -31992, -32000,
+	-32008, -32016, -32024, -32032, -32040, -32048, -32056, -32064, -32072, -32080, -32088, -32096, -32104, -32112, -32120, -32128,
+	-32136, -32144, -32152, -32160, -32168, -32176, -32184, -32192, -32200, -32208, -32216, -32224, -32232, -32240, -32248, -32256,
+	-32264, -32272, -32280, -32288, -32296, -32304, -32312, -32320, -32328, -32336, -32344, -32352, -32360, -32368, -32376, -32384,
+	-32392, -32400, -32408, -32416, -32424, -32432, -32440, -32448, -32456, -32464, -32472, -32480, -32488, -32496, -32504, -32512,
+	-32520, -32528, -32536, -32544, -32552, -32560, -32568, -32576, -32584, -32592, -32600, -32608, -32616, -32624, -32632, -32640,
+	-32648, -32656, -32664, -32672, -32680, -32688, -32696, -32704, -32712, -32720, -32728, -32736, -32744, -32752, -32760, -32768,
+	0, 8, 16, 24, 32, 40, 48, 56, 64, 72, 80, 88, 96, 104, 112, 120,
+	128, 136, 144, 152, 160, 168, 176, 184, 192, 200, 208, 216, 224, 232, 240, 248,
+	256, 264, 272, 280, 288, 296, 304, 312, 320, 328, 336, 344, 352, 360, 368, 376,
+	384, 392, 400, 408, 416, 424, 432, 440, 448, 456, 464, 472, 480, 488, 496, 504,
+	512, 520, 528, 536, 544, 552, 560, 568, 576, 584, 592, 600, 608, 616, 624, 632,
+	640, 648, 656, 664, 672, 680, 688, 696, 704, 712, 720, 728, 736, 744, 752, 760,
+	768, 776, 784, 792, 800, 808, 816, 824, 832, 840, 848, 856, 864, 872, 880, 888,
+	896, 904, 912, 920, 928, 936, 944, 952, 960, 968, 976, 984, 992, 1000, 1008, 1016,
+	1024, 1032, 1040, 1048, 1056, 1064, 1072, 1080, 1088, 1096, 1104, 1112, 1120, 1128, 1136, 1144,
+	1152, 1160, 1168, 1176, 1184, 1192, 1200, 1208, 1216, 1224, 1232, 1240, 1248, 1256, 1264, 1272,
+	1280, 1288, 1296, 1304, 1312, 1320, 1328, 1336, 1344, 1352, 1360, 1368, 1376, 1384, 1392, 1400,
+	1408, 1416, 1424, 1432, 1440, 1448, 1456, 1464, 1472, 1480, 1488, 1496, 1504, 1512, 1520, 1528,
+	1536, 1544, 1552, 1560, 1568, 1576, 1584, 1592, 1600, 1608, 1616, 1624, 1632, 1640, 1648, 1656,
+	1664, 1672, 1680, 1688, 1696, 1704, 1712, 1720, 1728, 1736, 1744, 1752, 1760, 1768, 1776, 1784,
+	1792, 1800, 1808, 1816, 1824, 1832, 1840, 1848, 1856, 1864, 1872, 1880, 1888, 1896, 1904, 1912,
+	1920, 1928, 1936, 1944, 1952, 1960, 1968, 1976, 1984, 1992, 2000, 2008, 2016, 2024, 2032, 2040,
+	2137, 1731, 1543, 1419, 1326, 1252, 1190, 1137, 1091, 1050, 1013, 979, 949, 920, 894, 869,
+	846, 825, 804, 785, 767, 749, 732, 717, 701, 687, 672, 659, 646, 633, 621, 609,
+	598, 587, 576, 566, 556, 546, 536, 527, 518, 509, 501, 492, 484, 476, 468, 461,
+	453, 446, 439, 432, 425, 418, 411, 405, 399, 392, 386, 380, 375, 369, 363, 358,
+	352, 347, 341, 336, 331, 326, 321, 316, 311, 307, 302, 297, 293, 289, 284, 280,
+	276, 271, 267, 263, 259, 255, 251, 248, 244, 240, 236, 233, 229, 226, 222, 219,
+	215, 212, 209, 205, 202, 199, 196, 193, 190, 187, 184, 181, 178, 175, 172, 169,
+	167, 164, 161, 159, 156, 153, 151, 148, 146, 143, 141, 138, 136, 134, 131, 129,
+	127, 125, 122, 120, 118, 116, 114, 112, 110, 108, 106, 104, 102, 100, 98, 96,
+	94, 92, 91, 89, 87, 85, 83, 82, 80, 78, 77, 75, 74, 72, 70, 69,
+	67, 66, 64, 63, 62, 60, 59, 57, 56, 55, 53, 52, 51, 49, 48, 47,
+	46, 45, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30,
+	29, 28, 27, 26, 25, 24, 23, 23, 22, 21, 20, 20, 19, 18, 17, 17,
+	16, 15, 15, 14, 13, 13, 12, 12, 11, 10, 10, 9, 9, 8, 8, 7,
+	7, 7, 6, 6, 5, 5, 5, 4, 4, 4, 3, 3, 3, 2, 2, 2,
+	2, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	2137, 1543, 1326, 1190, 1091, 1013, 949, 894, 846, 804, 767, 732, 701, 672, 646, 621,
+	598, 576, 556, 536, 518, 501, 484, 468, 453, 439, 425, 411, 399, 386, 375, 363,
+	352, 341, 331, 321, 311, 302, 293, 284, 276, 267, 259, 251, 244, 236, 229, 222,
+	215, 209, 202, 196, 190, 184, 178, 172, 167, 161, 156, 151, 146, 141, 136, 131,
+	127, 122, 118, 114, 110, 106, 102, 98, 94, 91, 87, 83, 80, 77, 74, 70,
+	67, 64, 62, 59, 56, 53, 51, 48, 46, 43, 41, 39, 37, 35, 33, 31,
+	29, 27, 25, 23, 22, 20, 19, 17, 16, 15, 13, 12, 11, 10, 9, 8,
+	7, 6, 5, 5, 4, 3, 3, 2, 2, 1, 1, 1, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 4, 4, 5, 6, 7,
+	7, 8, 9, 10, 12, 13, 14, 15, 17, 18, 20, 21, 23, 24, 26, 28,
+	30, 32, 34, 36, 38, 40, 42, 45, 47, 49, 52, 55, 57, 60, 63, 66,
+	69, 72, 75, 78, 82, 85, 89, 92, 96, 100, 104, 108, 112, 116, 120, 125,
+	129, 134, 138, 143, 148, 153, 159, 164, 169, 175, 181, 187, 193, 199, 205, 212,
+	219, 226, 233, 240, 248, 255, 263, 271, 280, 289, 297, 307, 316, 326, 336, 347,
+	358, 369, 380, 392, 405, 418, 432, 446, 461, 476, 492, 509, 527, 546, 566, 587,
+	609, 633, 659, 687, 717, 749, 785, 825, 869, 920, 979, 1050, 1137, 1252, 1419, 1731,
+	-30631, -31225, -31442, -31578, -31677, -31755, -31819, -31874, -31922, -31964, -32001, -32036, -32067, -32096, -32122, -32147,
+	-32170, -32192, -32212, -32232, -32250, -32267, -32284, -32300, -32315, -32329, -32343, -32357, -32369, -32382, -32393, -32405,
+	-32416, -32427, -32437, -32447, -32457, -32466, -32475, -32484, -32492, -32501, -32509, -32517, -32524, -32532, -32539, -32546,
+	-32553, -32559, -32566, -32572, -32578, -32584, -32590, -32596, -32601, -32607, -32612, -32617, -32622, -32627, -32632, -32637,
+	-32641, -32646, -32650, -32654, -32658, -32662, -32666, -32670, -32674, -32677, -32681, -32685, -32688, -32691, -32694, -32698,
+	-32701, -32704, -32706, -32709, -32712, -32715, -32717, -32720, -32722, -32725, -32727, -32729, -32731, -32733, -32735, -32737,
+	-32739, -32741, -32743, -32745, -32746, -32748, -32749, -32751, -32752, -32753, -32755, -32756, -32757, -32758, -32759, -32760,
+	-32761, -32762, -32763, -32763, -32764, -32765, -32765, -32766, -32766, -32767, -32767, -32767, -32768, -32768, -32768, -32768,
+	-32768, -32768, -32768, -32768, -32767, -32767, -32767, -32767, -32766, -32766, -32765, -32764, -32764, -32763, -32762, -32761,
+	-32761, -32760, -32759, -32758, -32756, -32755, -32754, -32753, -32751, -32750, -32748, -32747, -32745, -32744, -32742, -32740,
+	-32738, -32736, -32734, -32732, -32730, -32728, -32726, -32723, -32721, -32719, -32716, -32713, -32711, -32708, -32705, -32702,
+	-32699, -32696, -32693, -32690, -32686, -32683, -32679, -32676, -32672, -32668, -32664, -32660, -32656, -32652, -32648, -32643,
+	-32639, -32634, -32630, -32625, -32620, -32615, -32609, -32604, -32599, -32593, -32587, -32581, -32575, -32569, -32563, -32556,
+	-32549, -32542, -32535, -32528, -32520, -32513, -32505, -32497, -32488, -32479, -32471, -32461, -32452, -32442, -32432, -32421,
+	-32410, -32399, -32388, -32376, -32363, -32350, -32336, -32322, -32307, -32292, -32276, -32259, -32241, -32222, -32202, -32181,
+	-32159, -32135, -32109, -32081, -32051, -32019, -31983, -31943, -31899, -31848, -31789, -31718, -31631, -31516, -31349, -31037,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	-30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631, -30631,
+	2137, 1543, 1326, 1190, 1091, 1013, 949, 894, 846, 804, 767, 732, 701, 672, 646, 621,
+	598, 576, 556, 536, 518, 501, 484, 468, 453, 439, 425, 411, 399, 386, 375, 363,
+	352, 341, 331, 321, 311, 302, 293, 284, 276, 267, 259, 251, 244, 236, 229, 222,
+	215, 209, 202, 196, 190, 184, 178, 172, 167, 161, 156, 151, 146, 141, 136, 131,
+	127, 122, 118, 114, 110, 106, 102, 98, 94, 91, 87, 83, 80, 77, 74, 70,
+	67, 64, 62, 59, 56, 53, 51, 48, 46, 43, 41, 39, 37, 35, 33, 31,
+	29, 27, 25, 23, 22, 20, 19, 17, 16, 15, 13, 12, 11, 10, 9, 8,
+	7, 6, 5, 5, 4, 3, 3, 2, 2, 1, 1, 1, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 4, 4, 5, 6, 7,
+	7, 8, 9, 10, 12, 13, 14, 15, 17, 18, 20, 21, 23, 24, 26, 28,
+	30, 32, 34, 36, 38, 40, 42, 45, 47, 49, 52, 55, 57, 60, 63, 66,
+	69, 72, 75, 78, 82, 85, 89, 92, 96, 100, 104, 108, 112, 116, 120, 125,
+	129, 134, 138, 143, 148, 153, 159, 164, 169, 175, 181, 187, 193, 199, 205, 212,
+	219, 226, 233, 240, 248, 255, 263, 271, 280, 289, 297, 307, 316, 326, 336, 347,
+	358, 369, 380, 392, 405, 418, 432, 446, 461, 476, 492, 509, 527, 546, 566, 587,
+	609, 633, 659, 687, 717, 749, 785, 825, 869, 920, 979, 1050, 1137, 1252, 1419, 1731,
+	2137, 1543, 1326, 1190, 1091, 1013, 949, 894, 846, 804, 767, 732, 701, 672, 646, 621,
+	598, 576, 556, 536, 518, 501, 484, 468, 453, 439, 425, 411, 399, 386, 375, 363,
+	352, 341, 331, 321, 311, 302, 293, 284, 276, 267, 259, 251, 244, 236, 229, 222,
+	215, 209, 202, 196, 190, 184, 178, 172, 167, 161, 156, 151, 146, 141, 136, 131,
+	127, 122, 118, 114, 110, 106, 102, 98, 94, 91, 87, 83, 80, 77, 74, 70,
+	67, 64, 62, 59, 56, 53, 51, 48, 46, 43, 41, 39, 37, 35, 33, 31,
+	29, 27, 25, 23, 22, 20, 19, 17, 16, 15, 13, 12, 11, 10, 9, 8,
+	7, 6, 5, 5, 4, 3, 3, 2, 2, 1, 1, 1, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 4, 4, 5, 6, 7,
+	7, 8, 9, 10, 12, 13, 14, 15, 17, 18, 20, 21, 23, 24, 26, 28,
+	30, 32, 34, 36, 38, 40, 42, 45, 47, 49, 52, 55, 57, 60, 63, 66,
+	69, 72, 75, 78, 82, 85, 89, 92, 96, 100, 104, 108, 112, 116, 120, 125,
+	129, 134, 138, 143, 148, 153, 159, 164, 169, 175, 181, 187, 193, 199, 205, 212,
+	219, 226, 233, 240, 248, 255, 263, 271, 280, 289, 297, 307, 316, 326, 336, 347,
+	358, 369, 380, 392, 405, 418, 432, 446, 461, 476, 492, 509, 527, 546, 566, 587,
+	609, 633, 659, 687, 717, 749, 785, 825, 869, 920, 979, 1050, 1137, 1252, 1419, 1731,
+};
+
+static const Bit8u KslTable[ 128 ] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 12, 16, 20, 24, 28, 32,
+	0, 0, 0, 0, 0, 16, 20, 24, 32, 40, 44, 48, 52, 56, 60, 64,
+	0, 0, 0, 20, 32, 48, 52, 56, 64, 72, 76, 80, 84, 88, 92, 96,
+	0, 0, 32, 52, 64, 80, 84, 88, 96, 104, 108, 112, 116, 120, 124, 128,
+	0, 32, 64, 84, 96, 112, 116, 120, 128, 136, 140, 144, 148, 152, 156, 160,
+	0, 64, 96, 116, 128, 144, 148, 152, 160, 168, 172, 176, 180, 184, 188, 192,
+	0, 96, 128, 148, 160, 176, 180, 184, 192, 200, 204, 208, 212, 216, 220, 224,
+};
+
+static const Bit8u TremoloTable[ 52 ] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+	13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+	25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13,
+	12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+};
+
+//Noise value after 2^p steps, xor of the entries for every nibble
+static const Bit32u NoiseJumpTable[ 4096 ] = {
+	0x00000000, 0x00400181, 0x00000001, 0x00400180, 0x00000002, 0x00400183, 0x00000003, 0x00400182,
+	0x00000004, 0x00400185, 0x00000005, 0x00400184, 0x00000006, 0x00400187, 0x00000007, 0x00400186,
+	0x00000000, 0x00000008, 0x00000010, 0x00000018, 0x00000020, 0x00000028, 0x00000030, 0x00000038,
+	0x00000040, 0x00000048, 0x00000050, 0x00000058, 0x00000060, 0x00000068, 0x00000070, 0x00000078,
+	0x00000000, 0x00000080, 0x00000100, 0x00000180, 0x00000200, 0x00000280, 0x00000300, 0x00000380,
+	0x00000400, 0x00000480, 0x00000500, 0x00000580, 0x00000600, 0x00000680, 0x00000700, 0x00000780,
+	0x00000000, 0x00000800, 0x00001000, 0x00001800, 0x00002000, 0x00002800, 0x00003000, 0x00003800,
+	0x00004000, 0x00004800, 0x00005000, 0x00005800, 0x00006000, 0x00006800, 0x00007000, 0x00007800,
+	0x00000000, 0x00008000, 0x00010000, 0x00018000, 0x00020000, 0x00028000, 0x00030000, 0x00038000,
+	0x00040000, 0x00048000, 0x00050000, 0x00058000, 0x00060000, 0x00068000, 0x00070000, 0x00078000,
+	0x00000000, 0x00080000, 0x00100000, 0x00180000, 0x00200000, 0x00280000, 0x00300000, 0x00380000,
+	0x00400000, 0x00480000, 0x00500000, 0x00580000, 0x00600000, 0x00680000, 0x00700000, 0x00780000,
+	0x00000000, 0x00800000, 0x01000000, 0x01800000, 0x02000000, 0x02800000, 0x03000000, 0x03800000,
+	0x04000000, 0x04800000, 0x05000000, 0x05800000, 0x06000000, 0x06800000, 0x07000000, 0x07800000,
+	0x00000000, 0x08000000, 0x10000000, 0x18000000, 0x20000000, 0x28000000, 0x30000000, 0x38000000,
+	0x40000000, 0x48000000, 0x50000000, 0x58000000, 0x60000000, 0x68000000, 0x70000000, 0x78000000,
+	0x00000000, 0x00600141, 0x00400181, 0x002000c0, 0x00000001, 0x00600140, 0x00400180, 0x002000c1,
+	0x00000002, 0x00600143, 0x00400183, 0x002000c2, 0x00000003, 0x00600142, 0x00400182, 0x002000c3,
+	0x00000000, 0x00000004, 0x00000008, 0x0000000c, 0x00000010, 0x00000014, 0x00000018, 0x0000001c,
+	0x00000020, 0x00000024, 0x00000028, 0x0000002c, 0x00000030, 0x00000034, 0x00000038, 0x0000003c,
+	0x00000000, 0x00000040, 0x00000080, 0x000000c0, 0x00000100, 0x00000140, 0x00000180, 0x000001c0,
+	0x00000200, 0x00000240, 0x00000280, 0x000002c0, 0x00000300, 0x00000340, 0x00000380, 0x000003c0,
+	0x00000000, 0x00000400, 0x00000800, 0x00000c00, 0x00001000, 0x00001400, 0x00001800, 0x00001c00,
+	0x00002000, 0x00002400, 0x00002800, 0x00002c00, 0x00003000, 0x00003400, 0x00003800, 0x00003c00,
+	0x00000000, 0x00004000, 0x00008000, 0x0000c000, 0x00010000, 0x00014000, 0x00018000, 0x0001c000,
+	0x00020000, 0x00024000, 0x00028000, 0x0002c000, 0x00030000, 0x00034000, 0x00038000, 0x0003c000,
+	0x00000000, 0x00040000, 0x00080000, 0x000c0000, 0x00100000, 0x00140000, 0x00180000, 0x001c0000,
+	0x00200000, 0x00240000, 0x00280000, 0x002c0000, 0x00300000, 0x00340000, 0x00380000, 0x003c0000,
+	0x00000000, 0x00400000, 0x00800000, 0x00c00000, 0x01000000, 0x01400000, 0x01800000, 0x01c00000,
+	0x02000000, 0x02400000, 0x02800000, 0x02c00000, 0x03000000, 0x03400000, 0x03800000, 0x03c00000,
+	0x00000000, 0x04000000, 0x08000000, 0x0c000000, 0x10000000, 0x14000000, 0x18000000, 0x1c000000,
+	0x20000000, 0x24000000, 0x28000000, 0x2c000000, 0x30000000, 0x34000000, 0x38000000, 0x3c000000,
+	0x00000000, 0x00780111, 0x00700121, 0x00080030, 0x00600141, 0x00180050, 0x00100060, 0x00680171,
+	0x00400181, 0x00380090, 0x003000a0, 0x004801b1, 0x002000c0, 0x005801d1, 0x005001e1, 0x002800f0,
+	0x00000000, 0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006, 0x00000007,
+	0x00000008, 0x00000009, 0x0000000a, 0x0000000b, 0x0000000c, 0x0000000d, 0x0000000e, 0x0000000f,
+	0x00000000, 0x00000010, 0x00000020, 0x00000030, 0x00000040, 0x00000050, 0x00000060, 0x00000070,
+	0x00000080, 0x00000090, 0x000000a0, 0x000000b0, 0x000000c0, 0x000000d0, 0x000000e0, 0x000000f0,
+	0x00000000, 0x00000100, 0x00000200, 0x00000300, 0x00000400, 0x00000500, 0x00000600, 0x00000700,
+	0x00000800, 0x00000900, 0x00000a00, 0x00000b00, 0x00000c00, 0x00000d00, 0x00000e00, 0x00000f00,
+	0x00000000, 0x00001000, 0x00002000, 0x00003000, 0x00004000, 0x00005000, 0x00006000, 0x00007000,
+	0x00008000, 0x00009000, 0x0000a000, 0x0000b000, 0x0000c000, 0x0000d000, 0x0000e000, 0x0000f000,
+	0x00000000, 0x00010000, 0x00020000, 0x00030000, 0x00040000, 0x00050000, 0x00060000, 0x00070000,
+	0x00080000, 0x00090000, 0x000a0000, 0x000b0000, 0x000c0000, 0x000d0000, 0x000e0000, 0x000f0000,
+	0x00000000, 0x00100000, 0x00200000, 0x00300000, 0x00400000, 0x00500000, 0x00600000, 0x00700000,
+	0x00800000, 0x00900000, 0x00a00000, 0x00b00000, 0x00c00000, 0x00d00000, 0x00e00000, 0x00f00000,
+	0x00000000, 0x01000000, 0x02000000, 0x03000000, 0x04000000, 0x05000000, 0x06000000, 0x07000000,
+	0x08000000, 0x09000000, 0x0a000000, 0x0b000000, 0x0c000000, 0x0d000000, 0x0e000000, 0x0f000000,
+	0x00000000, 0x007f8100, 0x007f0103, 0x00008003, 0x007e0105, 0x00018005, 0x00010006, 0x007e8106,
+	0x007c0109, 0x00038009, 0x0003000a, 0x007c810a, 0x0002000c, 0x007d810c, 0x007d010f, 0x0002800f,
+	0x00000000, 0x00780111, 0x00700121, 0x00080030, 0x00600141, 0x00180050, 0x00100060, 0x00680171,
+	0x00400181, 0x00380090, 0x003000a0, 0x004801b1, 0x002000c0, 0x005801d1, 0x005001e1, 0x002800f0,
+	0x00000000, 0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006, 0x00000007,
+	0x00000008, 0x00000009, 0x0000000a, 0x0000000b, 0x0000000c, 0x0000000d, 0x0000000e, 0x0000000f,
+	0x00000000, 0x00000010, 0x00000020, 0x00000030, 0x00000040, 0x00000050, 0x00000060, 0x00000070,
+	0x00000080, 0x00000090, 0x000000a0, 0x000000b0, 0x000000c0, 0x000000d0, 0x000000e0, 0x000000f0,
+	0x00000000, 0x00000100, 0x00000200, 0x00000300, 0x00000400, 0x00000500, 0x00000600, 0x00000700,
+	0x00000800, 0x00000900, 0x00000a00, 0x00000b00, 0x00000c00, 0x00000d00, 0x00000e00, 0x00000f00,
+	0x00000000, 0x00001000, 0x00002000, 0x00003000, 0x00004000, 0x00005000, 0x00006000, 0x00007000,
+	0x00008000, 0x00009000, 0x0000a000, 0x0000b000, 0x0000c000, 0x0000d000, 0x0000e000, 0x0000f000,
+	0x00000000, 0x00010000, 0x00020000, 0x00030000, 0x00040000, 0x00050000, 0x00060000, 0x00070000,
+	0x00080000, 0x00090000, 0x000a0000, 0x000b0000, 0x000c0000, 0x000d0000, 0x000e0000, 0x000f0000,
+	0x00000000, 0x00100000, 0x00200000, 0x00300000, 0x00400000, 0x00500000, 0x00600000, 0x00700000,
+	0x00800000, 0x00900000, 0x00a00000, 0x00b00000, 0x00c00000, 0x00d00000, 0x00e00000, 0x00f00000,
+	0x00000000, 0x00007f81, 0x0000ff02, 0x00008083, 0x0001fe04, 0x00018185, 0x00010106, 0x00017e87,
+	0x0003fc08, 0x00038389, 0x0003030a, 0x00037c8b, 0x0002020c, 0x00027d8d, 0x0002fd0e, 0x0002828f,
+	0x00000000, 0x0007f810, 0x000ff020, 0x00080830, 0x001fe040, 0x00181850, 0x00101060, 0x0017e870,
+	0x003fc080, 0x00383890, 0x003030a0, 0x0037c8b0, 0x002020c0, 0x0027d8d0, 0x002fd0e0, 0x002828f0,
+	0x00000000, 0x007f8100, 0x007f0103, 0x00008003, 0x007e0105, 0x00018005, 0x00010006, 0x007e8106,
+	0x007c0109, 0x00038009, 0x0003000a, 0x007c810a, 0x0002000c, 0x007d810c, 0x007d010f, 0x0002800f,
+	0x00000000, 0x00780111, 0x00700121, 0x00080030, 0x00600141, 0x00180050, 0x00100060, 0x00680171,
+	0x00400181, 0x00380090, 0x003000a0, 0x004801b1, 0x002000c0, 0x005801d1, 0x005001e1, 0x002800f0,
+	0x00000000, 0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006, 0x00000007,
+	0x00000008, 0x00000009, 0x0000000a, 0x0000000b, 0x0000000c, 0x0000000d, 0x0000000e, 0x0000000f,
+	0x00000000, 0x00000010, 0x00000020, 0x00000030, 0x00000040, 0x00000050, 0x00000060, 0x00000070,
+	0x00000080, 0x00000090, 0x000000a0, 0x000000b0, 0x000000c0, 0x000000d0, 0x000000e0, 0x000000f0,
+	0x00000000, 0x00000100, 0x00000200, 0x00000300, 0x00000400, 0x00000500, 0x00000600, 0x00000700,
+	0x00000800, 0x00000900, 0x00000a00, 0x00000b00, 0x00000c00, 0x00000d00, 0x00000e00, 0x00000f00,
+	0x00000000, 0x00001000, 0x00002000, 0x00003000, 0x00004000, 0x00005000, 0x00006000, 0x00007000,
+	0x00008000, 0x00009000, 0x0000a000, 0x0000b000, 0x0000c000, 0x0000d000, 0x0000e000, 0x0000f000,
+	0x00000000, 0x00553e7f, 0x002a7ffd, 0x007f4182, 0x0054fffa, 0x0001c185, 0x007e8007, 0x002bbe78,
+	0x0029fcf7, 0x007cc288, 0x0003830a, 0x0056bd75, 0x007d030d, 0x00283d72, 0x00577cf0, 0x0002428f,
+	0x00000000, 0x0053f9ee, 0x0027f0df, 0x00740931, 0x004fe1be, 0x001c1850, 0x00681161, 0x003be88f,
+	0x001fc07f, 0x004c3991, 0x003830a0, 0x006bc94e, 0x005021c1, 0x0003d82f, 0x0077d11e, 0x002428f0,
+	0x00000000, 0x003f80fe, 0x007f01fc, 0x00408102, 0x007e00fb, 0x00418005, 0x00010107, 0x003e81f9,
+	0x007c02f5, 0x0043820b, 0x00030309, 0x003c83f7, 0x0002020e, 0x003d82f0, 0x007d03f2, 0x0042830c,
+	0x00000000, 0x007806e9, 0x00700ed1, 0x00080838, 0x00601ea1, 0x00181848, 0x00101070, 0x00681699,
+	0x00403e41, 0x003838a8, 0x00303090, 0x00483679, 0x002020e0, 0x00582609, 0x00502e31, 0x002828d8,
+	0x00000000, 0x00007f81, 0x0000ff02, 0x00008083, 0x0001fe04, 0x00018185, 0x00010106, 0x00017e87,
+	0x0003fc08, 0x00038389, 0x0003030a, 0x00037c8b, 0x0002020c, 0x00027d8d, 0x0002fd0e, 0x0002828f,
+	0x00000000, 0x0007f810, 0x000ff020, 0x00080830, 0x001fe040, 0x00181850, 0x00101060, 0x0017e870,
+	0x003fc080, 0x00383890, 0x003030a0, 0x0037c8b0, 0x002020c0, 0x0027d8d0, 0x002fd0e0, 0x002828f0,
+	0x00000000, 0x007f8100, 0x007f0103, 0x00008003, 0x007e0105, 0x00018005, 0x00010006, 0x007e8106,
+	0x007c0109, 0x00038009, 0x0003000a, 0x007c810a, 0x0002000c, 0x007d810c, 0x007d010f, 0x0002800f,
+	0x00000000, 0x00780111, 0x00700121, 0x00080030, 0x00600141, 0x00180050, 0x00100060, 0x00680171,
+	0x00400181, 0x00380090, 0x003000a0, 0x004801b1, 0x002000c0, 0x005801d1, 0x005001e1, 0x002800f0,
+	0x00000000, 0x0055381f, 0x002a733d, 0x007f4b22, 0x0054e67a, 0x0001de65, 0x007e9547, 0x002bad58,
+	0x0029cff7, 0x007cf7e8, 0x0003bcca, 0x005684d5, 0x007d298d, 0x00281192, 0x00575ab0, 0x000262af,
+	0x00000000, 0x00539fee, 0x00273cdf, 0x0074a331, 0x004e79be, 0x001de650, 0x00694561, 0x003ada8f,
+	0x001cf07f, 0x004f6f91, 0x003bcca0, 0x0068534e, 0x005289c1, 0x0001162f, 0x0075b51e, 0x00262af0,
+	0x00000000, 0x0039e0fe, 0x0073c1fc, 0x004a2102, 0x006780fb, 0x005e6005, 0x00144107, 0x002da1f9,
+	0x004f02f5, 0x0076e20b, 0x003cc309, 0x000523f7, 0x0028820e, 0x001162f0, 0x005b43f2, 0x0062a30c,
+	0x00000000, 0x001e06e9, 0x003c0dd2, 0x00220b3b, 0x00781ba4, 0x00661d4d, 0x00441676, 0x005a109f,
+	0x0070344b, 0x006e32a2, 0x004c3999, 0x00523f70, 0x00082fef, 0x00162906, 0x0034223d, 0x002a24d4,
+	0x00000000, 0x00606b95, 0x0040d429, 0x0020bfbc, 0x0001ab51, 0x0061c0c4, 0x00417f78, 0x002114ed,
+	0x000356a2, 0x00633d37, 0x0043828b, 0x0023e91e, 0x0002fdf3, 0x00629666, 0x004229da, 0x0022424f,
+	0x00000000, 0x0006ad44, 0x000d5a88, 0x000bf7cc, 0x001ab510, 0x001c1854, 0x0017ef98, 0x001142dc,
+	0x00356a20, 0x0033c764, 0x003830a8, 0x003e9dec, 0x002fdf30, 0x00297274, 0x002285b8, 0x002428fc,
+	0x00000000, 0x006ad440, 0x0055ab83, 0x003f7fc3, 0x002b5405, 0x00418045, 0x007eff86, 0x00142bc6,
+	0x0056a80a, 0x003c7c4a, 0x00030389, 0x0069d7c9, 0x007dfc0f, 0x0017284f, 0x0028578c, 0x004283cc,
+	0x00000000, 0x002d5317, 0x005aa62e, 0x0077f539, 0x00354f5f, 0x00181c48, 0x006fe971, 0x0042ba66,
+	0x006a9ebe, 0x0047cda9, 0x00303890, 0x001d6b87, 0x005fd1e1, 0x007282f6, 0x000577cf, 0x002824d8,
+	0x00000000, 0x00412c1f, 0x00025b3d, 0x00437722, 0x0004b67a, 0x00459a65, 0x0006ed47, 0x0047c158,
+	0x00096cf4, 0x004840eb, 0x000b37c9, 0x004a1bd6, 0x000dda8e, 0x004cf691, 0x000f81b3, 0x004eadac,
+	0x00000000, 0x0012d9e8, 0x0025b3d0, 0x00376a38, 0x004b67a0, 0x0059be48, 0x006ed470, 0x007c0d98,
+	0x0016cc43, 0x000415ab, 0x00337f93, 0x0021a67b, 0x005dabe3, 0x004f720b, 0x00781833, 0x006ac1db,
+	0x00000000, 0x002d9886, 0x005b310c, 0x0076a98a, 0x0036611b, 0x001bf99d, 0x006d5017, 0x0040c891,
+	0x006cc236, 0x00415ab0, 0x0037f33a, 0x001a6bbc, 0x005aa32d, 0x00773bab, 0x00019221, 0x002c0aa7,
+	0x00000000, 0x0059876f, 0x00330ddd, 0x006a8ab2, 0x00661bba, 0x003f9cd5, 0x00551667, 0x000c9108,
+	0x004c3477, 0x0015b318, 0x007f39aa, 0x0026bec5, 0x002a2fcd, 0x0073a8a2, 0x00192210, 0x0040a57f,
+	0x00000000, 0x00186bed, 0x0030d7da, 0x0028bc37, 0x0061afb4, 0x0079c459, 0x0051786e, 0x00491383,
+	0x00435c6b, 0x005b3786, 0x00738bb1, 0x006be05c, 0x0022f3df, 0x003a9832, 0x00122405, 0x000a4fe8,
+	0x00000000, 0x0006bbd5, 0x000d77aa, 0x000bcc7f, 0x001aef54, 0x001c5481, 0x001798fe, 0x0011232b,
+	0x0035dea8, 0x0033657d, 0x0038a902, 0x003e12d7, 0x002f31fc, 0x00298a29, 0x00224656, 0x0024fd83,
+	0x00000000, 0x006bbd50, 0x005779a3, 0x003cc4f3, 0x002ef045, 0x00454d15, 0x007989e6, 0x001234b6,
+	0x005de08a, 0x00365dda, 0x000a9929, 0x00612479, 0x007310cf, 0x0018ad9f, 0x0024696c, 0x004fd43c,
+	0x00000000, 0x003bc217, 0x0077842e, 0x004c4639, 0x006f0b5f, 0x0054c948, 0x00188f71, 0x00234d66,
+	0x005e15bd, 0x0065d7aa, 0x00299193, 0x00125384, 0x00311ee2, 0x000adcf5, 0x00469acc, 0x007d58db,
+	0x00000000, 0x00375e0d, 0x006ebc1a, 0x0059e217, 0x005d7b37, 0x006a253a, 0x0033c72d, 0x00049920,
+	0x003af56d, 0x000dab60, 0x00544977, 0x0063177a, 0x00678e5a, 0x0050d057, 0x00093240, 0x003e6c4d,
+	0x00000000, 0x0075eada, 0x006bd6b7, 0x001e3c6d, 0x0057ae6d, 0x002244b7, 0x003c78da, 0x00499200,
+	0x002f5fd9, 0x005ab503, 0x0044896e, 0x003163b4, 0x0078f1b4, 0x000d1b6e, 0x00132703, 0x0066cdd9,
+	0x00000000, 0x005ebfb2, 0x003d7c67, 0x0063c3d5, 0x007af8ce, 0x0024477c, 0x004784a9, 0x00193b1b,
+	0x0075f29f, 0x002b4d2d, 0x00488ef8, 0x0016314a, 0x000f0a51, 0x0051b5e3, 0x00327636, 0x006cc984,
+	0x00000000, 0x006be63d, 0x0057cf79, 0x003c2944, 0x002f9df1, 0x00447bcc, 0x00785288, 0x0013b4b5,
+	0x005f3be2, 0x0034dddf, 0x0008f49b, 0x006312a6, 0x0070a613, 0x001b402e, 0x0027696a, 0x004c8f57,
+	0x00000000, 0x003e74c7, 0x007ce98e, 0x00429d49, 0x0079d01f, 0x0047a4d8, 0x00053991, 0x003b4d56,
+	0x0073a33d, 0x004dd7fa, 0x000f4ab3, 0x00313e74, 0x000a7322, 0x003407e5, 0x00769aac, 0x0048ee6b,
+	0x00000000, 0x00674579, 0x004e89f1, 0x0029cc88, 0x001d10e1, 0x007a5598, 0x00539910, 0x0034dc69,
+	0x003a21c2, 0x005d64bb, 0x0074a833, 0x0013ed4a, 0x00273123, 0x0040745a, 0x0069b8d2, 0x000efdab,
+	0x00000000, 0x00744384, 0x0068840b, 0x001cc78f, 0x00510b15, 0x00254891, 0x00398f1e, 0x004dcc9a,
+	0x00221529, 0x005656ad, 0x004a9122, 0x003ed2a6, 0x00731e3c, 0x00075db8, 0x001b9a37, 0x006fd9b3,
+	0x00000000, 0x00442a52, 0x000857a7, 0x004c7df5, 0x0010af4e, 0x0054851c, 0x0018f8e9, 0x005cd2bb,
+	0x00215e9c, 0x006574ce, 0x0029093b, 0x006d2369, 0x0031f1d2, 0x0075db80, 0x0039a675, 0x007d8c27,
+	0x00000000, 0x00345c73, 0x0068b8e6, 0x005ce495, 0x005172cf, 0x00652ebc, 0x0039ca29, 0x000d965a,
+	0x0022e69d, 0x0016baee, 0x004a5e7b, 0x007e0208, 0x00739452, 0x0047c821, 0x001b2cb4, 0x002f70c7,
+	0x00000000, 0x0045cd3a, 0x000b9977, 0x004e544d, 0x001732ee, 0x0052ffd4, 0x001cab99, 0x005966a3,
+	0x002e65dc, 0x006ba8e6, 0x0025fcab, 0x00603191, 0x00395732, 0x007c9a08, 0x0032ce45, 0x0077037f,
+	0x00000000, 0x005ccbb8, 0x00399473, 0x00655fcb, 0x007328e6, 0x002fe35e, 0x004abc95, 0x0016772d,
+	0x006652cf, 0x003a9977, 0x005fc6bc, 0x00030d04, 0x00157a29, 0x0049b191, 0x002cee5a, 0x007025e2,
+	0x00000000, 0x004ca69d, 0x00194e39, 0x0055e8a4, 0x00329c72, 0x007e3aef, 0x002bd24b, 0x006774d6,
+	0x006538e4, 0x00299e79, 0x007c76dd, 0x0030d040, 0x0057a496, 0x001b020b, 0x004eeaaf, 0x00024c32,
+	0x00000000, 0x004a72cb, 0x0014e695, 0x005e945e, 0x0029cd2a, 0x0063bfe1, 0x003d2bbf, 0x00775974,
+	0x00539a54, 0x0019e89f, 0x00477cc1, 0x000d0e0a, 0x007a577e, 0x003025b5, 0x006eb1eb, 0x0024c320,
+	0x00000000, 0x002737ab, 0x004e6f56, 0x006958fd, 0x001cddaf, 0x003bea04, 0x0052b2f9, 0x00758552,
+	0x0039bb5e, 0x001e8cf5, 0x0077d408, 0x0050e3a3, 0x002566f1, 0x0002515a, 0x006b09a7, 0x004c3e0c,
+	0x00000000, 0x007376bc, 0x0066ee7b, 0x001598c7, 0x004ddff5, 0x003ea949, 0x002b318e, 0x00584732,
+	0x001bbce9, 0x0068ca55, 0x007d5292, 0x000e242e, 0x0056631c, 0x002515a0, 0x00308d67, 0x0043fbdb,
+	0x00000000, 0x003779d2, 0x006ef3a4, 0x00598a76, 0x005de44b, 0x006a9d99, 0x003317ef, 0x00046e3d,
+	0x003bcb95, 0x000cb247, 0x00553831, 0x006241e3, 0x00662fde, 0x0051560c, 0x0008dc7a, 0x003fa5a8,
+	0x00000000, 0x002e5727, 0x005cae4e, 0x0072f969, 0x00395f9f, 0x001708b8, 0x0065f1d1, 0x004ba6f6,
+	0x0072bf3e, 0x005ce819, 0x002e1170, 0x00004657, 0x004be0a1, 0x0065b786, 0x00174eef, 0x003919c8,
+	0x00000000, 0x00657d7f, 0x004af9fd, 0x002f8482, 0x0015f0f9, 0x00708d86, 0x005f0904, 0x003a747b,
+	0x002be1f2, 0x004e9c8d, 0x0061180f, 0x00046570, 0x003e110b, 0x005b6c74, 0x0074e8f6, 0x00119589,
+	0x00000000, 0x0057c3e4, 0x002f84cb, 0x0078472f, 0x005f0996, 0x0008ca72, 0x00708d5d, 0x00274eb9,
+	0x003e102f, 0x0069d3cb, 0x001194e4, 0x00465700, 0x006119b9, 0x0036da5d, 0x004e9d72, 0x00195e96,
+	0x00000000, 0x007c205e, 0x007843bf, 0x000463e1, 0x0070847d, 0x000ca423, 0x0008c7c2, 0x0074e79c,
+	0x00610bf9, 0x001d2ba7, 0x00194846, 0x00656818, 0x00118f84, 0x006dafda, 0x0069cc3b, 0x0015ec65,
+	0x00000000, 0x004214f1, 0x00042ae1, 0x00463e10, 0x000855c2, 0x004a4133, 0x000c7f23, 0x004e6bd2,
+	0x0010ab84, 0x0052bf75, 0x00148165, 0x00569594, 0x0018fe46, 0x005aeab7, 0x001cd4a7, 0x005ec056,
+	0x00000000, 0x00215708, 0x0042ae10, 0x0063f918, 0x00055f23, 0x0024082b, 0x0047f133, 0x0066a63b,
+	0x000abe46, 0x002be94e, 0x00481056, 0x0069475e, 0x000fe165, 0x002eb66d, 0x004d4f75, 0x006c187d,
+	0x00000000, 0x00157c8c, 0x002af918, 0x003f8594, 0x0055f230, 0x00408ebc, 0x007f0b28, 0x006a77a4,
+	0x002be763, 0x003e9bef, 0x00011e7b, 0x001462f7, 0x007e1553, 0x006b69df, 0x0054ec4b, 0x004190c7,
+	0x00000000, 0x0057cec6, 0x002f9e8f, 0x00785049, 0x005f3d1e, 0x0008f3d8, 0x0070a391, 0x00276d57,
+	0x003e793f, 0x0069b7f9, 0x0011e7b0, 0x00462976, 0x00614421, 0x00368ae7, 0x004edaae, 0x00191468,
+	0x00000000, 0x0074cf26, 0x00699d4f, 0x001d5269, 0x0053399d, 0x0027f6bb, 0x003aa4d2, 0x004e6bf4,
+	0x00267039, 0x0052bf1f, 0x004fed76, 0x003b2250, 0x007549a4, 0x00018682, 0x001cd4eb, 0x00681bcd,
+	0x00000000, 0x004ce072, 0x0019c3e7, 0x00552395, 0x003387ce, 0x007f67bc, 0x002a4429, 0x0066a45b,
+	0x00670f9c, 0x002befee, 0x007ecc7b, 0x00322c09, 0x00548852, 0x00186820, 0x004d4bb5, 0x0001abc7,
+	0x00000000, 0x004e1c3b, 0x001c3b75, 0x0052274e, 0x003876ea, 0x00766ad1, 0x00244d9f, 0x006a51a4,
+	0x0070edd4, 0x003ef1ef, 0x006cd6a1, 0x0022ca9a, 0x00489b3e, 0x00068705, 0x0054a04b, 0x001abc70,
+	0x00000000, 0x0061d8ab, 0x0043b255, 0x00226afe, 0x000767a9, 0x0066bf02, 0x0044d5fc, 0x00250d57,
+	0x000ecf52, 0x006f17f9, 0x004d7d07, 0x002ca5ac, 0x0009a8fb, 0x00687050, 0x004a1aae, 0x002bc205,
+	0x00000000, 0x001d9ea4, 0x003b3d48, 0x0026a3ec, 0x00767a90, 0x006be434, 0x004d47d8, 0x0050d97c,
+	0x006cf623, 0x00716887, 0x0057cb6b, 0x004a55cf, 0x001a8cb3, 0x00071217, 0x0021b1fb, 0x003c2f5f,
+	0x00000000, 0x0059ef45, 0x0033dd89, 0x006a32cc, 0x0067bb12, 0x003e5457, 0x0054669b, 0x000d89de,
+	0x004f7527, 0x00169a62, 0x007ca8ae, 0x002547eb, 0x0028ce35, 0x00712170, 0x001b13bc, 0x0042fcf9,
+	0x00000000, 0x001ee94d, 0x003dd29a, 0x00233bd7, 0x007ba534, 0x00654c79, 0x004677ae, 0x00589ee3,
+	0x0077496b, 0x0069a026, 0x004a9bf1, 0x005472bc, 0x000cec5f, 0x00120512, 0x00313ec5, 0x002fd788,
+	0x00000000, 0x006e91d5, 0x005d20a9, 0x0033b17c, 0x003a4251, 0x0054d384, 0x006762f8, 0x0009f32d,
+	0x007484a2, 0x001a1577, 0x0029a40b, 0x004735de, 0x004ec6f3, 0x00205726, 0x0013e65a, 0x007d778f,
+	0x00000000, 0x004b80f0, 0x001702e3, 0x005c8213, 0x002e05c6, 0x00658536, 0x00390725, 0x007287d5,
+	0x005c0b8c, 0x00178b7c, 0x004b096f, 0x0000899f, 0x00720e4a, 0x00398eba, 0x00650ca9, 0x002e8c59,
+	0x00000000, 0x0038141b, 0x00702836, 0x00483c2d, 0x0060536f, 0x00584774, 0x00107b59, 0x00286f42,
+	0x0040a5dd, 0x0078b1c6, 0x00308deb, 0x000899f0, 0x0020f6b2, 0x0018e2a9, 0x0050de84, 0x0068ca9f,
+	0x00000000, 0x000148b9, 0x00029172, 0x0003d9cb, 0x000522e4, 0x00046a5d, 0x0007b396, 0x0006fb2f,
+	0x000a45c8, 0x000b0d71, 0x0008d4ba, 0x00099c03, 0x000f672c, 0x000e2f95, 0x000df65e, 0x000cbee7,
+	0x00000000, 0x00148b90, 0x00291720, 0x003d9cb0, 0x00522e40, 0x0046a5d0, 0x007b3960, 0x006fb2f0,
+	0x00245f83, 0x0030d413, 0x000d48a3, 0x0019c333, 0x007671c3, 0x0062fa53, 0x005f66e3, 0x004bed73,
+	0x00000000, 0x0048bf06, 0x00117d0f, 0x0059c209, 0x0022fa1e, 0x006a4518, 0x00338711, 0x007b3817,
+	0x0045f43c, 0x000d4b3a, 0x00548933, 0x001c3635, 0x00670e22, 0x002fb124, 0x0076732d, 0x003ecc2b,
+	0x00000000, 0x000beb7b, 0x0017d6f6, 0x001c3d8d, 0x002fadec, 0x00244697, 0x00387b1a, 0x00339061,
+	0x005f5bd8, 0x0054b0a3, 0x00488d2e, 0x00436655, 0x0070f634, 0x007b1d4f, 0x006720c2, 0x006ccbb9,
+	0x00000000, 0x003eb4b3, 0x007d6966, 0x0043ddd5, 0x007ad1cf, 0x0044657c, 0x0007b8a9, 0x00390c1a,
+	0x0075a09d, 0x004b142e, 0x0008c9fb, 0x00367d48, 0x000f7152, 0x0031c5e1, 0x00721834, 0x004cac87,
+	0x00000000, 0x006b4239, 0x00568771, 0x003dc548, 0x002d0de1, 0x00464fd8, 0x007b8a90, 0x0010c8a9,
+	0x005a1bc2, 0x003159fb, 0x000c9cb3, 0x0067de8a, 0x00771623, 0x001c541a, 0x00219152, 0x004ad36b,
+	0x00000000, 0x007f0ec5, 0x007e1e89, 0x0001104c, 0x007c3e11, 0x000330d4, 0x00022098, 0x007d2e5d,
+	0x00787f21, 0x000771e4, 0x000661a8, 0x00796f6d, 0x00044130, 0x007b4ff5, 0x007a5fb9, 0x0005517c,
+	0x00000000, 0x0070fd41, 0x0061f981, 0x001104c0, 0x0043f001, 0x00330d40, 0x00220980, 0x0052f4c1,
+	0x0007e301, 0x00771e40, 0x00661a80, 0x0016e7c1, 0x00441300, 0x0034ee41, 0x0025ea81, 0x005517c0,
+	0x00000000, 0x000fc602, 0x001f8c04, 0x00104a06, 0x003f1808, 0x0030de0a, 0x0020940c, 0x002f520e,
+	0x007e3010, 0x0071f612, 0x0061bc14, 0x006e7a16, 0x00412818, 0x004eee1a, 0x005ea41c, 0x0051621e,
+	0x00000000, 0x007c6323, 0x0078c545, 0x0004a666, 0x00718989, 0x000deaaa, 0x00094ccc, 0x00752fef,
+	0x00631011, 0x001f7332, 0x001bd554, 0x0067b677, 0x00129998, 0x006efabb, 0x006a5cdd, 0x00163ffe,
+	0x00000000, 0x00462321, 0x000c4541, 0x004a6660, 0x00188a82, 0x005ea9a3, 0x0014cfc3, 0x0052ece2,
+	0x00311504, 0x00773625, 0x003d5045, 0x007b7364, 0x00299f86, 0x006fbca7, 0x0025dac7, 0x0063f9e6,
+	0x00000000, 0x00622a08, 0x00445713, 0x00267d1b, 0x0008ad25, 0x006a872d, 0x004cfa36, 0x002ed03e,
+	0x00115a4a, 0x00737042, 0x00550d59, 0x00372751, 0x0019f76f, 0x007bdd67, 0x005da07c, 0x003f8a74,
+	0x00000000, 0x0022b494, 0x00456928, 0x0067ddbc, 0x000ad153, 0x002865c7, 0x004fb87b, 0x006d0cef,
+	0x0015a2a6, 0x00371632, 0x0050cb8e, 0x00727f1a, 0x001f73f5, 0x003dc761, 0x005a1add, 0x0078ae49,
+	0x00000000, 0x002b454c, 0x00568a98, 0x007dcfd4, 0x002d1633, 0x0006537f, 0x007b9cab, 0x0050d9e7,
+	0x005a2c66, 0x0071692a, 0x000ca6fe, 0x0027e3b2, 0x00773a55, 0x005c7f19, 0x0021b0cd, 0x000af581,
+	0x00000000, 0x0054ae10, 0x00295f23, 0x007df133, 0x0052be46, 0x00061056, 0x007be165, 0x002f4f75,
+	0x00257f8f, 0x0071d19f, 0x000c20ac, 0x00588ebc, 0x0077c1c9, 0x00236fd9, 0x005e9eea, 0x000a30fa,
+	0x00000000, 0x004aff1e, 0x0015fd3f, 0x005f0221, 0x002bfa7e, 0x00610560, 0x003e0741, 0x0074f85f,
+	0x0057f4fc, 0x001d0be2, 0x004209c3, 0x0008f6dd, 0x007c0e82, 0x0036f19c, 0x0069f3bd, 0x00230ca3,
+	0x00000000, 0x002feafb, 0x005fd5f6, 0x00703f0d, 0x003fa8ef, 0x00104214, 0x00607d19, 0x004f97e2,
+	0x007f51de, 0x0050bb25, 0x00208428, 0x000f6ed3, 0x0040f931, 0x006f13ca, 0x001f2cc7, 0x0030c63c,
+	0x00000000, 0x007ea0bf, 0x007d427d, 0x0003e2c2, 0x007a87f9, 0x00042746, 0x0007c584, 0x0079653b,
+	0x00750cf1, 0x000bac4e, 0x00084e8c, 0x0076ee33, 0x000f8b08, 0x00712bb7, 0x0072c975, 0x000c69ca,
+	0x00000000, 0x006a1ae1, 0x005436c1, 0x003e2c20, 0x00286e81, 0x00427460, 0x007c5840, 0x001642a1,
+	0x0050dd02, 0x003ac7e3, 0x0004ebc3, 0x006ef122, 0x0078b383, 0x0012a962, 0x002c8542, 0x00469fa3,
+	0x00000000, 0x0021b907, 0x0043720e, 0x0062cb09, 0x0006e71f, 0x00275e18, 0x00459511, 0x00642c16,
+	0x000dce3e, 0x002c7739, 0x004ebc30, 0x006f0537, 0x000b2921, 0x002a9026, 0x00485b2f, 0x0069e228,
+	0x00000000, 0x001b9c7c, 0x003738f8, 0x002ca484, 0x006e71f0, 0x0075ed8c, 0x00594908, 0x0042d574,
+	0x005ce0e3, 0x00477c9f, 0x006bd81b, 0x00704467, 0x00329113, 0x00290d6f, 0x0005a9eb, 0x001e3597,
+	0x00000000, 0x0039c2c5, 0x0073858a, 0x004a474f, 0x00670817, 0x005ecad2, 0x00148d9d, 0x002d4f58,
+	0x004e132d, 0x0077d1e8, 0x003d96a7, 0x00045462, 0x00291b3a, 0x0010d9ff, 0x005a9eb0, 0x00635c75,
+	0x00000000, 0x0052adcc, 0x0025589b, 0x0077f557, 0x004ab136, 0x00181cfa, 0x006fe9ad, 0x003d4461,
+	0x0015616f, 0x0047cca3, 0x003039f4, 0x00629438, 0x005fd059, 0x000d7d95, 0x007a88c2, 0x0028250e,
+	0x00000000, 0x002ac2de, 0x005585bc, 0x007f4762, 0x002b087b, 0x0001caa5, 0x007e8dc7, 0x00544f19,
+	0x005610f6, 0x007cd228, 0x0003954a, 0x00295794, 0x007d188d, 0x0057da53, 0x00289d31, 0x00025fef,
+	0x00000000, 0x002c22ef, 0x005845de, 0x00746731, 0x003088bf, 0x001caa50, 0x0068cd61, 0x0044ef8e,
+	0x0061117e, 0x004d3391, 0x003954a0, 0x0015764f, 0x005199c1, 0x007dbb2e, 0x0009dc1f, 0x0025fef0,
+	0x00000000, 0x004221ff, 0x000440fd, 0x00466102, 0x000881fa, 0x004aa005, 0x000cc107, 0x004ee0f8,
+	0x001103f4, 0x0053220b, 0x00154309, 0x005762f6, 0x0019820e, 0x005ba3f1, 0x001dc2f3, 0x005fe30c,
+	0x00000000, 0x002207e8, 0x00440fd0, 0x00660838, 0x00081ca3, 0x002a1b4b, 0x004c1373, 0x006e149b,
+	0x00103946, 0x00323eae, 0x00543696, 0x0076317e, 0x001825e5, 0x003a220d, 0x005c2a35, 0x007e2ddd,
+	0x00000000, 0x0020728c, 0x0040e518, 0x00609794, 0x0001c933, 0x0021bbbf, 0x00412c2b, 0x00615ea7,
+	0x00039266, 0x0023e0ea, 0x0043777e, 0x006305f2, 0x00025b55, 0x002229d9, 0x0042be4d, 0x0062ccc1,
+	0x00000000, 0x000724cc, 0x000e4998, 0x00096d54, 0x001c9330, 0x001bb7fc, 0x0012daa8, 0x0015fe64,
+	0x00392660, 0x003e02ac, 0x00376ff8, 0x00304b34, 0x0025b550, 0x0022919c, 0x002bfcc8, 0x002cd804,
+	0x00000000, 0x00724cc0, 0x00649a83, 0x0016d643, 0x00493605, 0x003b7ac5, 0x002dac86, 0x005fe046,
+	0x00126f09, 0x006023c9, 0x0076f58a, 0x0004b94a, 0x005b590c, 0x002915cc, 0x003fc38f, 0x004d8f4f,
+	0x00000000, 0x002f849c, 0x005f0938, 0x00708da4, 0x003e1173, 0x001195ef, 0x0061184b, 0x004e9cd7,
+	0x007c22e6, 0x0053a67a, 0x00232bde, 0x000caf42, 0x00423395, 0x006db709, 0x001d3aad, 0x0032be31,
+	0x00000000, 0x007846cf, 0x00708e9d, 0x0008c852, 0x00611e39, 0x001958f6, 0x001190a4, 0x0069d66b,
+	0x00423f71, 0x003a79be, 0x0032b1ec, 0x004af723, 0x00232148, 0x005b6787, 0x0053afd5, 0x002be91a,
+	0x00000000, 0x00047de1, 0x0008fbc2, 0x000c8623, 0x0011f784, 0x00158a65, 0x00190c46, 0x001d71a7,
+	0x0023ef08, 0x002792e9, 0x002b14ca, 0x002f692b, 0x0032188c, 0x0036656d, 0x003ae34e, 0x003e9eaf,
+	0x00000000, 0x0047de10, 0x000fbf23, 0x00486133, 0x001f7e46, 0x0058a056, 0x0010c165, 0x00571f75,
+	0x003efc8c, 0x0079229c, 0x003143af, 0x00769dbf, 0x002182ca, 0x00665cda, 0x002e3de9, 0x0069e3f9,
+	0x00000000, 0x007df918, 0x007bf133, 0x0006082b, 0x0077e165, 0x000a187d, 0x000c1056, 0x0071e94e,
+	0x006fc1c9, 0x001238d1, 0x001430fa, 0x0069c9e2, 0x001820ac, 0x0065d9b4, 0x0063d19f, 0x001e2887,
+	0x00000000, 0x005f8091, 0x003f0221, 0x006082b0, 0x007e0442, 0x002184d3, 0x00410663, 0x001e86f2,
+	0x007c0b87, 0x00238b16, 0x004309a6, 0x001c8937, 0x00020fc5, 0x005d8f54, 0x003d0de4, 0x00628d75,
+	0x00000000, 0x0078140d, 0x00702b19, 0x00083f14, 0x00605531, 0x0018413c, 0x00107e28, 0x00686a25,
+	0x0040a961, 0x0038bd6c, 0x00308278, 0x00489675, 0x0020fc50, 0x0058e85d, 0x0050d749, 0x0028c344,
+	0x00000000, 0x000151c1, 0x0002a382, 0x0003f243, 0x00054704, 0x000416c5, 0x0007e486, 0x0006b547,
+	0x000a8e08, 0x000bdfc9, 0x00082d8a, 0x00097c4b, 0x000fc90c, 0x000e98cd, 0x000d6a8e, 0x000c3b4f,
+	0x00000000, 0x00766b85, 0x006cd409, 0x001abf8c, 0x0059ab11, 0x002fc094, 0x00357f18, 0x0043149d,
+	0x00335521, 0x00453ea4, 0x005f8128, 0x0029eaad, 0x006afe30, 0x001c95b5, 0x00062a39, 0x007041bc,
+	0x00000000, 0x0066aa42, 0x004d5787, 0x002bfdc5, 0x001aac0d, 0x007c064f, 0x0057fb8a, 0x003151c8,
+	0x0035581a, 0x0053f258, 0x00780f9d, 0x001ea5df, 0x002ff417, 0x00495e55, 0x0062a390, 0x000409d2,
+	0x00000000, 0x006ab034, 0x0055636b, 0x003fd35f, 0x002ac5d5, 0x004075e1, 0x007fa6be, 0x0015168a,
+	0x00558baa, 0x003f3b9e, 0x0000e8c1, 0x006a58f5, 0x007f4e7f, 0x0015fe4b, 0x002a2d14, 0x00409d20,
+	0x00000000, 0x002b1457, 0x005628ae, 0x007d3cf9, 0x002c525f, 0x00074608, 0x007a7af1, 0x00516ea6,
+	0x0058a4be, 0x0073b0e9, 0x000e8c10, 0x00259847, 0x0074f6e1, 0x005fe2b6, 0x0022de4f, 0x0009ca18,
+	0x00000000, 0x00314a7f, 0x006294fe, 0x0053de81, 0x00452aff, 0x00746080, 0x0027be01, 0x0016f47e,
+	0x000a56fd, 0x003b1c82, 0x0068c203, 0x0059887c, 0x004f7c02, 0x007e367d, 0x002de8fc, 0x001ca283,
+	0x00000000, 0x0014adfa, 0x00295bf4, 0x003df60e, 0x0052b7e8, 0x00461a12, 0x007bec1c, 0x006f41e6,
+	0x00256cd3, 0x0031c129, 0x000c3727, 0x00189add, 0x0077db3b, 0x006376c1, 0x005e80cf, 0x004a2d35,
+	0x00000000, 0x004ad9a6, 0x0015b04f, 0x005f69e9, 0x002b609e, 0x0061b938, 0x003ed0d1, 0x00740977,
+	0x0056c13c, 0x001c189a, 0x00437173, 0x0009a8d5, 0x007da1a2, 0x00377804, 0x006811ed, 0x0022c84b,
+	0x00000000, 0x002d817b, 0x005b02f6, 0x0076838d, 0x003606ef, 0x001b8794, 0x006d0419, 0x00408562,
+	0x006c0dde, 0x00418ca5, 0x00370f28, 0x001a8e53, 0x005a0b31, 0x00778a4a, 0x000109c7, 0x002c88bc,
+	0x00000000, 0x0042456d, 0x000489d9, 0x0046ccb4, 0x000913b2, 0x004b56df, 0x000d9a6b, 0x004fdf06,
+	0x00122764, 0x00506209, 0x0016aebd, 0x0054ebd0, 0x001b34d6, 0x005971bb, 0x001fbd0f, 0x005df862,
+	0x00000000, 0x00244ec8, 0x00489d90, 0x006cd358, 0x00113823, 0x003576eb, 0x0059a5b3, 0x007deb7b,
+	0x00227046, 0x00063e8e, 0x006aedd6, 0x004ea31e, 0x00334865, 0x001706ad, 0x007bd5f5, 0x005f9b3d,
+	0x00000000, 0x0044e08c, 0x0009c21b, 0x004d2297, 0x00138436, 0x005764ba, 0x001a462d, 0x005ea6a1,
+	0x0027086c, 0x0063e8e0, 0x002eca77, 0x006a2afb, 0x00348c5a, 0x00706cd6, 0x003d4e41, 0x0079aecd,
+	0x00000000, 0x004e10d8, 0x001c22b3, 0x0052326b, 0x00384566, 0x007655be, 0x002467d5, 0x006a770d,
+	0x00708acc, 0x003e9a14, 0x006ca87f, 0x0022b8a7, 0x0048cfaa, 0x0006df72, 0x0054ed19, 0x001afdc1,
+	0x00000000, 0x0061169b, 0x00422e35, 0x002338ae, 0x00045f69, 0x006549f2, 0x0046715c, 0x002767c7,
+	0x0008bed2, 0x0069a849, 0x004a90e7, 0x002b867c, 0x000ce1bb, 0x006df720, 0x004ecf8e, 0x002fd915,
+	0x00000000, 0x00117da4, 0x0022fb48, 0x003386ec, 0x0045f690, 0x00548b34, 0x00670dd8, 0x0076707c,
+	0x000bee23, 0x001a9387, 0x0029156b, 0x003868cf, 0x004e18b3, 0x005f6517, 0x006ce3fb, 0x007d9e5f,
+	0x00000000, 0x0017dc46, 0x002fb88c, 0x003864ca, 0x005f7118, 0x0048ad5e, 0x0070c994, 0x006715d2,
+	0x003ee133, 0x00293d75, 0x001159bf, 0x000685f9, 0x0061902b, 0x00764c6d, 0x004e28a7, 0x0059f4e1,
+	0x00000000, 0x007dc266, 0x007b87cf, 0x000645a9, 0x00770c9d, 0x000acefb, 0x000c8b52, 0x00714934,
+	0x006e1a39, 0x0013d85f, 0x00159df6, 0x00685f90, 0x001916a4, 0x0064d4c2, 0x0062916b, 0x001f530d,
+	0x00000000, 0x00682d71, 0x005059e1, 0x00387490, 0x0020b0c1, 0x00489db0, 0x0070e920, 0x0018c451,
+	0x00416182, 0x00294cf3, 0x00113863, 0x00791512, 0x0061d143, 0x0009fc32, 0x003188a2, 0x0059a5d3,
+	0x00000000, 0x0002c007, 0x0005800e, 0x00074009, 0x000b001c, 0x0009c01b, 0x000e8012, 0x000c4015,
+	0x00160038, 0x0014c03f, 0x00138036, 0x00114031, 0x001d0024, 0x001fc023, 0x0018802a, 0x001a402d,
+	0x00000000, 0x002c0070, 0x005800e0, 0x00740090, 0x003002c3, 0x001c02b3, 0x00680223, 0x00440253,
+	0x00600586, 0x004c05f6, 0x00380566, 0x00140516, 0x00500745, 0x007c0735, 0x000807a5, 0x002407d5,
+	0x00000000, 0x0040080f, 0x0000131d, 0x00401b12, 0x0000263a, 0x00402e35, 0x00003527, 0x00403d28,
+	0x00004c74, 0x0040447b, 0x00005f69, 0x00405766, 0x00006a4e, 0x00406241, 0x00007953, 0x0040715c,
+	0x00000000, 0x000098e8, 0x000131d0, 0x0001a938, 0x000263a0, 0x0002fb48, 0x00035270, 0x0003ca98,
+	0x0004c740, 0x00045fa8, 0x0005f690, 0x00056e78, 0x0006a4e0, 0x00063c08, 0x00079530, 0x00070dd8,
+	0x00000000, 0x00098e80, 0x00131d00, 0x001a9380, 0x00263a00, 0x002fb480, 0x00352700, 0x003ca980,
+	0x004c7400, 0x0045fa80, 0x005f6900, 0x0056e780, 0x006a4e00, 0x0063c080, 0x00795300, 0x0070dd80,
+	0x00000000, 0x0018eb03, 0x0031d606, 0x00293d05, 0x0063ac0c, 0x007b470f, 0x00527a0a, 0x004a9109,
+	0x00475b1b, 0x005fb018, 0x00768d1d, 0x006e661e, 0x0024f717, 0x003c1c14, 0x00152111, 0x000dca12,
+	0x00000000, 0x000eb535, 0x001d6a6a, 0x0013df5f, 0x003ad4d4, 0x003461e1, 0x0027bebe, 0x00290b8b,
+	0x0075a9a8, 0x007b1c9d, 0x0068c3c2, 0x006676f7, 0x004f7d7c, 0x0041c849, 0x00521716, 0x005ca223,
+	0x00000000, 0x0029990c, 0x00533218, 0x007aab14, 0x00266733, 0x000ffe3f, 0x0075552b, 0x005ccc27,
+	0x004cce66, 0x0065576a, 0x001ffc7e, 0x00366572, 0x006aa955, 0x00433059, 0x00399b4d, 0x00100241,
+	0x00000000, 0x00199fcf, 0x00333f9e, 0x002aa051, 0x00667f3c, 0x007fe0f3, 0x005540a2, 0x004cdf6d,
+	0x004cfd7b, 0x005562b4, 0x007fc2e5, 0x00665d2a, 0x002a8247, 0x00331d88, 0x0019bdd9, 0x00002216,
+	0x00000000, 0x0019f9f5, 0x0033f3ea, 0x002a0a1f, 0x0067e7d4, 0x007e1e21, 0x0054143e, 0x004dedcb,
+	0x004fccab, 0x0056355e, 0x007c3f41, 0x0065c6b4, 0x00282b7f, 0x0031d28a, 0x001bd895, 0x00022160,
+	0x00000000, 0x001f9a55, 0x003f34aa, 0x0020aeff, 0x007e6954, 0x0061f301, 0x00415dfe, 0x005ec7ab,
+	0x007cd1ab, 0x00634bfe, 0x0043e501, 0x005c7f54, 0x0002b8ff, 0x001d22aa, 0x003d8c55, 0x00221600,
+	0x00000000, 0x0079a055, 0x007343a9, 0x000ae3fc, 0x00668451, 0x001f2404, 0x0015c7f8, 0x006c67ad,
+	0x004d0ba1, 0x0034abf4, 0x003e4808, 0x0047e85d, 0x002b8ff0, 0x00522fa5, 0x0058cc59, 0x00216c0c,
+	0x00000000, 0x001a1441, 0x00342882, 0x002e3cc3, 0x00685104, 0x00724545, 0x005c7986, 0x00466dc7,
+	0x0050a10b, 0x004ab54a, 0x00648989, 0x007e9dc8, 0x0038f00f, 0x0022e44e, 0x000cd88d, 0x0016cccc,
+	0x00000000, 0x00214115, 0x0042822a, 0x0063c33f, 0x00050757, 0x00244642, 0x0047857d, 0x0066c468,
+	0x000a0eae, 0x002b4fbb, 0x00488c84, 0x0069cd91, 0x000f09f9, 0x002e48ec, 0x004d8bd3, 0x006ccac6,
+	0x00000000, 0x00141d5c, 0x00283ab8, 0x003c27e4, 0x00507570, 0x0044682c, 0x00784fc8, 0x006c5294,
+	0x0020e9e3, 0x0034f4bf, 0x0008d35b, 0x001cce07, 0x00709c93, 0x006481cf, 0x0058a62b, 0x004cbb77,
+	0x00000000, 0x005f5483, 0x003eaa05, 0x0061fe86, 0x007d540a, 0x00220089, 0x0043fe0f, 0x001caa8c,
+	0x007aab17, 0x0025ff94, 0x00440112, 0x001b5591, 0x0007ff1d, 0x0058ab9e, 0x00395518, 0x0066019b,
+	0x00000000, 0x0075552d, 0x006aa959, 0x001ffc74, 0x005551b1, 0x0020049c, 0x003ff8e8, 0x004aadc5,
+	0x002aa061, 0x005ff54c, 0x00400938, 0x00355c15, 0x007ff1d0, 0x000aa4fd, 0x00155889, 0x00600da4,
+	0x00000000, 0x005540c2, 0x002a8287, 0x007fc245, 0x0055050e, 0x000045cc, 0x007f8789, 0x002ac74b,
+	0x002a091f, 0x007f49dd, 0x00008b98, 0x0055cb5a, 0x007f0c11, 0x002a4cd3, 0x00558e96, 0x0000ce54,
+	0x00000000, 0x0054123e, 0x0028277f, 0x007c3541, 0x00504efe, 0x00045cc0, 0x00786981, 0x002c7bbf,
+	0x00209eff, 0x00748cc1, 0x0008b980, 0x005cabbe, 0x0070d001, 0x0024c23f, 0x0058f77e, 0x000ce540,
+	0x00000000, 0x00413dfe, 0x000278ff, 0x00434501, 0x0004f1fe, 0x0045cc00, 0x00068901, 0x0047b4ff,
+	0x0009e3fc, 0x0048de02, 0x000b9b03, 0x004aa6fd, 0x000d1202, 0x004c2ffc, 0x000f6afd, 0x004e5703,
+	0x00000000, 0x0013c7f8, 0x00278ff0, 0x00344808, 0x004f1fe0, 0x005cd818, 0x00689010, 0x007b57e8,
+	0x001e3cc3, 0x000dfb3b, 0x0039b333, 0x002a74cb, 0x00512323, 0x0042e4db, 0x0076acd3, 0x00656b2b,
+	0x00000000, 0x003c7986, 0x0078f30c, 0x00448a8a, 0x0071e51b, 0x004d9c9d, 0x00091617, 0x00356f91,
+	0x0063c935, 0x005fb0b3, 0x001b3a39, 0x002743bf, 0x00122c2e, 0x002e55a8, 0x006adf22, 0x0056a6a4,
+	0x00000000, 0x00479169, 0x000f21d1, 0x0048b0b8, 0x001e43a2, 0x0059d2cb, 0x00116273, 0x0056f31a,
+	0x003c8744, 0x007b162d, 0x0033a695, 0x007437fc, 0x0022c4e6, 0x0065558f, 0x002de537, 0x006a745e,
+	0x00000000, 0x00088832, 0x00111064, 0x00199856, 0x002220c8, 0x002aa8fa, 0x003330ac, 0x003bb89e,
+	0x00444190, 0x004cc9a2, 0x005551f4, 0x005dd9c6, 0x00666158, 0x006ee96a, 0x0077713c, 0x007ff90e,
+	0x00000000, 0x00088023, 0x00110046, 0x00198065, 0x0022008c, 0x002a80af, 0x003300ca, 0x003b80e9,
+	0x00440118, 0x004c813b, 0x0055015e, 0x005d817d, 0x00660194, 0x006e81b7, 0x007701d2, 0x007f81f1,
+	0x00000000, 0x00080133, 0x00100266, 0x00180355, 0x002004cc, 0x002805ff, 0x003006aa, 0x00380799,
+	0x00400998, 0x004808ab, 0x00500bfe, 0x00580acd, 0x00600d54, 0x00680c67, 0x00700f32, 0x00780e01,
+	0x00000000, 0x00001033, 0x00002066, 0x00003055, 0x000040cc, 0x000050ff, 0x000060aa, 0x00007099,
+	0x00008198, 0x000091ab, 0x0000a1fe, 0x0000b1cd, 0x0000c154, 0x0000d167, 0x0000e132, 0x0000f101,
+	0x00000000, 0x00010330, 0x00020660, 0x00030550, 0x00040cc0, 0x00050ff0, 0x00060aa0, 0x00070990,
+	0x00081980, 0x00091ab0, 0x000a1fe0, 0x000b1cd0, 0x000c1540, 0x000d1670, 0x000e1320, 0x000f1010,
+	0x00000000, 0x00103300, 0x00206600, 0x00305500, 0x0040cc00, 0x0050ff00, 0x0060aa00, 0x00709900,
+	0x00019b03, 0x0011a803, 0x0021fd03, 0x0031ce03, 0x00415703, 0x00516403, 0x00613103, 0x00710203,
+	0x00000000, 0x00033606, 0x00066c0c, 0x00055a0a, 0x000cd818, 0x000fee1e, 0x000ab414, 0x00098212,
+	0x0019b030, 0x001a8636, 0x001fdc3c, 0x001cea3a, 0x00156828, 0x00165e2e, 0x00130424, 0x00103222,
+	0x00000000, 0x00336060, 0x0066c0c0, 0x0055a0a0, 0x004d8283, 0x007ee2e3, 0x002b4243, 0x00182223,
+	0x001b0605, 0x00286665, 0x007dc6c5, 0x004ea6a5, 0x00568486, 0x0065e4e6, 0x00304446, 0x00032426,
+	0x00000000, 0x00400181, 0x00000001, 0x00400180, 0x00000002, 0x00400183, 0x00000003, 0x00400182,
+	0x00000004, 0x00400185, 0x00000005, 0x00400184, 0x00000006, 0x00400187, 0x00000007, 0x00400186,
+	0x00000000, 0x00000008, 0x00000010, 0x00000018, 0x00000020, 0x00000028, 0x00000030, 0x00000038,
+	0x00000040, 0x00000048, 0x00000050, 0x00000058, 0x00000060, 0x00000068, 0x00000070, 0x00000078,
+	0x00000000, 0x00000080, 0x00000100, 0x00000180, 0x00000200, 0x00000280, 0x00000300, 0x00000380,
+	0x00000400, 0x00000480, 0x00000500, 0x00000580, 0x00000600, 0x00000680, 0x00000700, 0x00000780,
+	0x00000000, 0x00000800, 0x00001000, 0x00001800, 0x00002000, 0x00002800, 0x00003000, 0x00003800,
+	0x00004000, 0x00004800, 0x00005000, 0x00005800, 0x00006000, 0x00006800, 0x00007000, 0x00007800,
+	0x00000000, 0x00008000, 0x00010000, 0x00018000, 0x00020000, 0x00028000, 0x00030000, 0x00038000,
+	0x00040000, 0x00048000, 0x00050000, 0x00058000, 0x00060000, 0x00068000, 0x00070000, 0x00078000,
+	0x00000000, 0x00080000, 0x00100000, 0x00180000, 0x00200000, 0x00280000, 0x00300000, 0x00380000,
+	0x00400000, 0x00480000, 0x00500000, 0x00580000, 0x00600000, 0x00680000, 0x00700000, 0x00780000,
+	0x00000000, 0x00000303, 0x00000606, 0x00000505, 0x00000c0c, 0x00000f0f, 0x00000a0a, 0x00000909,
+	0x00001818, 0x00001b1b, 0x00001e1e, 0x00001d1d, 0x00001414, 0x00001717, 0x00001212, 0x00001111,
+	0x00000000, 0x00003030, 0x00006060, 0x00005050, 0x0000c0c0, 0x0000f0f0, 0x0000a0a0, 0x00009090,
+	0x00018180, 0x0001b1b0, 0x0001e1e0, 0x0001d1d0, 0x00014140, 0x00017170, 0x00012120, 0x00011110,
+	0x00000000, 0x00600141, 0x00400181, 0x002000c0, 0x00000001, 0x00600140, 0x00400180, 0x002000c1,
+	0x00000002, 0x00600143, 0x00400183, 0x002000c2, 0x00000003, 0x00600142, 0x00400182, 0x002000c3,
+	0x00000000, 0x00000004, 0x00000008, 0x0000000c, 0x00000010, 0x00000014, 0x00000018, 0x0000001c,
+	0x00000020, 0x00000024, 0x00000028, 0x0000002c, 0x00000030, 0x00000034, 0x00000038, 0x0000003c,
+	0x00000000, 0x00000040, 0x00000080, 0x000000c0, 0x00000100, 0x00000140, 0x00000180, 0x000001c0,
+	0x00000200, 0x00000240, 0x00000280, 0x000002c0, 0x00000300, 0x00000340, 0x00000380, 0x000003c0,
+	0x00000000, 0x00000400, 0x00000800, 0x00000c00, 0x00001000, 0x00001400, 0x00001800, 0x00001c00,
+	0x00002000, 0x00002400, 0x00002800, 0x00002c00, 0x00003000, 0x00003400, 0x00003800, 0x00003c00,
+	0x00000000, 0x00004000, 0x00008000, 0x0000c000, 0x00010000, 0x00014000, 0x00018000, 0x0001c000,
+	0x00020000, 0x00024000, 0x00028000, 0x0002c000, 0x00030000, 0x00034000, 0x00038000, 0x0003c000,
+	0x00000000, 0x00040000, 0x00080000, 0x000c0000, 0x00100000, 0x00140000, 0x00180000, 0x001c0000,
+	0x00200000, 0x00240000, 0x00280000, 0x002c0000, 0x00300000, 0x00340000, 0x00380000, 0x003c0000,
+	0x00000000, 0x00400000, 0x00000303, 0x00400303, 0x00000606, 0x00400606, 0x00000505, 0x00400505,
+	0x00000c0c, 0x00400c0c, 0x00000f0f, 0x00400f0f, 0x00000a0a, 0x00400a0a, 0x00000909, 0x00400909,
+	0x00000000, 0x00001818, 0x00003030, 0x00002828, 0x00006060, 0x00007878, 0x00005050, 0x00004848,
+	0x0000c0c0, 0x0000d8d8, 0x0000f0f0, 0x0000e8e8, 0x0000a0a0, 0x0000b8b8, 0x00009090, 0x00008888,
+	0x00000000, 0x00780111, 0x00700121, 0x00080030, 0x00600141, 0x00180050, 0x00100060, 0x00680171,
+	0x00400181, 0x00380090, 0x003000a0, 0x004801b1, 0x002000c0, 0x005801d1, 0x005001e1, 0x002800f0,
+	0x00000000, 0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006, 0x00000007,
+	0x00000008, 0x00000009, 0x0000000a, 0x0000000b, 0x0000000c, 0x0000000d, 0x0000000e, 0x0000000f,
+	0x00000000, 0x00000010, 0x00000020, 0x00000030, 0x00000040, 0x00000050, 0x00000060, 0x00000070,
+	0x00000080, 0x00000090, 0x000000a0, 0x000000b0, 0x000000c0, 0x000000d0, 0x000000e0, 0x000000f0,
+	0x00000000, 0x00000100, 0x00000200, 0x00000300, 0x00000400, 0x00000500, 0x00000600, 0x00000700,
+	0x00000800, 0x00000900, 0x00000a00, 0x00000b00, 0x00000c00, 0x00000d00, 0x00000e00, 0x00000f00,
+	0x00000000, 0x00001000, 0x00002000, 0x00003000, 0x00004000, 0x00005000, 0x00006000, 0x00007000,
+	0x00008000, 0x00009000, 0x0000a000, 0x0000b000, 0x0000c000, 0x0000d000, 0x0000e000, 0x0000f000,
+	0x00000000, 0x00010000, 0x00020000, 0x00030000, 0x00040000, 0x00050000, 0x00060000, 0x00070000,
+	0x00080000, 0x00090000, 0x000a0000, 0x000b0000, 0x000c0000, 0x000d0000, 0x000e0000, 0x000f0000,
+	0x00000000, 0x00100000, 0x00200000, 0x00300000, 0x00400000, 0x00500000, 0x00600000, 0x00700000,
+	0x00000303, 0x00100303, 0x00200303, 0x00300303, 0x00400303, 0x00500303, 0x00600303, 0x00700303,
+	0x00000000, 0x00000606, 0x00000c0c, 0x00000a0a, 0x00001818, 0x00001e1e, 0x00001414, 0x00001212,
+	0x00003030, 0x00003636, 0x00003c3c, 0x00003a3a, 0x00002828, 0x00002e2e, 0x00002424, 0x00002222,
+	0x00000000, 0x007f8100, 0x007f0103, 0x00008003, 0x007e0105, 0x00018005, 0x00010006, 0x007e8106,
+	0x007c0109, 0x00038009, 0x0003000a, 0x007c810a, 0x0002000c, 0x007d810c, 0x007d010f, 0x0002800f,
+	0x00000000, 0x00780111, 0x00700121, 0x00080030, 0x00600141, 0x00180050, 0x00100060, 0x00680171,
+	0x00400181, 0x00380090, 0x003000a0, 0x004801b1, 0x002000c0, 0x005801d1, 0x005001e1, 0x002800f0,
+	0x00000000, 0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006, 0x00000007,
+	0x00000008, 0x00000009, 0x0000000a, 0x0000000b, 0x0000000c, 0x0000000d, 0x0000000e, 0x0000000f,
+	0x00000000, 0x00000010, 0x00000020, 0x00000030, 0x00000040, 0x00000050, 0x00000060, 0x00000070,
+	0x00000080, 0x00000090, 0x000000a0, 0x000000b0, 0x000000c0, 0x000000d0, 0x000000e0, 0x000000f0,
+	0x00000000, 0x00000100, 0x00000200, 0x00000300, 0x00000400, 0x00000500, 0x00000600, 0x00000700,
+	0x00000800, 0x00000900, 0x00000a00, 0x00000b00, 0x00000c00, 0x00000d00, 0x00000e00, 0x00000f00,
+	0x00000000, 0x00001000, 0x00002000, 0x00003000, 0x00004000, 0x00005000, 0x00006000, 0x00007000,
+	0x00008000, 0x00009000, 0x0000a000, 0x0000b000, 0x0000c000, 0x0000d000, 0x0000e000, 0x0000f000,
+	0x00000000, 0x00010000, 0x00020000, 0x00030000, 0x00040000, 0x00050000, 0x00060000, 0x00070000,
+	0x00080000, 0x00090000, 0x000a0000, 0x000b0000, 0x000c0000, 0x000d0000, 0x000e0000, 0x000f0000,
+	0x00000000, 0x00100000, 0x00200000, 0x00300000, 0x00400000, 0x00500000, 0x00600000, 0x00700000,
+	0x00000303, 0x00100303, 0x00200303, 0x00300303, 0x00400303, 0x00500303, 0x00600303, 0x00700303,
+	0x00000000, 0x00007f81, 0x0000ff02, 0x00008083, 0x0001fe04, 0x00018185, 0x00010106, 0x00017e87,
+	0x0003fc08, 0x00038389, 0x0003030a, 0x00037c8b, 0x0002020c, 0x00027d8d, 0x0002fd0e, 0x0002828f,
+	0x00000000, 0x0007f810, 0x000ff020, 0x00080830, 0x001fe040, 0x00181850, 0x00101060, 0x0017e870,
+	0x003fc080, 0x00383890, 0x003030a0, 0x0037c8b0, 0x002020c0, 0x0027d8d0, 0x002fd0e0, 0x002828f0,
+	0x00000000, 0x007f8100, 0x007f0103, 0x00008003, 0x007e0105, 0x00018005, 0x00010006, 0x007e8106,
+	0x007c0109, 0x00038009, 0x0003000a, 0x007c810a, 0x0002000c, 0x007d810c, 0x007d010f, 0x0002800f,
+	0x00000000, 0x00780111, 0x00700121, 0x00080030, 0x00600141, 0x00180050, 0x00100060, 0x00680171,
+	0x00400181, 0x00380090, 0x003000a0, 0x004801b1, 0x002000c0, 0x005801d1, 0x005001e1, 0x002800f0,
+	0x00000000, 0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006, 0x00000007,
+	0x00000008, 0x00000009, 0x0000000a, 0x0000000b, 0x0000000c, 0x0000000d, 0x0000000e, 0x0000000f,
+	0x00000000, 0x00000010, 0x00000020, 0x00000030, 0x00000040, 0x00000050, 0x00000060, 0x00000070,
+	0x00000080, 0x00000090, 0x000000a0, 0x000000b0, 0x000000c0, 0x000000d0, 0x000000e0, 0x000000f0,
+	0x00000000, 0x00000100, 0x00000200, 0x00000300, 0x00000400, 0x00000500, 0x00000600, 0x00000700,
+	0x00000800, 0x00000900, 0x00000a00, 0x00000b00, 0x00000c00, 0x00000d00, 0x00000e00, 0x00000f00,
+	0x00000000, 0x00001000, 0x00002000, 0x00003000, 0x00004000, 0x00005000, 0x00006000, 0x00007000,
+	0x00008000, 0x00009000, 0x0000a000, 0x0000b000, 0x0000c000, 0x0000d000, 0x0000e000, 0x0000f000,
+	0x00000000, 0x00553e7f, 0x002a7ffd, 0x007f4182, 0x0054fffa, 0x0001c185, 0x007e8007, 0x002bbe78,
+	0x0029fcf7, 0x007cc288, 0x0003830a, 0x0056bd75, 0x007d030d, 0x00283d72, 0x00577cf0, 0x0002428f,
+	0x00000000, 0x0053f9ee, 0x0027f0df, 0x00740931, 0x004fe1be, 0x001c1850, 0x00681161, 0x003be88f,
+	0x001fc07f, 0x004c3991, 0x003830a0, 0x006bc94e, 0x005021c1, 0x0003d82f, 0x0077d11e, 0x002428f0,
+	0x00000000, 0x003f80fe, 0x007f01fc, 0x00408102, 0x007e00fb, 0x00418005, 0x00010107, 0x003e81f9,
+	0x007c02f5, 0x0043820b, 0x00030309, 0x003c83f7, 0x0002020e, 0x003d82f0, 0x007d03f2, 0x0042830c,
+	0x00000000, 0x007806e9, 0x00700ed1, 0x00080838, 0x00601ea1, 0x00181848, 0x00101070, 0x00681699,
+	0x00403e41, 0x003838a8, 0x00303090, 0x00483679, 0x002020e0, 0x00582609, 0x00502e31, 0x002828d8,
+	0x00000000, 0x00007f81, 0x0000ff02, 0x00008083, 0x0001fe04, 0x00018185, 0x00010106, 0x00017e87,
+	0x0003fc08, 0x00038389, 0x0003030a, 0x00037c8b, 0x0002020c, 0x00027d8d, 0x0002fd0e, 0x0002828f,
+	0x00000000, 0x0007f810, 0x000ff020, 0x00080830, 0x001fe040, 0x00181850, 0x00101060, 0x0017e870,
+	0x003fc080, 0x00383890, 0x003030a0, 0x0037c8b0, 0x002020c0, 0x0027d8d0, 0x002fd0e0, 0x002828f0,
+	0x00000000, 0x007f8100, 0x007f0103, 0x00008003, 0x007e0105, 0x00018005, 0x00010006, 0x007e8106,
+	0x007c0109, 0x00038009, 0x0003000a, 0x007c810a, 0x0002000c, 0x007d810c, 0x007d010f, 0x0002800f,
+	0x00000000, 0x00780111, 0x00700121, 0x00080030, 0x00600141, 0x00180050, 0x00100060, 0x00680171,
+	0x00400181, 0x00380090, 0x003000a0, 0x004801b1, 0x002000c0, 0x005801d1, 0x005001e1, 0x002800f0,
+	0x00000000, 0x0055381f, 0x002a733d, 0x007f4b22, 0x0054e67a, 0x0001de65, 0x007e9547, 0x002bad58,
+	0x0029cff7, 0x007cf7e8, 0x0003bcca, 0x005684d5, 0x007d298d, 0x00281192, 0x00575ab0, 0x000262af,
+	0x00000000, 0x00539fee, 0x00273cdf, 0x0074a331, 0x004e79be, 0x001de650, 0x00694561, 0x003ada8f,
+	0x001cf07f, 0x004f6f91, 0x003bcca0, 0x0068534e, 0x005289c1, 0x0001162f, 0x0075b51e, 0x00262af0,
+	0x00000000, 0x0039e0fe, 0x0073c1fc, 0x004a2102, 0x006780fb, 0x005e6005, 0x00144107, 0x002da1f9,
+	0x004f02f5, 0x0076e20b, 0x003cc309, 0x000523f7, 0x0028820e, 0x001162f0, 0x005b43f2, 0x0062a30c,
+	0x00000000, 0x001e06e9, 0x003c0dd2, 0x00220b3b, 0x00781ba4, 0x00661d4d, 0x00441676, 0x005a109f,
+	0x0070344b, 0x006e32a2, 0x004c3999, 0x00523f70, 0x00082fef, 0x00162906, 0x0034223d, 0x002a24d4,
+	0x00000000, 0x00606b95, 0x0040d429, 0x0020bfbc, 0x0001ab51, 0x0061c0c4, 0x00417f78, 0x002114ed,
+	0x000356a2, 0x00633d37, 0x0043828b, 0x0023e91e, 0x0002fdf3, 0x00629666, 0x004229da, 0x0022424f,
+	0x00000000, 0x0006ad44, 0x000d5a88, 0x000bf7cc, 0x001ab510, 0x001c1854, 0x0017ef98, 0x001142dc,
+	0x00356a20, 0x0033c764, 0x003830a8, 0x003e9dec, 0x002fdf30, 0x00297274, 0x002285b8, 0x002428fc,
+	0x00000000, 0x006ad440, 0x0055ab83, 0x003f7fc3, 0x002b5405, 0x00418045, 0x007eff86, 0x00142bc6,
+	0x0056a80a, 0x003c7c4a, 0x00030389, 0x0069d7c9, 0x007dfc0f, 0x0017284f, 0x0028578c, 0x004283cc,
+	0x00000000, 0x002d5317, 0x005aa62e, 0x0077f539, 0x00354f5f, 0x00181c48, 0x006fe971, 0x0042ba66,
+	0x006a9ebe, 0x0047cda9, 0x00303890, 0x001d6b87, 0x005fd1e1, 0x007282f6, 0x000577cf, 0x002824d8,
+	0x00000000, 0x00412c1f, 0x00025b3d, 0x00437722, 0x0004b67a, 0x00459a65, 0x0006ed47, 0x0047c158,
+	0x00096cf4, 0x004840eb, 0x000b37c9, 0x004a1bd6, 0x000dda8e, 0x004cf691, 0x000f81b3, 0x004eadac,
+	0x00000000, 0x0012d9e8, 0x0025b3d0, 0x00376a38, 0x004b67a0, 0x0059be48, 0x006ed470, 0x007c0d98,
+	0x0016cc43, 0x000415ab, 0x00337f93, 0x0021a67b, 0x005dabe3, 0x004f720b, 0x00781833, 0x006ac1db,
+	0x00000000, 0x002d9886, 0x005b310c, 0x0076a98a, 0x0036611b, 0x001bf99d, 0x006d5017, 0x0040c891,
+	0x006cc236, 0x00415ab0, 0x0037f33a, 0x001a6bbc, 0x005aa32d, 0x00773bab, 0x00019221, 0x002c0aa7,
+	0x00000000, 0x0059876f, 0x00330ddd, 0x006a8ab2, 0x00661bba, 0x003f9cd5, 0x00551667, 0x000c9108,
+	0x004c3477, 0x0015b318, 0x007f39aa, 0x0026bec5, 0x002a2fcd, 0x0073a8a2, 0x00192210, 0x0040a57f,
+	0x00000000, 0x00186bed, 0x0030d7da, 0x0028bc37, 0x0061afb4, 0x0079c459, 0x0051786e, 0x00491383,
+	0x00435c6b, 0x005b3786, 0x00738bb1, 0x006be05c, 0x0022f3df, 0x003a9832, 0x00122405, 0x000a4fe8,
+	0x00000000, 0x0006bbd5, 0x000d77aa, 0x000bcc7f, 0x001aef54, 0x001c5481, 0x001798fe, 0x0011232b,
+	0x0035dea8, 0x0033657d, 0x0038a902, 0x003e12d7, 0x002f31fc, 0x00298a29, 0x00224656, 0x0024fd83,
+	0x00000000, 0x006bbd50, 0x005779a3, 0x003cc4f3, 0x002ef045, 0x00454d15, 0x007989e6, 0x001234b6,
+	0x005de08a, 0x00365dda, 0x000a9929, 0x00612479, 0x007310cf, 0x0018ad9f, 0x0024696c, 0x004fd43c,
+	0x00000000, 0x003bc217, 0x0077842e, 0x004c4639, 0x006f0b5f, 0x0054c948, 0x00188f71, 0x00234d66,
+	0x005e15bd, 0x0065d7aa, 0x00299193, 0x00125384, 0x00311ee2, 0x000adcf5, 0x00469acc, 0x007d58db,
+	0x00000000, 0x00375e0d, 0x006ebc1a, 0x0059e217, 0x005d7b37, 0x006a253a, 0x0033c72d, 0x00049920,
+	0x003af56d, 0x000dab60, 0x00544977, 0x0063177a, 0x00678e5a, 0x0050d057, 0x00093240, 0x003e6c4d,
+	0x00000000, 0x0075eada, 0x006bd6b7, 0x001e3c6d, 0x0057ae6d, 0x002244b7, 0x003c78da, 0x00499200,
+	0x002f5fd9, 0x005ab503, 0x0044896e, 0x003163b4, 0x0078f1b4, 0x000d1b6e, 0x00132703, 0x0066cdd9,
+	0x00000000, 0x005ebfb2, 0x003d7c67, 0x0063c3d5, 0x007af8ce, 0x0024477c, 0x004784a9, 0x00193b1b,
+	0x0075f29f, 0x002b4d2d, 0x00488ef8, 0x0016314a, 0x000f0a51, 0x0051b5e3, 0x00327636, 0x006cc984,
+	0x00000000, 0x006be63d, 0x0057cf79, 0x003c2944, 0x002f9df1, 0x00447bcc, 0x00785288, 0x0013b4b5,
+	0x005f3be2, 0x0034dddf, 0x0008f49b, 0x006312a6, 0x0070a613, 0x001b402e, 0x0027696a, 0x004c8f57,
+	0x00000000, 0x003e74c7, 0x007ce98e, 0x00429d49, 0x0079d01f, 0x0047a4d8, 0x00053991, 0x003b4d56,
+	0x0073a33d, 0x004dd7fa, 0x000f4ab3, 0x00313e74, 0x000a7322, 0x003407e5, 0x00769aac, 0x0048ee6b,
+	0x00000000, 0x00674579, 0x004e89f1, 0x0029cc88, 0x001d10e1, 0x007a5598, 0x00539910, 0x0034dc69,
+	0x003a21c2, 0x005d64bb, 0x0074a833, 0x0013ed4a, 0x00273123, 0x0040745a, 0x0069b8d2, 0x000efdab,
+	0x00000000, 0x00744384, 0x0068840b, 0x001cc78f, 0x00510b15, 0x00254891, 0x00398f1e, 0x004dcc9a,
+	0x00221529, 0x005656ad, 0x004a9122, 0x003ed2a6, 0x00731e3c, 0x00075db8, 0x001b9a37, 0x006fd9b3,
+	0x00000000, 0x00442a52, 0x000857a7, 0x004c7df5, 0x0010af4e, 0x0054851c, 0x0018f8e9, 0x005cd2bb,
+	0x00215e9c, 0x006574ce, 0x0029093b, 0x006d2369, 0x0031f1d2, 0x0075db80, 0x0039a675, 0x007d8c27,
+};
+
+//Noise value after d * 16^p steps, xor of the entries for every nibble
+static const Bit32u NoiseCountTable[ 6144 ] = {
+	0x00000000, 0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006, 0x00000007,
+	0x00000008, 0x00000009, 0x0000000a, 0x0000000b, 0x0000000c, 0x0000000d, 0x0000000e, 0x0000000f,
+	0x00000000, 0x00000010, 0x00000020, 0x00000030, 0x00000040, 0x00000050, 0x00000060, 0x00000070,
+	0x00000080, 0x00000090, 0x000000a0, 0x000000b0, 0x000000c0, 0x000000d0, 0x000000e0, 0x000000f0,
+	0x00000000, 0x00000100, 0x00000200, 0x00000300, 0x00000400, 0x00000500, 0x00000600, 0x00000700,
+	0x00000800, 0x00000900, 0x00000a00, 0x00000b00, 0x00000c00, 0x00000d00, 0x00000e00, 0x00000f00,
+	0x00000000, 0x00001000, 0x00002000, 0x00003000, 0x00004000, 0x00005000, 0x00006000, 0x00007000,
+	0x00008000, 0x00009000, 0x0000a000, 0x0000b000, 0x0000c000, 0x0000d000, 0x0000e000, 0x0000f000,
+	0x00000000, 0x00010000, 0x00020000, 0x00030000, 0x00040000, 0x00050000, 0x00060000, 0x00070000,
+	0x00080000, 0x00090000, 0x000a0000, 0x000b0000, 0x000c0000, 0x000d0000, 0x000e0000, 0x000f0000,
+	0x00000000, 0x00100000, 0x00200000, 0x00300000, 0x00400000, 0x00500000, 0x00600000, 0x00700000,
+	0x00800000, 0x00900000, 0x00a00000, 0x00b00000, 0x00c00000, 0x00d00000, 0x00e00000, 0x00f00000,
+	0x00000000, 0x01000000, 0x02000000, 0x03000000, 0x04000000, 0x05000000, 0x06000000, 0x07000000,
+	0x08000000, 0x09000000, 0x0a000000, 0x0b000000, 0x0c000000, 0x0d000000, 0x0e000000, 0x0f000000,
+	0x00000000, 0x10000000, 0x20000000, 0x30000000, 0x40000000, 0x50000000, 0x60000000, 0x70000000,
+	0x80000000, 0x90000000, 0xa0000000, 0xb0000000, 0xc0000000, 0xd0000000, 0xe0000000, 0xf0000000,
+	0x00000000, 0x00400181, 0x00000001, 0x00400180, 0x00000002, 0x00400183, 0x00000003, 0x00400182,
+	0x00000004, 0x00400185, 0x00000005, 0x00400184, 0x00000006, 0x00400187, 0x00000007, 0x00400186,
+	0x00000000, 0x00000008, 0x00000010, 0x00000018, 0x00000020, 0x00000028, 0x00000030, 0x00000038,
+	0x00000040, 0x00000048, 0x00000050, 0x00000058, 0x00000060, 0x00000068, 0x00000070, 0x00000078,
+	0x00000000, 0x00000080, 0x00000100, 0x00000180, 0x00000200, 0x00000280, 0x00000300, 0x00000380,
+	0x00000400, 0x00000480, 0x00000500, 0x00000580, 0x00000600, 0x00000680, 0x00000700, 0x00000780,
+	0x00000000, 0x00000800, 0x00001000, 0x00001800, 0x00002000, 0x00002800, 0x00003000, 0x00003800,
+	0x00004000, 0x00004800, 0x00005000, 0x00005800, 0x00006000, 0x00006800, 0x00007000, 0x00007800,
+	0x00000000, 0x00008000, 0x00010000, 0x00018000, 0x00020000, 0x00028000, 0x00030000, 0x00038000,
+	0x00040000, 0x00048000, 0x00050000, 0x00058000, 0x00060000, 0x00068000, 0x00070000, 0x00078000,
+	0x00000000, 0x00080000, 0x00100000, 0x00180000, 0x00200000, 0x00280000, 0x00300000, 0x00380000,
+	0x00400000, 0x00480000, 0x00500000, 0x00580000, 0x00600000, 0x00680000, 0x00700000, 0x00780000,
+	0x00000000, 0x00800000, 0x01000000, 0x01800000, 0x02000000, 0x02800000, 0x03000000, 0x03800000,
+	0x04000000, 0x04800000, 0x05000000, 0x05800000, 0x06000000, 0x06800000, 0x07000000, 0x07800000,
+	0x00000000, 0x08000000, 0x10000000, 0x18000000, 0x20000000, 0x28000000, 0x30000000, 0x38000000,
+	0x40000000, 0x48000000, 0x50000000, 0x58000000, 0x60000000, 0x68000000, 0x70000000, 0x78000000,
+	0x00000000, 0x00600141, 0x00400181, 0x002000c0, 0x00000001, 0x00600140, 0x00400180, 0x002000c1,
+	0x00000002, 0x00600143, 0x00400183, 0x002000c2, 0x00000003, 0x00600142, 0x00400182, 0x002000c3,
+	0x00000000, 0x00000004, 0x00000008, 0x0000000c, 0x00000010, 0x00000014, 0x00000018, 0x0000001c,
+	0x00000020, 0x00000024, 0x00000028, 0x0000002c, 0x00000030, 0x00000034, 0x00000038, 0x0000003c,
+	0x00000000, 0x00000040, 0x00000080, 0x000000c0, 0x00000100, 0x00000140, 0x00000180, 0x000001c0,
+	0x00000200, 0x00000240, 0x00000280, 0x000002c0, 0x00000300, 0x00000340, 0x00000380, 0x000003c0,
+	0x00000000, 0x00000400, 0x00000800, 0x00000c00, 0x00001000, 0x00001400, 0x00001800, 0x00001c00,
+	0x00002000, 0x00002400, 0x00002800, 0x00002c00, 0x00003000, 0x00003400, 0x00003800, 0x00003c00,
+	0x00000000, 0x00004000, 0x00008000, 0x0000c000, 0x00010000, 0x00014000, 0x00018000, 0x0001c000,
+	0x00020000, 0x00024000, 0x00028000, 0x0002c000, 0x00030000, 0x00034000, 0x00038000, 0x0003c000,
+	0x00000000, 0x00040000, 0x00080000, 0x000c0000, 0x00100000, 0x00140000, 0x00180000, 0x001c0000,
+	0x00200000, 0x00240000, 0x00280000, 0x002c0000, 0x00300000, 0x00340000, 0x00380000, 0x003c0000,
+	0x00000000, 0x00400000, 0x00800000, 0x00c00000, 0x01000000, 0x01400000, 0x01800000, 0x01c00000,
+	0x02000000, 0x02400000, 0x02800000, 0x02c00000, 0x03000000, 0x03400000, 0x03800000, 0x03c00000,
+	0x00000000, 0x04000000, 0x08000000, 0x0c000000, 0x10000000, 0x14000000, 0x18000000, 0x1c000000,
+	0x20000000, 0x24000000, 0x28000000, 0x2c000000, 0x30000000, 0x34000000, 0x38000000, 0x3c000000,
+	0x00000000, 0x00700121, 0x00600141, 0x00100060, 0x00400181, 0x003000a0, 0x002000c0, 0x005001e1,
+	0x00000001, 0x00700120, 0x00600140, 0x00100061, 0x00400180, 0x003000a1, 0x002000c1, 0x005001e0,
+	0x00000000, 0x00000002, 0x00000004, 0x00000006, 0x00000008, 0x0000000a, 0x0000000c, 0x0000000e,
+	0x00000010, 0x00000012, 0x00000014, 0x00000016, 0x00000018, 0x0000001a, 0x0000001c, 0x0000001e,
+	0x00000000, 0x00000020, 0x00000040, 0x00000060, 0x00000080, 0x000000a0, 0x000000c0, 0x000000e0,
+	0x00000100, 0x00000120, 0x00000140, 0x00000160, 0x00000180, 0x000001a0, 0x000001c0, 0x000001e0,
+	0x00000000, 0x00000200, 0x00000400, 0x00000600, 0x00000800, 0x00000a00, 0x00000c00, 0x00000e00,
+	0x00001000, 0x00001200, 0x00001400, 0x00001600, 0x00001800, 0x00001a00, 0x00001c00, 0x00001e00,
+	0x00000000, 0x00002000, 0x00004000, 0x00006000, 0x00008000, 0x0000a000, 0x0000c000, 0x0000e000,
+	0x00010000, 0x00012000, 0x00014000, 0x00016000, 0x00018000, 0x0001a000, 0x0001c000, 0x0001e000,
+	0x00000000, 0x00020000, 0x00040000, 0x00060000, 0x00080000, 0x000a0000, 0x000c0000, 0x000e0000,
+	0x00100000, 0x00120000, 0x00140000, 0x00160000, 0x00180000, 0x001a0000, 0x001c0000, 0x001e0000,
+	0x00000000, 0x00200000, 0x00400000, 0x00600000, 0x00800000, 0x00a00000, 0x00c00000, 0x00e00000,
+	0x01000000, 0x01200000, 0x01400000, 0x01600000, 0x01800000, 0x01a00000, 0x01c00000, 0x01e00000,
+	0x00000000, 0x02000000, 0x04000000, 0x06000000, 0x08000000, 0x0a000000, 0x0c000000, 0x0e000000,
+	0x10000000, 0x12000000, 0x14000000, 0x16000000, 0x18000000, 0x1a000000, 0x1c000000, 0x1e000000,
+	0x00000000, 0x00780111, 0x00700121, 0x00080030, 0x00600141, 0x00180050, 0x00100060, 0x00680171,
+	0x00400181, 0x00380090, 0x003000a0, 0x004801b1, 0x002000c0, 0x005801d1, 0x005001e1, 0x002800f0,
+	0x00000000, 0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006, 0x00000007,
+	0x00000008, 0x00000009, 0x0000000a, 0x0000000b, 0x0000000c, 0x0000000d, 0x0000000e, 0x0000000f,
+	0x00000000, 0x00000010, 0x00000020, 0x00000030, 0x00000040, 0x00000050, 0x00000060, 0x00000070,
+	0x00000080, 0x00000090, 0x000000a0, 0x000000b0, 0x000000c0, 0x000000d0, 0x000000e0, 0x000000f0,
+	0x00000000, 0x00000100, 0x00000200, 0x00000300, 0x00000400, 0x00000500, 0x00000600, 0x00000700,
+	0x00000800, 0x00000900, 0x00000a00, 0x00000b00, 0x00000c00, 0x00000d00, 0x00000e00, 0x00000f00,
+	0x00000000, 0x00001000, 0x00002000, 0x00003000, 0x00004000, 0x00005000, 0x00006000, 0x00007000,
+	0x00008000, 0x00009000, 0x0000a000, 0x0000b000, 0x0000c000, 0x0000d000, 0x0000e000, 0x0000f000,
+	0x00000000, 0x00010000, 0x00020000, 0x00030000, 0x00040000, 0x00050000, 0x00060000, 0x00070000,
+	0x00080000, 0x00090000, 0x000a0000, 0x000b0000, 0x000c0000, 0x000d0000, 0x000e0000, 0x000f0000,
+	0x00000000, 0x00100000, 0x00200000, 0x00300000, 0x00400000, 0x00500000, 0x00600000, 0x00700000,
+	0x00800000, 0x00900000, 0x00a00000, 0x00b00000, 0x00c00000, 0x00d00000, 0x00e00000, 0x00f00000,
+	0x00000000, 0x01000000, 0x02000000, 0x03000000, 0x04000000, 0x05000000, 0x06000000, 0x07000000,
+	0x08000000, 0x09000000, 0x0a000000, 0x0b000000, 0x0c000000, 0x0d000000, 0x0e000000, 0x0f000000,
+	0x00000000, 0x007c0109, 0x00780111, 0x00040018, 0x00700121, 0x000c0028, 0x00080030, 0x00740139,
+	0x00600141, 0x001c0048, 0x00180050, 0x00640159, 0x00100060, 0x006c0169, 0x00680171, 0x00140078,
+	0x00000000, 0x00400181, 0x00000001, 0x00400180, 0x00000002, 0x00400183, 0x00000003, 0x00400182,
+	0x00000004, 0x00400185, 0x00000005, 0x00400184, 0x00000006, 0x00400187, 0x00000007, 0x00400186,
+	0x00000000, 0x00000008, 0x00000010, 0x00000018, 0x00000020, 0x00000028, 0x00000030, 0x00000038,
+	0x00000040, 0x00000048, 0x00000050, 0x00000058, 0x00000060, 0x00000068, 0x00000070, 0x00000078,
+	0x00000000, 0x00000080, 0x00000100, 0x00000180, 0x00000200, 0x00000280, 0x00000300, 0x00000380,
+	0x00000400, 0x00000480, 0x00000500, 0x00000580, 0x00000600, 0x00000680, 0x00000700, 0x00000780,
+	0x00000000, 0x00000800, 0x00001000, 0x00001800, 0x00002000, 0x00002800, 0x00003000, 0x00003800,
+	0x00004000, 0x00004800, 0x00005000, 0x00005800, 0x00006000, 0x00006800, 0x00007000, 0x00007800,
+	0x00000000, 0x00008000, 0x00010000, 0x00018000, 0x00020000, 0x00028000, 0x00030000, 0x00038000,
+	0x00040000, 0x00048000, 0x00050000, 0x00058000, 0x00060000, 0x00068000, 0x00070000, 0x00078000,
+	0x00000000, 0x00080000, 0x00100000, 0x00180000, 0x00200000, 0x00280000, 0x00300000, 0x00380000,
+	0x00400000, 0x00480000, 0x00500000, 0x00580000, 0x00600000, 0x00680000, 0x00700000, 0x00780000,
+	0x00000000, 0x00800000, 0x01000000, 0x01800000, 0x02000000, 0x02800000, 0x03000000, 0x03800000,
+	0x04000000, 0x04800000, 0x05000000, 0x05800000, 0x06000000, 0x06800000, 0x07000000, 0x07800000,
+	0x00000000, 0x007e0105, 0x007c0109, 0x0002000c, 0x00780111, 0x00060014, 0x00040018, 0x007a011d,
+	0x00700121, 0x000e0024, 0x000c0028, 0x0072012d, 0x00080030, 0x00760135, 0x00740139, 0x000a003c,
+	0x00000000, 0x00600141, 0x00400181, 0x002000c0, 0x00000001, 0x00600140, 0x00400180, 0x002000c1,
+	0x00000002, 0x00600143, 0x00400183, 0x002000c2, 0x00000003, 0x00600142, 0x00400182, 0x002000c3,
+	0x00000000, 0x00000004, 0x00000008, 0x0000000c, 0x00000010, 0x00000014, 0x00000018, 0x0000001c,
+	0x00000020, 0x00000024, 0x00000028, 0x0000002c, 0x00000030, 0x00000034, 0x00000038, 0x0000003c,
+	0x00000000, 0x00000040, 0x00000080, 0x000000c0, 0x00000100, 0x00000140, 0x00000180, 0x000001c0,
+	0x00000200, 0x00000240, 0x00000280, 0x000002c0, 0x00000300, 0x00000340, 0x00000380, 0x000003c0,
+	0x00000000, 0x00000400, 0x00000800, 0x00000c00, 0x00001000, 0x00001400, 0x00001800, 0x00001c00,
+	0x00002000, 0x00002400, 0x00002800, 0x00002c00, 0x00003000, 0x00003400, 0x00003800, 0x00003c00,
+	0x00000000, 0x00004000, 0x00008000, 0x0000c000, 0x00010000, 0x00014000, 0x00018000, 0x0001c000,
+	0x00020000, 0x00024000, 0x00028000, 0x0002c000, 0x00030000, 0x00034000, 0x00038000, 0x0003c000,
+	0x00000000, 0x00040000, 0x00080000, 0x000c0000, 0x00100000, 0x00140000, 0x00180000, 0x001c0000,
+	0x00200000, 0x00240000, 0x00280000, 0x002c0000, 0x00300000, 0x00340000, 0x00380000, 0x003c0000,
+	0x00000000, 0x00400000, 0x00800000, 0x00c00000, 0x01000000, 0x01400000, 0x01800000, 0x01c00000,
+	0x02000000, 0x02400000, 0x02800000, 0x02c00000, 0x03000000, 0x03400000, 0x03800000, 0x03c00000,
+	0x00000000, 0x007f0103, 0x007e0105, 0x00010006, 0x007c0109, 0x0003000a, 0x0002000c, 0x007d010f,
+	0x00780111, 0x00070012, 0x00060014, 0x00790117, 0x00040018, 0x007b011b, 0x007a011d, 0x0005001e,
+	0x00000000, 0x00700121, 0x00600141, 0x00100060, 0x00400181, 0x003000a0, 0x002000c0, 0x005001e1,
+	0x00000001, 0x00700120, 0x00600140, 0x00100061, 0x00400180, 0x003000a1, 0x002000c1, 0x005001e0,
+	0x00000000, 0x00000002, 0x00000004, 0x00000006, 0x00000008, 0x0000000a, 0x0000000c, 0x0000000e,
+	0x00000010, 0x00000012, 0x00000014, 0x00000016, 0x00000018, 0x0000001a, 0x0000001c, 0x0000001e,
+	0x00000000, 0x00000020, 0x00000040, 0x00000060, 0x00000080, 0x000000a0, 0x000000c0, 0x000000e0,
+	0x00000100, 0x00000120, 0x00000140, 0x00000160, 0x00000180, 0x000001a0, 0x000001c0, 0x000001e0,
+	0x00000000, 0x00000200, 0x00000400, 0x00000600, 0x00000800, 0x00000a00, 0x00000c00, 0x00000e00,
+	0x00001000, 0x00001200, 0x00001400, 0x00001600, 0x00001800, 0x00001a00, 0x00001c00, 0x00001e00,
+	0x00000000, 0x00002000, 0x00004000, 0x00006000, 0x00008000, 0x0000a000, 0x0000c000, 0x0000e000,
+	0x00010000, 0x00012000, 0x00014000, 0x00016000, 0x00018000, 0x0001a000, 0x0001c000, 0x0001e000,
+	0x00000000, 0x00020000, 0x00040000, 0x00060000, 0x00080000, 0x000a0000, 0x000c0000, 0x000e0000,
+	0x00100000, 0x00120000, 0x00140000, 0x00160000, 0x00180000, 0x001a0000, 0x001c0000, 0x001e0000,
+	0x00000000, 0x00200000, 0x00400000, 0x00600000, 0x00800000, 0x00a00000, 0x00c00000, 0x00e00000,
+	0x01000000, 0x01200000, 0x01400000, 0x01600000, 0x01800000, 0x01a00000, 0x01c00000, 0x01e00000,
+	0x00000000, 0x007f8100, 0x007f0103, 0x00008003, 0x007e0105, 0x00018005, 0x00010006, 0x007e8106,
+	0x007c0109, 0x00038009, 0x0003000a, 0x007c810a, 0x0002000c, 0x007d810c, 0x007d010f, 0x0002800f,
+	0x00000000, 0x00780111, 0x00700121, 0x00080030, 0x00600141, 0x00180050, 0x00100060, 0x00680171,
+	0x00400181, 0x00380090, 0x003000a0, 0x004801b1, 0x002000c0, 0x005801d1, 0x005001e1, 0x002800f0,
+	0x00000000, 0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006, 0x00000007,
+	0x00000008, 0x00000009, 0x0000000a, 0x0000000b, 0x0000000c, 0x0000000d, 0x0000000e, 0x0000000f,
+	0x00000000, 0x00000010, 0x00000020, 0x00000030, 0x00000040, 0x00000050, 0x00000060, 0x00000070,
+	0x00000080, 0x00000090, 0x000000a0, 0x000000b0, 0x000000c0, 0x000000d0, 0x000000e0, 0x000000f0,
+	0x00000000, 0x00000100, 0x00000200, 0x00000300, 0x00000400, 0x00000500, 0x00000600, 0x00000700,
+	0x00000800, 0x00000900, 0x00000a00, 0x00000b00, 0x00000c00, 0x00000d00, 0x00000e00, 0x00000f00,
+	0x00000000, 0x00001000, 0x00002000, 0x00003000, 0x00004000, 0x00005000, 0x00006000, 0x00007000,
+	0x00008000, 0x00009000, 0x0000a000, 0x0000b000, 0x0000c000, 0x0000d000, 0x0000e000, 0x0000f000,
+	0x00000000, 0x00010000, 0x00020000, 0x00030000, 0x00040000, 0x00050000, 0x00060000, 0x00070000,
+	0x00080000, 0x00090000, 0x000a0000, 0x000b0000, 0x000c0000, 0x000d0000, 0x000e0000, 0x000f0000,
+	0x00000000, 0x00100000, 0x00200000, 0x00300000, 0x00400000, 0x00500000, 0x00600000, 0x00700000,
+	0x00800000, 0x00900000, 0x00a00000, 0x00b00000, 0x00c00000, 0x00d00000, 0x00e00000, 0x00f00000,
+	0x00000000, 0x003fc080, 0x007f8100, 0x00404180, 0x007f0103, 0x0040c183, 0x00008003, 0x003f4083,
+	0x007e0105, 0x0041c185, 0x00018005, 0x003e4085, 0x00010006, 0x003ec086, 0x007e8106, 0x00414186,
+	0x00000000, 0x007c0109, 0x00780111, 0x00040018, 0x00700121, 0x000c0028, 0x00080030, 0x00740139,
+	0x00600141, 0x001c0048, 0x00180050, 0x00640159, 0x00100060, 0x006c0169, 0x00680171, 0x00140078,
+	0x00000000, 0x00400181, 0x00000001, 0x00400180, 0x00000002, 0x00400183, 0x00000003, 0x00400182,
+	0x00000004, 0x00400185, 0x00000005, 0x00400184, 0x00000006, 0x00400187, 0x00000007, 0x00400186,
+	0x00000000, 0x00000008, 0x00000010, 0x00000018, 0x00000020, 0x00000028, 0x00000030, 0x00000038,
+	0x00000040, 0x00000048, 0x00000050, 0x00000058, 0x00000060, 0x00000068, 0x00000070, 0x00000078,
+	0x00000000, 0x00000080, 0x00000100, 0x00000180, 0x00000200, 0x00000280, 0x00000300, 0x00000380,
+	0x00000400, 0x00000480, 0x00000500, 0x00000580, 0x00000600, 0x00000680, 0x00000700, 0x00000780,
+	0x00000000, 0x00000800, 0x00001000, 0x00001800, 0x00002000, 0x00002800, 0x00003000, 0x00003800,
+	0x00004000, 0x00004800, 0x00005000, 0x00005800, 0x00006000, 0x00006800, 0x00007000, 0x00007800,
+	0x00000000, 0x00008000, 0x00010000, 0x00018000, 0x00020000, 0x00028000, 0x00030000, 0x00038000,
+	0x00040000, 0x00048000, 0x00050000, 0x00058000, 0x00060000, 0x00068000, 0x00070000, 0x00078000,
+	0x00000000, 0x00080000, 0x00100000, 0x00180000, 0x00200000, 0x00280000, 0x00300000, 0x00380000,
+	0x00400000, 0x00480000, 0x00500000, 0x00580000, 0x00600000, 0x00680000, 0x00700000, 0x00780000,
+	0x00000000, 0x001fe040, 0x003fc080, 0x002020c0, 0x007f8100, 0x00606140, 0x00404180, 0x005fa1c0,
+	0x007f0103, 0x0060e143, 0x0040c183, 0x005f21c3, 0x00008003, 0x001f6043, 0x003f4083, 0x0020a0c3,
+	0x00000000, 0x007e0105, 0x007c0109, 0x0002000c, 0x00780111, 0x00060014, 0x00040018, 0x007a011d,
+	0x00700121, 0x000e0024, 0x000c0028, 0x0072012d, 0x00080030, 0x00760135, 0x00740139, 0x000a003c,
+	0x00000000, 0x00600141, 0x00400181, 0x002000c0, 0x00000001, 0x00600140, 0x00400180, 0x002000c1,
+	0x00000002, 0x00600143, 0x00400183, 0x002000c2, 0x00000003, 0x00600142, 0x00400182, 0x002000c3,
+	0x00000000, 0x00000004, 0x00000008, 0x0000000c, 0x00000010, 0x00000014, 0x00000018, 0x0000001c,
+	0x00000020, 0x00000024, 0x00000028, 0x0000002c, 0x00000030, 0x00000034, 0x00000038, 0x0000003c,
+	0x00000000, 0x00000040, 0x00000080, 0x000000c0, 0x00000100, 0x00000140, 0x00000180, 0x000001c0,
+	0x00000200, 0x00000240, 0x00000280, 0x000002c0, 0x00000300, 0x00000340, 0x00000380, 0x000003c0,
+	0x00000000, 0x00000400, 0x00000800, 0x00000c00, 0x00001000, 0x00001400, 0x00001800, 0x00001c00,
+	0x00002000, 0x00002400, 0x00002800, 0x00002c00, 0x00003000, 0x00003400, 0x00003800, 0x00003c00,
+	0x00000000, 0x00004000, 0x00008000, 0x0000c000, 0x00010000, 0x00014000, 0x00018000, 0x0001c000,
+	0x00020000, 0x00024000, 0x00028000, 0x0002c000, 0x00030000, 0x00034000, 0x00038000, 0x0003c000,
+	0x00000000, 0x00040000, 0x00080000, 0x000c0000, 0x00100000, 0x00140000, 0x00180000, 0x001c0000,
+	0x00200000, 0x00240000, 0x00280000, 0x002c0000, 0x00300000, 0x00340000, 0x00380000, 0x003c0000,
+	0x00000000, 0x000ff020, 0x001fe040, 0x00101060, 0x003fc080, 0x003030a0, 0x002020c0, 0x002fd0e0,
+	0x007f8100, 0x00707120, 0x00606140, 0x006f9160, 0x00404180, 0x004fb1a0, 0x005fa1c0, 0x005051e0,
+	0x00000000, 0x007f0103, 0x007e0105, 0x00010006, 0x007c0109, 0x0003000a, 0x0002000c, 0x007d010f,
+	0x00780111, 0x00070012, 0x00060014, 0x00790117, 0x00040018, 0x007b011b, 0x007a011d, 0x0005001e,
+	0x00000000, 0x00700121, 0x00600141, 0x00100060, 0x00400181, 0x003000a0, 0x002000c0, 0x005001e1,
+	0x00000001, 0x00700120, 0x00600140, 0x00100061, 0x00400180, 0x003000a1, 0x002000c1, 0x005001e0,
+	0x00000000, 0x00000002, 0x00000004, 0x00000006, 0x00000008, 0x0000000a, 0x0000000c, 0x0000000e,
+	0x00000010, 0x00000012, 0x00000014, 0x00000016, 0x00000018, 0x0000001a, 0x0000001c, 0x0000001e,
+	0x00000000, 0x00000020, 0x00000040, 0x00000060, 0x00000080, 0x000000a0, 0x000000c0, 0x000000e0,
+	0x00000100, 0x00000120, 0x00000140, 0x00000160, 0x00000180, 0x000001a0, 0x000001c0, 0x000001e0,
+	0x00000000, 0x00000200, 0x00000400, 0x00000600, 0x00000800, 0x00000a00, 0x00000c00, 0x00000e00,
+	0x00001000, 0x00001200, 0x00001400, 0x00001600, 0x00001800, 0x00001a00, 0x00001c00, 0x00001e00,
+	0x00000000, 0x00002000, 0x00004000, 0x00006000, 0x00008000, 0x0000a000, 0x0000c000, 0x0000e000,
+	0x00010000, 0x00012000, 0x00014000, 0x00016000, 0x00018000, 0x0001a000, 0x0001c000, 0x0001e000,
+	0x00000000, 0x00020000, 0x00040000, 0x00060000, 0x00080000, 0x000a0000, 0x000c0000, 0x000e0000,
+	0x00100000, 0x00120000, 0x00140000, 0x00160000, 0x00180000, 0x001a0000, 0x001c0000, 0x001e0000,
+	0x00000000, 0x0007f810, 0x000ff020, 0x00080830, 0x001fe040, 0x00181850, 0x00101060, 0x0017e870,
+	0x003fc080, 0x00383890, 0x003030a0, 0x0037c8b0, 0x002020c0, 0x0027d8d0, 0x002fd0e0, 0x002828f0,
+	0x00000000, 0x007f8100, 0x007f0103, 0x00008003, 0x007e0105, 0x00018005, 0x00010006, 0x007e8106,
+	0x007c0109, 0x00038009, 0x0003000a, 0x007c810a, 0x0002000c, 0x007d810c, 0x007d010f, 0x0002800f,
+	0x00000000, 0x00780111, 0x00700121, 0x00080030, 0x00600141, 0x00180050, 0x00100060, 0x00680171,
+	0x00400181, 0x00380090, 0x003000a0, 0x004801b1, 0x002000c0, 0x005801d1, 0x005001e1, 0x002800f0,
+	0x00000000, 0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006, 0x00000007,
+	0x00000008, 0x00000009, 0x0000000a, 0x0000000b, 0x0000000c, 0x0000000d, 0x0000000e, 0x0000000f,
+	0x00000000, 0x00000010, 0x00000020, 0x00000030, 0x00000040, 0x00000050, 0x00000060, 0x00000070,
+	0x00000080, 0x00000090, 0x000000a0, 0x000000b0, 0x000000c0, 0x000000d0, 0x000000e0, 0x000000f0,
+	0x00000000, 0x00000100, 0x00000200, 0x00000300, 0x00000400, 0x00000500, 0x00000600, 0x00000700,
+	0x00000800, 0x00000900, 0x00000a00, 0x00000b00, 0x00000c00, 0x00000d00, 0x00000e00, 0x00000f00,
+	0x00000000, 0x00001000, 0x00002000, 0x00003000, 0x00004000, 0x00005000, 0x00006000, 0x00007000,
+	0x00008000, 0x00009000, 0x0000a000, 0x0000b000, 0x0000c000, 0x0000d000, 0x0000e000, 0x0000f000,
+	0x00000000, 0x00010000, 0x00020000, 0x00030000, 0x00040000, 0x00050000, 0x00060000, 0x00070000,
+	0x00080000, 0x00090000, 0x000a0000, 0x000b0000, 0x000c0000, 0x000d0000, 0x000e0000, 0x000f0000,
+	0x00000000, 0x0003fc08, 0x0007f810, 0x00040418, 0x000ff020, 0x000c0c28, 0x00080830, 0x000bf438,
+	0x001fe040, 0x001c1c48, 0x00181850, 0x001be458, 0x00101060, 0x0013ec68, 0x0017e870, 0x00141478,
+	0x00000000, 0x003fc080, 0x007f8100, 0x00404180, 0x007f0103, 0x0040c183, 0x00008003, 0x003f4083,
+	0x007e0105, 0x0041c185, 0x00018005, 0x003e4085, 0x00010006, 0x003ec086, 0x007e8106, 0x00414186,
+	0x00000000, 0x007c0109, 0x00780111, 0x00040018, 0x00700121, 0x000c0028, 0x00080030, 0x00740139,
+	0x00600141, 0x001c0048, 0x00180050, 0x00640159, 0x00100060, 0x006c0169, 0x00680171, 0x00140078,
+	0x00000000, 0x00400181, 0x00000001, 0x00400180, 0x00000002, 0x00400183, 0x00000003, 0x00400182,
+	0x00000004, 0x00400185, 0x00000005, 0x00400184, 0x00000006, 0x00400187, 0x00000007, 0x00400186,
+	0x00000000, 0x00000008, 0x00000010, 0x00000018, 0x00000020, 0x00000028, 0x00000030, 0x00000038,
+	0x00000040, 0x00000048, 0x00000050, 0x00000058, 0x00000060, 0x00000068, 0x00000070, 0x00000078,
+	0x00000000, 0x00000080, 0x00000100, 0x00000180, 0x00000200, 0x00000280, 0x00000300, 0x00000380,
+	0x00000400, 0x00000480, 0x00000500, 0x00000580, 0x00000600, 0x00000680, 0x00000700, 0x00000780,
+	0x00000000, 0x00000800, 0x00001000, 0x00001800, 0x00002000, 0x00002800, 0x00003000, 0x00003800,
+	0x00004000, 0x00004800, 0x00005000, 0x00005800, 0x00006000, 0x00006800, 0x00007000, 0x00007800,
+	0x00000000, 0x00008000, 0x00010000, 0x00018000, 0x00020000, 0x00028000, 0x00030000, 0x00038000,
+	0x00040000, 0x00048000, 0x00050000, 0x00058000, 0x00060000, 0x00068000, 0x00070000, 0x00078000,
+	0x00000000, 0x0001fe04, 0x0003fc08, 0x0002020c, 0x0007f810, 0x00060614, 0x00040418, 0x0005fa1c,
+	0x000ff020, 0x000e0e24, 0x000c0c28, 0x000df22c, 0x00080830, 0x0009f634, 0x000bf438, 0x000a0a3c,
+	0x00000000, 0x001fe040, 0x003fc080, 0x002020c0, 0x007f8100, 0x00606140, 0x00404180, 0x005fa1c0,
+	0x007f0103, 0x0060e143, 0x0040c183, 0x005f21c3, 0x00008003, 0x001f6043, 0x003f4083, 0x0020a0c3,
+	0x00000000, 0x007e0105, 0x007c0109, 0x0002000c, 0x00780111, 0x00060014, 0x00040018, 0x007a011d,
+	0x00700121, 0x000e0024, 0x000c0028, 0x0072012d, 0x00080030, 0x00760135, 0x00740139, 0x000a003c,
+	0x00000000, 0x00600141, 0x00400181, 0x002000c0, 0x00000001, 0x00600140, 0x00400180, 0x002000c1,
+	0x00000002, 0x00600143, 0x00400183, 0x002000c2, 0x00000003, 0x00600142, 0x00400182, 0x002000c3,
+	0x00000000, 0x00000004, 0x00000008, 0x0000000c, 0x00000010, 0x00000014, 0x00000018, 0x0000001c,
+	0x00000020, 0x00000024, 0x00000028, 0x0000002c, 0x00000030, 0x00000034, 0x00000038, 0x0000003c,
+	0x00000000, 0x00000040, 0x00000080, 0x000000c0, 0x00000100, 0x00000140, 0x00000180, 0x000001c0,
+	0x00000200, 0x00000240, 0x00000280, 0x000002c0, 0x00000300, 0x00000340, 0x00000380, 0x000003c0,
+	0x00000000, 0x00000400, 0x00000800, 0x00000c00, 0x00001000, 0x00001400, 0x00001800, 0x00001c00,
+	0x00002000, 0x00002400, 0x00002800, 0x00002c00, 0x00003000, 0x00003400, 0x00003800, 0x00003c00,
+	0x00000000, 0x00004000, 0x00008000, 0x0000c000, 0x00010000, 0x00014000, 0x00018000, 0x0001c000,
+	0x00020000, 0x00024000, 0x00028000, 0x0002c000, 0x00030000, 0x00034000, 0x00038000, 0x0003c000,
+	0x00000000, 0x0000ff02, 0x0001fe04, 0x00010106, 0x0003fc08, 0x0003030a, 0x0002020c, 0x0002fd0e,
+	0x0007f810, 0x00070712, 0x00060614, 0x0006f916, 0x00040418, 0x0004fb1a, 0x0005fa1c, 0x0005051e,
+	0x00000000, 0x000ff020, 0x001fe040, 0x00101060, 0x003fc080, 0x003030a0, 0x002020c0, 0x002fd0e0,
+	0x007f8100, 0x00707120, 0x00606140, 0x006f9160, 0x00404180, 0x004fb1a0, 0x005fa1c0, 0x005051e0,
+	0x00000000, 0x007f0103, 0x007e0105, 0x00010006, 0x007c0109, 0x0003000a, 0x0002000c, 0x007d010f,
+	0x00780111, 0x00070012, 0x00060014, 0x00790117, 0x00040018, 0x007b011b, 0x007a011d, 0x0005001e,
+	0x00000000, 0x00700121, 0x00600141, 0x00100060, 0x00400181, 0x003000a0, 0x002000c0, 0x005001e1,
+	0x00000001, 0x00700120, 0x00600140, 0x00100061, 0x00400180, 0x003000a1, 0x002000c1, 0x005001e0,
+	0x00000000, 0x00000002, 0x00000004, 0x00000006, 0x00000008, 0x0000000a, 0x0000000c, 0x0000000e,
+	0x00000010, 0x00000012, 0x00000014, 0x00000016, 0x00000018, 0x0000001a, 0x0000001c, 0x0000001e,
+	0x00000000, 0x00000020, 0x00000040, 0x00000060, 0x00000080, 0x000000a0, 0x000000c0, 0x000000e0,
+	0x00000100, 0x00000120, 0x00000140, 0x00000160, 0x00000180, 0x000001a0, 0x000001c0, 0x000001e0,
+	0x00000000, 0x00000200, 0x00000400, 0x00000600, 0x00000800, 0x00000a00, 0x00000c00, 0x00000e00,
+	0x00001000, 0x00001200, 0x00001400, 0x00001600, 0x00001800, 0x00001a00, 0x00001c00, 0x00001e00,
+	0x00000000, 0x00002000, 0x00004000, 0x00006000, 0x00008000, 0x0000a000, 0x0000c000, 0x0000e000,
+	0x00010000, 0x00012000, 0x00014000, 0x00016000, 0x00018000, 0x0001a000, 0x0001c000, 0x0001e000,
+	0x00000000, 0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006, 0x00000007,
+	0x00000008, 0x00000009, 0x0000000a, 0x0000000b, 0x0000000c, 0x0000000d, 0x0000000e, 0x0000000f,
+	0x00000000, 0x00000010, 0x00000020, 0x00000030, 0x00000040, 0x00000050, 0x00000060, 0x00000070,
+	0x00000080, 0x00000090, 0x000000a0, 0x000000b0, 0x000000c0, 0x000000d0, 0x000000e0, 0x000000f0,
+	0x00000000, 0x00000100, 0x00000200, 0x00000300, 0x00000400, 0x00000500, 0x00000600, 0x00000700,
+	0x00000800, 0x00000900, 0x00000a00, 0x00000b00, 0x00000c00, 0x00000d00, 0x00000e00, 0x00000f00,
+	0x00000000, 0x00001000, 0x00002000, 0x00003000, 0x00004000, 0x00005000, 0x00006000, 0x00007000,
+	0x00008000, 0x00009000, 0x0000a000, 0x0000b000, 0x0000c000, 0x0000d000, 0x0000e000, 0x0000f000,
+	0x00000000, 0x00010000, 0x00020000, 0x00030000, 0x00040000, 0x00050000, 0x00060000, 0x00070000,
+	0x00080000, 0x00090000, 0x000a0000, 0x000b0000, 0x000c0000, 0x000d0000, 0x000e0000, 0x000f0000,
+	0x00000000, 0x00100000, 0x00200000, 0x00300000, 0x00400000, 0x00500000, 0x00600000, 0x00700000,
+	0x00800000, 0x00900000, 0x00a00000, 0x00b00000, 0x00c00000, 0x00d00000, 0x00e00000, 0x00f00000,
+	0x00000000, 0x01000000, 0x02000000, 0x03000000, 0x04000000, 0x05000000, 0x06000000, 0x07000000,
+	0x08000000, 0x09000000, 0x0a000000, 0x0b000000, 0x0c000000, 0x0d000000, 0x0e000000, 0x0f000000,
+	0x00000000, 0x10000000, 0x20000000, 0x30000000, 0x40000000, 0x50000000, 0x60000000, 0x70000000,
+	0x80000000, 0x90000000, 0xa0000000, 0xb0000000, 0xc0000000, 0xd0000000, 0xe0000000, 0xf0000000,
+	0x00000000, 0x00007f81, 0x0000ff02, 0x00008083, 0x0001fe04, 0x00018185, 0x00010106, 0x00017e87,
+	0x0003fc08, 0x00038389, 0x0003030a, 0x00037c8b, 0x0002020c, 0x00027d8d, 0x0002fd0e, 0x0002828f,
+	0x00000000, 0x0007f810, 0x000ff020, 0x00080830, 0x001fe040, 0x00181850, 0x00101060, 0x0017e870,
+	0x003fc080, 0x00383890, 0x003030a0, 0x0037c8b0, 0x002020c0, 0x0027d8d0, 0x002fd0e0, 0x002828f0,
+	0x00000000, 0x007f8100, 0x007f0103, 0x00008003, 0x007e0105, 0x00018005, 0x00010006, 0x007e8106,
+	0x007c0109, 0x00038009, 0x0003000a, 0x007c810a, 0x0002000c, 0x007d810c, 0x007d010f, 0x0002800f,
+	0x00000000, 0x00780111, 0x00700121, 0x00080030, 0x00600141, 0x00180050, 0x00100060, 0x00680171,
+	0x00400181, 0x00380090, 0x003000a0, 0x004801b1, 0x002000c0, 0x005801d1, 0x005001e1, 0x002800f0,
+	0x00000000, 0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006, 0x00000007,
+	0x00000008, 0x00000009, 0x0000000a, 0x0000000b, 0x0000000c, 0x0000000d, 0x0000000e, 0x0000000f,
+	0x00000000, 0x00000010, 0x00000020, 0x00000030, 0x00000040, 0x00000050, 0x00000060, 0x00000070,
+	0x00000080, 0x00000090, 0x000000a0, 0x000000b0, 0x000000c0, 0x000000d0, 0x000000e0, 0x000000f0,
+	0x00000000, 0x00000100, 0x00000200, 0x00000300, 0x00000400, 0x00000500, 0x00000600, 0x00000700,
+	0x00000800, 0x00000900, 0x00000a00, 0x00000b00, 0x00000c00, 0x00000d00, 0x00000e00, 0x00000f00,
+	0x00000000, 0x00001000, 0x00002000, 0x00003000, 0x00004000, 0x00005000, 0x00006000, 0x00007000,
+	0x00008000, 0x00009000, 0x0000a000, 0x0000b000, 0x0000c000, 0x0000d000, 0x0000e000, 0x0000f000,
+	0x00000000, 0x00553e7f, 0x002a7ffd, 0x007f4182, 0x0054fffa, 0x0001c185, 0x007e8007, 0x002bbe78,
+	0x0029fcf7, 0x007cc288, 0x0003830a, 0x0056bd75, 0x007d030d, 0x00283d72, 0x00577cf0, 0x0002428f,
+	0x00000000, 0x0053f9ee, 0x0027f0df, 0x00740931, 0x004fe1be, 0x001c1850, 0x00681161, 0x003be88f,
+	0x001fc07f, 0x004c3991, 0x003830a0, 0x006bc94e, 0x005021c1, 0x0003d82f, 0x0077d11e, 0x002428f0,
+	0x00000000, 0x003f80fe, 0x007f01fc, 0x00408102, 0x007e00fb, 0x00418005, 0x00010107, 0x003e81f9,
+	0x007c02f5, 0x0043820b, 0x00030309, 0x003c83f7, 0x0002020e, 0x003d82f0, 0x007d03f2, 0x0042830c,
+	0x00000000, 0x007806e9, 0x00700ed1, 0x00080838, 0x00601ea1, 0x00181848, 0x00101070, 0x00681699,
+	0x00403e41, 0x003838a8, 0x00303090, 0x00483679, 0x002020e0, 0x00582609, 0x00502e31, 0x002828d8,
+	0x00000000, 0x00007f81, 0x0000ff02, 0x00008083, 0x0001fe04, 0x00018185, 0x00010106, 0x00017e87,
+	0x0003fc08, 0x00038389, 0x0003030a, 0x00037c8b, 0x0002020c, 0x00027d8d, 0x0002fd0e, 0x0002828f,
+	0x00000000, 0x0007f810, 0x000ff020, 0x00080830, 0x001fe040, 0x00181850, 0x00101060, 0x0017e870,
+	0x003fc080, 0x00383890, 0x003030a0, 0x0037c8b0, 0x002020c0, 0x0027d8d0, 0x002fd0e0, 0x002828f0,
+	0x00000000, 0x007f8100, 0x007f0103, 0x00008003, 0x007e0105, 0x00018005, 0x00010006, 0x007e8106,
+	0x007c0109, 0x00038009, 0x0003000a, 0x007c810a, 0x0002000c, 0x007d810c, 0x007d010f, 0x0002800f,
+	0x00000000, 0x00780111, 0x00700121, 0x00080030, 0x00600141, 0x00180050, 0x00100060, 0x00680171,
+	0x00400181, 0x00380090, 0x003000a0, 0x004801b1, 0x002000c0, 0x005801d1, 0x005001e1, 0x002800f0,
+	0x00000000, 0x00606b95, 0x0040d429, 0x0020bfbc, 0x0001ab51, 0x0061c0c4, 0x00417f78, 0x002114ed,
+	0x000356a2, 0x00633d37, 0x0043828b, 0x0023e91e, 0x0002fdf3, 0x00629666, 0x004229da, 0x0022424f,
+	0x00000000, 0x0006ad44, 0x000d5a88, 0x000bf7cc, 0x001ab510, 0x001c1854, 0x0017ef98, 0x001142dc,
+	0x00356a20, 0x0033c764, 0x003830a8, 0x003e9dec, 0x002fdf30, 0x00297274, 0x002285b8, 0x002428fc,
+	0x00000000, 0x006ad440, 0x0055ab83, 0x003f7fc3, 0x002b5405, 0x00418045, 0x007eff86, 0x00142bc6,
+	0x0056a80a, 0x003c7c4a, 0x00030389, 0x0069d7c9, 0x007dfc0f, 0x0017284f, 0x0028578c, 0x004283cc,
+	0x00000000, 0x002d5317, 0x005aa62e, 0x0077f539, 0x00354f5f, 0x00181c48, 0x006fe971, 0x0042ba66,
+	0x006a9ebe, 0x0047cda9, 0x00303890, 0x001d6b87, 0x005fd1e1, 0x007282f6, 0x000577cf, 0x002824d8,
+	0x00000000, 0x00553e7f, 0x002a7ffd, 0x007f4182, 0x0054fffa, 0x0001c185, 0x007e8007, 0x002bbe78,
+	0x0029fcf7, 0x007cc288, 0x0003830a, 0x0056bd75, 0x007d030d, 0x00283d72, 0x00577cf0, 0x0002428f,
+	0x00000000, 0x0053f9ee, 0x0027f0df, 0x00740931, 0x004fe1be, 0x001c1850, 0x00681161, 0x003be88f,
+	0x001fc07f, 0x004c3991, 0x003830a0, 0x006bc94e, 0x005021c1, 0x0003d82f, 0x0077d11e, 0x002428f0,
+	0x00000000, 0x003f80fe, 0x007f01fc, 0x00408102, 0x007e00fb, 0x00418005, 0x00010107, 0x003e81f9,
+	0x007c02f5, 0x0043820b, 0x00030309, 0x003c83f7, 0x0002020e, 0x003d82f0, 0x007d03f2, 0x0042830c,
+	0x00000000, 0x007806e9, 0x00700ed1, 0x00080838, 0x00601ea1, 0x00181848, 0x00101070, 0x00681699,
+	0x00403e41, 0x003838a8, 0x00303090, 0x00483679, 0x002020e0, 0x00582609, 0x00502e31, 0x002828d8,
+	0x00000000, 0x0055381f, 0x002a733d, 0x007f4b22, 0x0054e67a, 0x0001de65, 0x007e9547, 0x002bad58,
+	0x0029cff7, 0x007cf7e8, 0x0003bcca, 0x005684d5, 0x007d298d, 0x00281192, 0x00575ab0, 0x000262af,
+	0x00000000, 0x00539fee, 0x00273cdf, 0x0074a331, 0x004e79be, 0x001de650, 0x00694561, 0x003ada8f,
+	0x001cf07f, 0x004f6f91, 0x003bcca0, 0x0068534e, 0x005289c1, 0x0001162f, 0x0075b51e, 0x00262af0,
+	0x00000000, 0x0039e0fe, 0x0073c1fc, 0x004a2102, 0x006780fb, 0x005e6005, 0x00144107, 0x002da1f9,
+	0x004f02f5, 0x0076e20b, 0x003cc309, 0x000523f7, 0x0028820e, 0x001162f0, 0x005b43f2, 0x0062a30c,
+	0x00000000, 0x001e06e9, 0x003c0dd2, 0x00220b3b, 0x00781ba4, 0x00661d4d, 0x00441676, 0x005a109f,
+	0x0070344b, 0x006e32a2, 0x004c3999, 0x00523f70, 0x00082fef, 0x00162906, 0x0034223d, 0x002a24d4,
+	0x00000000, 0x00606b95, 0x0040d429, 0x0020bfbc, 0x0001ab51, 0x0061c0c4, 0x00417f78, 0x002114ed,
+	0x000356a2, 0x00633d37, 0x0043828b, 0x0023e91e, 0x0002fdf3, 0x00629666, 0x004229da, 0x0022424f,
+	0x00000000, 0x0006ad44, 0x000d5a88, 0x000bf7cc, 0x001ab510, 0x001c1854, 0x0017ef98, 0x001142dc,
+	0x00356a20, 0x0033c764, 0x003830a8, 0x003e9dec, 0x002fdf30, 0x00297274, 0x002285b8, 0x002428fc,
+	0x00000000, 0x006ad440, 0x0055ab83, 0x003f7fc3, 0x002b5405, 0x00418045, 0x007eff86, 0x00142bc6,
+	0x0056a80a, 0x003c7c4a, 0x00030389, 0x0069d7c9, 0x007dfc0f, 0x0017284f, 0x0028578c, 0x004283cc,
+	0x00000000, 0x002d5317, 0x005aa62e, 0x0077f539, 0x00354f5f, 0x00181c48, 0x006fe971, 0x0042ba66,
+	0x006a9ebe, 0x0047cda9, 0x00303890, 0x001d6b87, 0x005fd1e1, 0x007282f6, 0x000577cf, 0x002824d8,
+	0x00000000, 0x00717bf3, 0x0062f4e5, 0x00138f16, 0x0045eac9, 0x0034913a, 0x00271e2c, 0x005665df,
+	0x000bd691, 0x007aad62, 0x00692274, 0x00185987, 0x004e3c58, 0x003f47ab, 0x002cc8bd, 0x005db34e,
+	0x00000000, 0x0017ad22, 0x002f5a44, 0x0038f766, 0x005eb488, 0x004919aa, 0x0071eecc, 0x006643ee,
+	0x003d6a13, 0x002ac731, 0x00123057, 0x00059d75, 0x0063de9b, 0x007473b9, 0x004c84df, 0x005b29fd,
+	0x00000000, 0x007ad426, 0x0075ab4f, 0x000f7f69, 0x006b559d, 0x001181bb, 0x001efed2, 0x00642af4,
+	0x0056a839, 0x002c7c1f, 0x00230376, 0x0059d750, 0x003dfda4, 0x00472982, 0x004856eb, 0x003282cd,
+	0x00000000, 0x002d5371, 0x005aa6e2, 0x0077f593, 0x00354ec7, 0x00181db6, 0x006fe825, 0x0042bb54,
+	0x006a9d8e, 0x0047ceff, 0x00303b6c, 0x001d681d, 0x005fd349, 0x00728038, 0x000575ab, 0x002826da,
+	0x00000000, 0x0055381f, 0x002a733d, 0x007f4b22, 0x0054e67a, 0x0001de65, 0x007e9547, 0x002bad58,
+	0x0029cff7, 0x007cf7e8, 0x0003bcca, 0x005684d5, 0x007d298d, 0x00281192, 0x00575ab0, 0x000262af,
+	0x00000000, 0x00539fee, 0x00273cdf, 0x0074a331, 0x004e79be, 0x001de650, 0x00694561, 0x003ada8f,
+	0x001cf07f, 0x004f6f91, 0x003bcca0, 0x0068534e, 0x005289c1, 0x0001162f, 0x0075b51e, 0x00262af0,
+	0x00000000, 0x0039e0fe, 0x0073c1fc, 0x004a2102, 0x006780fb, 0x005e6005, 0x00144107, 0x002da1f9,
+	0x004f02f5, 0x0076e20b, 0x003cc309, 0x000523f7, 0x0028820e, 0x001162f0, 0x005b43f2, 0x0062a30c,
+	0x00000000, 0x001e06e9, 0x003c0dd2, 0x00220b3b, 0x00781ba4, 0x00661d4d, 0x00441676, 0x005a109f,
+	0x0070344b, 0x006e32a2, 0x004c3999, 0x00523f70, 0x00082fef, 0x00162906, 0x0034223d, 0x002a24d4,
+	0x00000000, 0x003c2879, 0x007850f2, 0x0044788b, 0x0070a2e7, 0x004c8a9e, 0x0008f215, 0x0034da6c,
+	0x006146cd, 0x005d6eb4, 0x0019163f, 0x00253e46, 0x0011e42a, 0x002dcc53, 0x0069b4d8, 0x00559ca1,
+	0x00000000, 0x00428e99, 0x00051e31, 0x004790a8, 0x000a3c62, 0x0048b2fb, 0x000f2253, 0x004dacca,
+	0x001478c4, 0x0056f65d, 0x001166f5, 0x0053e86c, 0x001e44a6, 0x005cca3f, 0x001b5a97, 0x0059d40e,
+	0x00000000, 0x0028f188, 0x0051e310, 0x00791298, 0x0023c523, 0x000b34ab, 0x00722633, 0x005ad7bb,
+	0x00478a46, 0x006f7bce, 0x00166956, 0x003e98de, 0x00644f65, 0x004cbeed, 0x0035ac75, 0x001d5dfd,
+	0x00000000, 0x000f178f, 0x001e2f1e, 0x00113891, 0x003c5e3c, 0x003349b3, 0x00227122, 0x002d66ad,
+	0x0078bc78, 0x0077abf7, 0x00669366, 0x006984e9, 0x0044e244, 0x004bf5cb, 0x005acd5a, 0x0055dad5,
+	0x00000000, 0x00717bf3, 0x0062f4e5, 0x00138f16, 0x0045eac9, 0x0034913a, 0x00271e2c, 0x005665df,
+	0x000bd691, 0x007aad62, 0x00692274, 0x00185987, 0x004e3c58, 0x003f47ab, 0x002cc8bd, 0x005db34e,
+	0x00000000, 0x0017ad22, 0x002f5a44, 0x0038f766, 0x005eb488, 0x004919aa, 0x0071eecc, 0x006643ee,
+	0x003d6a13, 0x002ac731, 0x00123057, 0x00059d75, 0x0063de9b, 0x007473b9, 0x004c84df, 0x005b29fd,
+	0x00000000, 0x007ad426, 0x0075ab4f, 0x000f7f69, 0x006b559d, 0x001181bb, 0x001efed2, 0x00642af4,
+	0x0056a839, 0x002c7c1f, 0x00230376, 0x0059d750, 0x003dfda4, 0x00472982, 0x004856eb, 0x003282cd,
+	0x00000000, 0x002d5371, 0x005aa6e2, 0x0077f593, 0x00354ec7, 0x00181db6, 0x006fe825, 0x0042bb54,
+	0x006a9d8e, 0x0047ceff, 0x00303b6c, 0x001d681d, 0x005fd349, 0x00728038, 0x000575ab, 0x002826da,
+	0x00000000, 0x00186bed, 0x0030d7da, 0x0028bc37, 0x0061afb4, 0x0079c459, 0x0051786e, 0x00491383,
+	0x00435c6b, 0x005b3786, 0x00738bb1, 0x006be05c, 0x0022f3df, 0x003a9832, 0x00122405, 0x000a4fe8,
+	0x00000000, 0x0006bbd5, 0x000d77aa, 0x000bcc7f, 0x001aef54, 0x001c5481, 0x001798fe, 0x0011232b,
+	0x0035dea8, 0x0033657d, 0x0038a902, 0x003e12d7, 0x002f31fc, 0x00298a29, 0x00224656, 0x0024fd83,
+	0x00000000, 0x006bbd50, 0x005779a3, 0x003cc4f3, 0x002ef045, 0x00454d15, 0x007989e6, 0x001234b6,
+	0x005de08a, 0x00365dda, 0x000a9929, 0x00612479, 0x007310cf, 0x0018ad9f, 0x0024696c, 0x004fd43c,
+	0x00000000, 0x003bc217, 0x0077842e, 0x004c4639, 0x006f0b5f, 0x0054c948, 0x00188f71, 0x00234d66,
+	0x005e15bd, 0x0065d7aa, 0x00299193, 0x00125384, 0x00311ee2, 0x000adcf5, 0x00469acc, 0x007d58db,
+	0x00000000, 0x003c2879, 0x007850f2, 0x0044788b, 0x0070a2e7, 0x004c8a9e, 0x0008f215, 0x0034da6c,
+	0x006146cd, 0x005d6eb4, 0x0019163f, 0x00253e46, 0x0011e42a, 0x002dcc53, 0x0069b4d8, 0x00559ca1,
+	0x00000000, 0x00428e99, 0x00051e31, 0x004790a8, 0x000a3c62, 0x0048b2fb, 0x000f2253, 0x004dacca,
+	0x001478c4, 0x0056f65d, 0x001166f5, 0x0053e86c, 0x001e44a6, 0x005cca3f, 0x001b5a97, 0x0059d40e,
+	0x00000000, 0x0028f188, 0x0051e310, 0x00791298, 0x0023c523, 0x000b34ab, 0x00722633, 0x005ad7bb,
+	0x00478a46, 0x006f7bce, 0x00166956, 0x003e98de, 0x00644f65, 0x004cbeed, 0x0035ac75, 0x001d5dfd,
+	0x00000000, 0x000f178f, 0x001e2f1e, 0x00113891, 0x003c5e3c, 0x003349b3, 0x00227122, 0x002d66ad,
+	0x0078bc78, 0x0077abf7, 0x00669366, 0x006984e9, 0x0044e244, 0x004bf5cb, 0x005acd5a, 0x0055dad5,
+	0x00000000, 0x00412c1f, 0x00025b3d, 0x00437722, 0x0004b67a, 0x00459a65, 0x0006ed47, 0x0047c158,
+	0x00096cf4, 0x004840eb, 0x000b37c9, 0x004a1bd6, 0x000dda8e, 0x004cf691, 0x000f81b3, 0x004eadac,
+	0x00000000, 0x0012d9e8, 0x0025b3d0, 0x00376a38, 0x004b67a0, 0x0059be48, 0x006ed470, 0x007c0d98,
+	0x0016cc43, 0x000415ab, 0x00337f93, 0x0021a67b, 0x005dabe3, 0x004f720b, 0x00781833, 0x006ac1db,
+	0x00000000, 0x002d9886, 0x005b310c, 0x0076a98a, 0x0036611b, 0x001bf99d, 0x006d5017, 0x0040c891,
+	0x006cc236, 0x00415ab0, 0x0037f33a, 0x001a6bbc, 0x005aa32d, 0x00773bab, 0x00019221, 0x002c0aa7,
+	0x00000000, 0x0059876f, 0x00330ddd, 0x006a8ab2, 0x00661bba, 0x003f9cd5, 0x00551667, 0x000c9108,
+	0x004c3477, 0x0015b318, 0x007f39aa, 0x0026bec5, 0x002a2fcd, 0x0073a8a2, 0x00192210, 0x0040a57f,
+	0x00000000, 0x00186bed, 0x0030d7da, 0x0028bc37, 0x0061afb4, 0x0079c459, 0x0051786e, 0x00491383,
+	0x00435c6b, 0x005b3786, 0x00738bb1, 0x006be05c, 0x0022f3df, 0x003a9832, 0x00122405, 0x000a4fe8,
+	0x00000000, 0x0006bbd5, 0x000d77aa, 0x000bcc7f, 0x001aef54, 0x001c5481, 0x001798fe, 0x0011232b,
+	0x0035dea8, 0x0033657d, 0x0038a902, 0x003e12d7, 0x002f31fc, 0x00298a29, 0x00224656, 0x0024fd83,
+	0x00000000, 0x006bbd50, 0x005779a3, 0x003cc4f3, 0x002ef045, 0x00454d15, 0x007989e6, 0x001234b6,
+	0x005de08a, 0x00365dda, 0x000a9929, 0x00612479, 0x007310cf, 0x0018ad9f, 0x0024696c, 0x004fd43c,
+	0x00000000, 0x003bc217, 0x0077842e, 0x004c4639, 0x006f0b5f, 0x0054c948, 0x00188f71, 0x00234d66,
+	0x005e15bd, 0x0065d7aa, 0x00299193, 0x00125384, 0x00311ee2, 0x000adcf5, 0x00469acc, 0x007d58db,
+	0x00000000, 0x00777bf3, 0x006ef4e5, 0x00198f16, 0x005deac9, 0x002a913a, 0x00331e2c, 0x004465df,
+	0x003bd691, 0x004cad62, 0x00552274, 0x00225987, 0x00663c58, 0x001147ab, 0x0008c8bd, 0x007fb34e,
+	0x00000000, 0x0077ad22, 0x006f5947, 0x0018f465, 0x005eb18d, 0x00291caf, 0x0031e8ca, 0x004645e8,
+	0x003d6019, 0x004acd3b, 0x0052395e, 0x0025947c, 0x0063d194, 0x00147cb6, 0x000c88d3, 0x007b25f1,
+	0x00000000, 0x007ac032, 0x00758367, 0x000f4355, 0x006b05cd, 0x0011c5ff, 0x001e86aa, 0x00644698,
+	0x00560899, 0x002cc8ab, 0x00238bfe, 0x00594bcc, 0x003d0d54, 0x0047cd66, 0x00488e33, 0x00324e01,
+	0x00000000, 0x002c1231, 0x00582462, 0x00743653, 0x00304bc7, 0x001c59f6, 0x00686fa5, 0x00447d94,
+	0x0060978e, 0x004c85bf, 0x0038b3ec, 0x0014a1dd, 0x0050dc49, 0x007cce78, 0x0008f82b, 0x0024ea1a,
+	0x00000000, 0x00412c1f, 0x00025b3d, 0x00437722, 0x0004b67a, 0x00459a65, 0x0006ed47, 0x0047c158,
+	0x00096cf4, 0x004840eb, 0x000b37c9, 0x004a1bd6, 0x000dda8e, 0x004cf691, 0x000f81b3, 0x004eadac,
+	0x00000000, 0x0012d9e8, 0x0025b3d0, 0x00376a38, 0x004b67a0, 0x0059be48, 0x006ed470, 0x007c0d98,
+	0x0016cc43, 0x000415ab, 0x00337f93, 0x0021a67b, 0x005dabe3, 0x004f720b, 0x00781833, 0x006ac1db,
+	0x00000000, 0x002d9886, 0x005b310c, 0x0076a98a, 0x0036611b, 0x001bf99d, 0x006d5017, 0x0040c891,
+	0x006cc236, 0x00415ab0, 0x0037f33a, 0x001a6bbc, 0x005aa32d, 0x00773bab, 0x00019221, 0x002c0aa7,
+	0x00000000, 0x0059876f, 0x00330ddd, 0x006a8ab2, 0x00661bba, 0x003f9cd5, 0x00551667, 0x000c9108,
+	0x004c3477, 0x0015b318, 0x007f39aa, 0x0026bec5, 0x002a2fcd, 0x0073a8a2, 0x00192210, 0x0040a57f,
+	0x00000000, 0x003c287f, 0x007850fe, 0x00447881, 0x0070a2ff, 0x004c8a80, 0x0008f201, 0x0034da7e,
+	0x006146fd, 0x005d6e82, 0x00191603, 0x00253e7c, 0x0011e402, 0x002dcc7d, 0x0069b4fc, 0x00559c83,
+	0x00000000, 0x00428ef9, 0x00051ef1, 0x00479008, 0x000a3de2, 0x0048b31b, 0x000f2313, 0x004dadea,
+	0x00147bc4, 0x0056f53d, 0x00116535, 0x0053ebcc, 0x001e4626, 0x005cc8df, 0x001b58d7, 0x0059d62e,
+	0x00000000, 0x0028f788, 0x0051ef10, 0x00791898, 0x0023dd23, 0x000b2aab, 0x00723233, 0x005ac5bb,
+	0x0047ba46, 0x006f4dce, 0x00165556, 0x003ea2de, 0x00646765, 0x004c90ed, 0x00358875, 0x001d7ffd,
+	0x00000000, 0x000f778f, 0x001eef1e, 0x00119891, 0x003dde3c, 0x0032a9b3, 0x00233122, 0x002c46ad,
+	0x007bbc78, 0x0074cbf7, 0x00655366, 0x006a24e9, 0x00466244, 0x004915cb, 0x00588d5a, 0x0057fad5,
+	0x00000000, 0x00777bf3, 0x006ef4e5, 0x00198f16, 0x005deac9, 0x002a913a, 0x00331e2c, 0x004465df,
+	0x003bd691, 0x004cad62, 0x00552274, 0x00225987, 0x00663c58, 0x001147ab, 0x0008c8bd, 0x007fb34e,
+	0x00000000, 0x0077ad22, 0x006f5947, 0x0018f465, 0x005eb18d, 0x00291caf, 0x0031e8ca, 0x004645e8,
+	0x003d6019, 0x004acd3b, 0x0052395e, 0x0025947c, 0x0063d194, 0x00147cb6, 0x000c88d3, 0x007b25f1,
+	0x00000000, 0x007ac032, 0x00758367, 0x000f4355, 0x006b05cd, 0x0011c5ff, 0x001e86aa, 0x00644698,
+	0x00560899, 0x002cc8ab, 0x00238bfe, 0x00594bcc, 0x003d0d54, 0x0047cd66, 0x00488e33, 0x00324e01,
+	0x00000000, 0x002c1231, 0x00582462, 0x00743653, 0x00304bc7, 0x001c59f6, 0x00686fa5, 0x00447d94,
+	0x0060978e, 0x004c85bf, 0x0038b3ec, 0x0014a1dd, 0x0050dc49, 0x007cce78, 0x0008f82b, 0x0024ea1a,
+	0x00000000, 0x00196aeb, 0x0032d5d6, 0x002bbf3d, 0x0065abac, 0x007cc147, 0x00577e7a, 0x004e1491,
+	0x004b545b, 0x00523eb0, 0x0079818d, 0x0060eb66, 0x002efff7, 0x0037951c, 0x001c2a21, 0x000540ca,
+	0x00000000, 0x0016abb5, 0x002d576a, 0x003bfcdf, 0x005aaed4, 0x004c0561, 0x0077f9be, 0x0061520b,
+	0x00355eab, 0x0023f51e, 0x001809c1, 0x000ea274, 0x006ff07f, 0x00795bca, 0x0042a715, 0x00540ca0,
+	0x00000000, 0x006abd56, 0x005579af, 0x003fc4f9, 0x002af05d, 0x00404d0b, 0x007f89f2, 0x001534a4,
+	0x0055e0ba, 0x003f5dec, 0x00009915, 0x006a2443, 0x007f10e7, 0x0015adb1, 0x002a6948, 0x0040d41e,
+	0x00000000, 0x002bc277, 0x005784ee, 0x007c4699, 0x002f0adf, 0x0004c8a8, 0x00788e31, 0x00534c46,
+	0x005e15be, 0x0075d7c9, 0x00099150, 0x00225327, 0x00711f61, 0x005add16, 0x00269b8f, 0x000d59f8,
+	0x00000000, 0x003c287f, 0x007850fe, 0x00447881, 0x0070a2ff, 0x004c8a80, 0x0008f201, 0x0034da7e,
+	0x006146fd, 0x005d6e82, 0x00191603, 0x00253e7c, 0x0011e402, 0x002dcc7d, 0x0069b4fc, 0x00559c83,
+	0x00000000, 0x00428ef9, 0x00051ef1, 0x00479008, 0x000a3de2, 0x0048b31b, 0x000f2313, 0x004dadea,
+	0x00147bc4, 0x0056f53d, 0x00116535, 0x0053ebcc, 0x001e4626, 0x005cc8df, 0x001b58d7, 0x0059d62e,
+	0x00000000, 0x0028f788, 0x0051ef10, 0x00791898, 0x0023dd23, 0x000b2aab, 0x00723233, 0x005ac5bb,
+	0x0047ba46, 0x006f4dce, 0x00165556, 0x003ea2de, 0x00646765, 0x004c90ed, 0x00358875, 0x001d7ffd,
+	0x00000000, 0x000f778f, 0x001eef1e, 0x00119891, 0x003dde3c, 0x0032a9b3, 0x00233122, 0x002c46ad,
+	0x007bbc78, 0x0074cbf7, 0x00655366, 0x006a24e9, 0x00466244, 0x004915cb, 0x00588d5a, 0x0057fad5,
+	0x00000000, 0x003fac18, 0x007f5830, 0x0040f428, 0x007eb363, 0x00411f7b, 0x0001eb53, 0x003e474b,
+	0x007d65c5, 0x0042c9dd, 0x00023df5, 0x003d91ed, 0x0003d6a6, 0x003c7abe, 0x007c8e96, 0x0043228e,
+	0x00000000, 0x007ac889, 0x00759211, 0x000f5a98, 0x006b2721, 0x0011efa8, 0x001eb530, 0x00647db9,
+	0x00564d41, 0x002c85c8, 0x0023df50, 0x005917d9, 0x003d6a60, 0x0047a2e9, 0x0048f871, 0x003230f8,
+	0x00000000, 0x002c9981, 0x00593302, 0x0075aa83, 0x00326507, 0x001efc86, 0x006b5605, 0x0047cf84,
+	0x0064ca0e, 0x0048538f, 0x003df90c, 0x0011608d, 0x0056af09, 0x007a3688, 0x000f9c0b, 0x0023058a,
+	0x00000000, 0x0049971f, 0x00132d3d, 0x005aba22, 0x00265a7a, 0x006fcd65, 0x00357747, 0x007ce058,
+	0x004cb4f4, 0x000523eb, 0x005f99c9, 0x00160ed6, 0x006aee8e, 0x00237991, 0x0079c3b3, 0x003054ac,
+	0x00000000, 0x00196aeb, 0x0032d5d6, 0x002bbf3d, 0x0065abac, 0x007cc147, 0x00577e7a, 0x004e1491,
+	0x004b545b, 0x00523eb0, 0x0079818d, 0x0060eb66, 0x002efff7, 0x0037951c, 0x001c2a21, 0x000540ca,
+	0x00000000, 0x0016abb5, 0x002d576a, 0x003bfcdf, 0x005aaed4, 0x004c0561, 0x0077f9be, 0x0061520b,
+	0x00355eab, 0x0023f51e, 0x001809c1, 0x000ea274, 0x006ff07f, 0x00795bca, 0x0042a715, 0x00540ca0,
+	0x00000000, 0x006abd56, 0x005579af, 0x003fc4f9, 0x002af05d, 0x00404d0b, 0x007f89f2, 0x001534a4,
+	0x0055e0ba, 0x003f5dec, 0x00009915, 0x006a2443, 0x007f10e7, 0x0015adb1, 0x002a6948, 0x0040d41e,
+	0x00000000, 0x002bc277, 0x005784ee, 0x007c4699, 0x002f0adf, 0x0004c8a8, 0x00788e31, 0x00534c46,
+	0x005e15be, 0x0075d7c9, 0x00099150, 0x00225327, 0x00711f61, 0x005add16, 0x00269b8f, 0x000d59f8,
+	0x00000000, 0x0036048b, 0x006c0916, 0x005a0d9d, 0x0058112f, 0x006e15a4, 0x00341839, 0x00021cb2,
+	0x0030215d, 0x000625d6, 0x005c284b, 0x006a2cc0, 0x00683072, 0x005e34f9, 0x00043964, 0x00323def,
+	0x00000000, 0x006042ba, 0x00408677, 0x0020c4cd, 0x00010fed, 0x00614d57, 0x0041899a, 0x0021cb20,
+	0x00021fda, 0x00625d60, 0x004299ad, 0x0022db17, 0x00031037, 0x0063528d, 0x00439640, 0x0023d4fa,
+	0x00000000, 0x00043fb4, 0x00087f68, 0x000c40dc, 0x0010fed0, 0x0014c164, 0x001881b8, 0x001cbe0c,
+	0x0021fda0, 0x0025c214, 0x002982c8, 0x002dbd7c, 0x00310370, 0x00353cc4, 0x00397c18, 0x003d43ac,
+	0x00000000, 0x0043fb40, 0x0007f583, 0x00440ec3, 0x000feb06, 0x004c1046, 0x00081e85, 0x004be5c5,
+	0x001fd60c, 0x005c2d4c, 0x0018238f, 0x005bd8cf, 0x00103d0a, 0x0053c64a, 0x0017c889, 0x005433c9,
+	0x00000000, 0x003fac18, 0x007f5830, 0x0040f428, 0x007eb363, 0x00411f7b, 0x0001eb53, 0x003e474b,
+	0x007d65c5, 0x0042c9dd, 0x00023df5, 0x003d91ed, 0x0003d6a6, 0x003c7abe, 0x007c8e96, 0x0043228e,
+	0x00000000, 0x007ac889, 0x00759211, 0x000f5a98, 0x006b2721, 0x0011efa8, 0x001eb530, 0x00647db9,
+	0x00564d41, 0x002c85c8, 0x0023df50, 0x005917d9, 0x003d6a60, 0x0047a2e9, 0x0048f871, 0x003230f8,
+	0x00000000, 0x002c9981, 0x00593302, 0x0075aa83, 0x00326507, 0x001efc86, 0x006b5605, 0x0047cf84,
+	0x0064ca0e, 0x0048538f, 0x003df90c, 0x0011608d, 0x0056af09, 0x007a3688, 0x000f9c0b, 0x0023058a,
+	0x00000000, 0x0049971f, 0x00132d3d, 0x005aba22, 0x00265a7a, 0x006fcd65, 0x00357747, 0x007ce058,
+	0x004cb4f4, 0x000523eb, 0x005f99c9, 0x00160ed6, 0x006aee8e, 0x00237991, 0x0079c3b3, 0x003054ac,
+	0x00000000, 0x0042bd38, 0x00057973, 0x0047c44b, 0x000af2e6, 0x00484fde, 0x000f8b95, 0x004d36ad,
+	0x0015e5cc, 0x005758f4, 0x00109cbf, 0x00522187, 0x001f172a, 0x005daa12, 0x001a6e59, 0x0058d361,
+	0x00000000, 0x002bcb98, 0x00579730, 0x007c5ca8, 0x002f2d63, 0x0004e6fb, 0x0078ba53, 0x005371cb,
+	0x005e5ac6, 0x0075915e, 0x0009cdf6, 0x0022066e, 0x007177a5, 0x005abc3d, 0x0026e095, 0x000d2b0d,
+	0x00000000, 0x003cb68f, 0x00796d1e, 0x0045db91, 0x0072d93f, 0x004e6fb0, 0x000bb421, 0x003702ae,
+	0x0065b17d, 0x005907f2, 0x001cdc63, 0x00206aec, 0x00176842, 0x002bdecd, 0x006e055c, 0x0052b3d3,
+	0x00000000, 0x004b61f9, 0x0016c0f1, 0x005da108, 0x002d81e2, 0x0066e01b, 0x003b4113, 0x007020ea,
+	0x005b03c4, 0x0010623d, 0x004dc335, 0x0006a2cc, 0x00768226, 0x003de3df, 0x006042d7, 0x002b232e,
+	0x00000000, 0x0036048b, 0x006c0916, 0x005a0d9d, 0x0058112f, 0x006e15a4, 0x00341839, 0x00021cb2,
+	0x0030215d, 0x000625d6, 0x005c284b, 0x006a2cc0, 0x00683072, 0x005e34f9, 0x00043964, 0x00323def,
+	0x00000000, 0x006042ba, 0x00408677, 0x0020c4cd, 0x00010fed, 0x00614d57, 0x0041899a, 0x0021cb20,
+	0x00021fda, 0x00625d60, 0x004299ad, 0x0022db17, 0x00031037, 0x0063528d, 0x00439640, 0x0023d4fa,
+	0x00000000, 0x00043fb4, 0x00087f68, 0x000c40dc, 0x0010fed0, 0x0014c164, 0x001881b8, 0x001cbe0c,
+	0x0021fda0, 0x0025c214, 0x002982c8, 0x002dbd7c, 0x00310370, 0x00353cc4, 0x00397c18, 0x003d43ac,
+	0x00000000, 0x0043fb40, 0x0007f583, 0x00440ec3, 0x000feb06, 0x004c1046, 0x00081e85, 0x004be5c5,
+	0x001fd60c, 0x005c2d4c, 0x0018238f, 0x005bd8cf, 0x00103d0a, 0x0053c64a, 0x0017c889, 0x005433c9,
+	0x00000000, 0x003e74c7, 0x007ce98e, 0x00429d49, 0x0079d01f, 0x0047a4d8, 0x00053991, 0x003b4d56,
+	0x0073a33d, 0x004dd7fa, 0x000f4ab3, 0x00313e74, 0x000a7322, 0x003407e5, 0x00769aac, 0x0048ee6b,
+	0x00000000, 0x00674579, 0x004e89f1, 0x0029cc88, 0x001d10e1, 0x007a5598, 0x00539910, 0x0034dc69,
+	0x003a21c2, 0x005d64bb, 0x0074a833, 0x0013ed4a, 0x00273123, 0x0040745a, 0x0069b8d2, 0x000efdab,
+	0x00000000, 0x00744384, 0x0068840b, 0x001cc78f, 0x00510b15, 0x00254891, 0x00398f1e, 0x004dcc9a,
+	0x00221529, 0x005656ad, 0x004a9122, 0x003ed2a6, 0x00731e3c, 0x00075db8, 0x001b9a37, 0x006fd9b3,
+	0x00000000, 0x00442a52, 0x000857a7, 0x004c7df5, 0x0010af4e, 0x0054851c, 0x0018f8e9, 0x005cd2bb,
+	0x00215e9c, 0x006574ce, 0x0029093b, 0x006d2369, 0x0031f1d2, 0x0075db80, 0x0039a675, 0x007d8c27,
+	0x00000000, 0x0042bd38, 0x00057973, 0x0047c44b, 0x000af2e6, 0x00484fde, 0x000f8b95, 0x004d36ad,
+	0x0015e5cc, 0x005758f4, 0x00109cbf, 0x00522187, 0x001f172a, 0x005daa12, 0x001a6e59, 0x0058d361,
+	0x00000000, 0x002bcb98, 0x00579730, 0x007c5ca8, 0x002f2d63, 0x0004e6fb, 0x0078ba53, 0x005371cb,
+	0x005e5ac6, 0x0075915e, 0x0009cdf6, 0x0022066e, 0x007177a5, 0x005abc3d, 0x0026e095, 0x000d2b0d,
+	0x00000000, 0x003cb68f, 0x00796d1e, 0x0045db91, 0x0072d93f, 0x004e6fb0, 0x000bb421, 0x003702ae,
+	0x0065b17d, 0x005907f2, 0x001cdc63, 0x00206aec, 0x00176842, 0x002bdecd, 0x006e055c, 0x0052b3d3,
+	0x00000000, 0x004b61f9, 0x0016c0f1, 0x005da108, 0x002d81e2, 0x0066e01b, 0x003b4113, 0x007020ea,
+	0x005b03c4, 0x0010623d, 0x004dc335, 0x0006a2cc, 0x00768226, 0x003de3df, 0x006042d7, 0x002b232e,
+	0x00000000, 0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006, 0x00000007,
+	0x00000008, 0x00000009, 0x0000000a, 0x0000000b, 0x0000000c, 0x0000000d, 0x0000000e, 0x0000000f,
+	0x00000000, 0x00000010, 0x00000020, 0x00000030, 0x00000040, 0x00000050, 0x00000060, 0x00000070,
+	0x00000080, 0x00000090, 0x000000a0, 0x000000b0, 0x000000c0, 0x000000d0, 0x000000e0, 0x000000f0,
+	0x00000000, 0x00000100, 0x00000200, 0x00000300, 0x00000400, 0x00000500, 0x00000600, 0x00000700,
+	0x00000800, 0x00000900, 0x00000a00, 0x00000b00, 0x00000c00, 0x00000d00, 0x00000e00, 0x00000f00,
+	0x00000000, 0x00001000, 0x00002000, 0x00003000, 0x00004000, 0x00005000, 0x00006000, 0x00007000,
+	0x00008000, 0x00009000, 0x0000a000, 0x0000b000, 0x0000c000, 0x0000d000, 0x0000e000, 0x0000f000,
+	0x00000000, 0x00010000, 0x00020000, 0x00030000, 0x00040000, 0x00050000, 0x00060000, 0x00070000,
+	0x00080000, 0x00090000, 0x000a0000, 0x000b0000, 0x000c0000, 0x000d0000, 0x000e0000, 0x000f0000,
+	0x00000000, 0x00100000, 0x00200000, 0x00300000, 0x00400000, 0x00500000, 0x00600000, 0x00700000,
+	0x00800000, 0x00900000, 0x00a00000, 0x00b00000, 0x00c00000, 0x00d00000, 0x00e00000, 0x00f00000,
+	0x00000000, 0x01000000, 0x02000000, 0x03000000, 0x04000000, 0x05000000, 0x06000000, 0x07000000,
+	0x08000000, 0x09000000, 0x0a000000, 0x0b000000, 0x0c000000, 0x0d000000, 0x0e000000, 0x0f000000,
+	0x00000000, 0x10000000, 0x20000000, 0x30000000, 0x40000000, 0x50000000, 0x60000000, 0x70000000,
+	0x80000000, 0x90000000, 0xa0000000, 0xb0000000, 0xc0000000, 0xd0000000, 0xe0000000, 0xf0000000,
+	0x00000000, 0x00375e0d, 0x006ebc1a, 0x0059e217, 0x005d7b37, 0x006a253a, 0x0033c72d, 0x00049920,
+	0x003af56d, 0x000dab60, 0x00544977, 0x0063177a, 0x00678e5a, 0x0050d057, 0x00093240, 0x003e6c4d,
+	0x00000000, 0x0075eada, 0x006bd6b7, 0x001e3c6d, 0x0057ae6d, 0x002244b7, 0x003c78da, 0x00499200,
+	0x002f5fd9, 0x005ab503, 0x0044896e, 0x003163b4, 0x0078f1b4, 0x000d1b6e, 0x00132703, 0x0066cdd9,
+	0x00000000, 0x005ebfb2, 0x003d7c67, 0x0063c3d5, 0x007af8ce, 0x0024477c, 0x004784a9, 0x00193b1b,
+	0x0075f29f, 0x002b4d2d, 0x00488ef8, 0x0016314a, 0x000f0a51, 0x0051b5e3, 0x00327636, 0x006cc984,
+	0x00000000, 0x006be63d, 0x0057cf79, 0x003c2944, 0x002f9df1, 0x00447bcc, 0x00785288, 0x0013b4b5,
+	0x005f3be2, 0x0034dddf, 0x0008f49b, 0x006312a6, 0x0070a613, 0x001b402e, 0x0027696a, 0x004c8f57,
+	0x00000000, 0x003e74c7, 0x007ce98e, 0x00429d49, 0x0079d01f, 0x0047a4d8, 0x00053991, 0x003b4d56,
+	0x0073a33d, 0x004dd7fa, 0x000f4ab3, 0x00313e74, 0x000a7322, 0x003407e5, 0x00769aac, 0x0048ee6b,
+	0x00000000, 0x00674579, 0x004e89f1, 0x0029cc88, 0x001d10e1, 0x007a5598, 0x00539910, 0x0034dc69,
+	0x003a21c2, 0x005d64bb, 0x0074a833, 0x0013ed4a, 0x00273123, 0x0040745a, 0x0069b8d2, 0x000efdab,
+	0x00000000, 0x00744384, 0x0068840b, 0x001cc78f, 0x00510b15, 0x00254891, 0x00398f1e, 0x004dcc9a,
+	0x00221529, 0x005656ad, 0x004a9122, 0x003ed2a6, 0x00731e3c, 0x00075db8, 0x001b9a37, 0x006fd9b3,
+	0x00000000, 0x00442a52, 0x000857a7, 0x004c7df5, 0x0010af4e, 0x0054851c, 0x0018f8e9, 0x005cd2bb,
+	0x00215e9c, 0x006574ce, 0x0029093b, 0x006d2369, 0x0031f1d2, 0x0075db80, 0x0039a675, 0x007d8c27,
+	0x00000000, 0x00345c73, 0x0068b8e6, 0x005ce495, 0x005172cf, 0x00652ebc, 0x0039ca29, 0x000d965a,
+	0x0022e69d, 0x0016baee, 0x004a5e7b, 0x007e0208, 0x00739452, 0x0047c821, 0x001b2cb4, 0x002f70c7,
+	0x00000000, 0x0045cd3a, 0x000b9977, 0x004e544d, 0x001732ee, 0x0052ffd4, 0x001cab99, 0x005966a3,
+	0x002e65dc, 0x006ba8e6, 0x0025fcab, 0x00603191, 0x00395732, 0x007c9a08, 0x0032ce45, 0x0077037f,
+	0x00000000, 0x005ccbb8, 0x00399473, 0x00655fcb, 0x007328e6, 0x002fe35e, 0x004abc95, 0x0016772d,
+	0x006652cf, 0x003a9977, 0x005fc6bc, 0x00030d04, 0x00157a29, 0x0049b191, 0x002cee5a, 0x007025e2,
+	0x00000000, 0x004ca69d, 0x00194e39, 0x0055e8a4, 0x00329c72, 0x007e3aef, 0x002bd24b, 0x006774d6,
+	0x006538e4, 0x00299e79, 0x007c76dd, 0x0030d040, 0x0057a496, 0x001b020b, 0x004eeaaf, 0x00024c32,
+	0x00000000, 0x004a72cb, 0x0014e695, 0x005e945e, 0x0029cd2a, 0x0063bfe1, 0x003d2bbf, 0x00775974,
+	0x00539a54, 0x0019e89f, 0x00477cc1, 0x000d0e0a, 0x007a577e, 0x003025b5, 0x006eb1eb, 0x0024c320,
+	0x00000000, 0x002737ab, 0x004e6f56, 0x006958fd, 0x001cddaf, 0x003bea04, 0x0052b2f9, 0x00758552,
+	0x0039bb5e, 0x001e8cf5, 0x0077d408, 0x0050e3a3, 0x002566f1, 0x0002515a, 0x006b09a7, 0x004c3e0c,
+	0x00000000, 0x007376bc, 0x0066ee7b, 0x001598c7, 0x004ddff5, 0x003ea949, 0x002b318e, 0x00584732,
+	0x001bbce9, 0x0068ca55, 0x007d5292, 0x000e242e, 0x0056631c, 0x002515a0, 0x00308d67, 0x0043fbdb,
+	0x00000000, 0x003779d2, 0x006ef3a4, 0x00598a76, 0x005de44b, 0x006a9d99, 0x003317ef, 0x00046e3d,
+	0x003bcb95, 0x000cb247, 0x00553831, 0x006241e3, 0x00662fde, 0x0051560c, 0x0008dc7a, 0x003fa5a8,
+	0x00000000, 0x000b1d1d, 0x00163a3a, 0x001d2727, 0x002c7474, 0x00276969, 0x003a4e4e, 0x00315353,
+	0x0058e8e8, 0x0053f5f5, 0x004ed2d2, 0x0045cfcf, 0x00749c9c, 0x007f8181, 0x0062a6a6, 0x0069bbbb,
+	0x00000000, 0x0031d2d3, 0x0063a5a6, 0x00527775, 0x0047484f, 0x00769a9c, 0x0024ede9, 0x00153f3a,
+	0x000e939d, 0x003f414e, 0x006d363b, 0x005ce4e8, 0x0049dbd2, 0x00780901, 0x002a7e74, 0x001baca7,
+	0x00000000, 0x001d273a, 0x003a4e74, 0x0027694e, 0x00749ce8, 0x0069bbd2, 0x004ed29c, 0x0053f5a6,
+	0x00693ad3, 0x00741de9, 0x005374a7, 0x004e539d, 0x001da63b, 0x00008101, 0x0027e84f, 0x003acf75,
+	0x00000000, 0x005276a5, 0x0024ee49, 0x007698ec, 0x0049dc92, 0x001baa37, 0x006d32db, 0x003f447e,
+	0x0013ba27, 0x0041cc82, 0x0037546e, 0x006522cb, 0x005a66b5, 0x00081010, 0x007e88fc, 0x002cfe59,
+	0x00000000, 0x0027744e, 0x004ee89c, 0x00699cd2, 0x001dd23b, 0x003aa675, 0x00533aa7, 0x00744ee9,
+	0x003ba476, 0x001cd038, 0x00754cea, 0x005238a4, 0x0026764d, 0x00010203, 0x00689ed1, 0x004fea9f,
+	0x00000000, 0x007748ec, 0x006e92db, 0x0019da37, 0x005d26b5, 0x002a6e59, 0x0033b46e, 0x0044fc82,
+	0x003a4e69, 0x004d0685, 0x0054dcb2, 0x0023945e, 0x006768dc, 0x00102030, 0x0009fa07, 0x007eb2eb,
+	0x00000000, 0x00749cd2, 0x00693aa7, 0x001da675, 0x0052764d, 0x0026ea9f, 0x003b4cea, 0x004fd038,
+	0x0024ef99, 0x0050734b, 0x004dd53e, 0x003949ec, 0x007699d4, 0x00020506, 0x001fa373, 0x006b3fa1,
+	0x00000000, 0x0049df32, 0x0013bd67, 0x005a6255, 0x00277ace, 0x006ea5fc, 0x0034c7a9, 0x007d189b,
+	0x004ef59c, 0x00072aae, 0x005d48fb, 0x001497c9, 0x00698f52, 0x00205060, 0x007a3235, 0x0033ed07,
+	0x00000000, 0x002e5727, 0x005cae4e, 0x0072f969, 0x00395f9f, 0x001708b8, 0x0065f1d1, 0x004ba6f6,
+	0x0072bf3e, 0x005ce819, 0x002e1170, 0x00004657, 0x004be0a1, 0x0065b786, 0x00174eef, 0x003919c8,
+	0x00000000, 0x00657d7f, 0x004af9fd, 0x002f8482, 0x0015f0f9, 0x00708d86, 0x005f0904, 0x003a747b,
+	0x002be1f2, 0x004e9c8d, 0x0061180f, 0x00046570, 0x003e110b, 0x005b6c74, 0x0074e8f6, 0x00119589,
+	0x00000000, 0x0057c3e4, 0x002f84cb, 0x0078472f, 0x005f0996, 0x0008ca72, 0x00708d5d, 0x00274eb9,
+	0x003e102f, 0x0069d3cb, 0x001194e4, 0x00465700, 0x006119b9, 0x0036da5d, 0x004e9d72, 0x00195e96,
+	0x00000000, 0x007c205e, 0x007843bf, 0x000463e1, 0x0070847d, 0x000ca423, 0x0008c7c2, 0x0074e79c,
+	0x00610bf9, 0x001d2ba7, 0x00194846, 0x00656818, 0x00118f84, 0x006dafda, 0x0069cc3b, 0x0015ec65,
+	0x00000000, 0x004214f1, 0x00042ae1, 0x00463e10, 0x000855c2, 0x004a4133, 0x000c7f23, 0x004e6bd2,
+	0x0010ab84, 0x0052bf75, 0x00148165, 0x00569594, 0x0018fe46, 0x005aeab7, 0x001cd4a7, 0x005ec056,
+	0x00000000, 0x00215708, 0x0042ae10, 0x0063f918, 0x00055f23, 0x0024082b, 0x0047f133, 0x0066a63b,
+	0x000abe46, 0x002be94e, 0x00481056, 0x0069475e, 0x000fe165, 0x002eb66d, 0x004d4f75, 0x006c187d,
+	0x00000000, 0x00157c8c, 0x002af918, 0x003f8594, 0x0055f230, 0x00408ebc, 0x007f0b28, 0x006a77a4,
+	0x002be763, 0x003e9bef, 0x00011e7b, 0x001462f7, 0x007e1553, 0x006b69df, 0x0054ec4b, 0x004190c7,
+	0x00000000, 0x0057cec6, 0x002f9e8f, 0x00785049, 0x005f3d1e, 0x0008f3d8, 0x0070a391, 0x00276d57,
+	0x003e793f, 0x0069b7f9, 0x0011e7b0, 0x00462976, 0x00614421, 0x00368ae7, 0x004edaae, 0x00191468,
+	0x00000000, 0x000a1c1d, 0x0014383a, 0x001e2427, 0x00287074, 0x00226c69, 0x003c484e, 0x00365453,
+	0x0050e0e8, 0x005afcf5, 0x0044d8d2, 0x004ec4cf, 0x0078909c, 0x00728c81, 0x006ca8a6, 0x0066b4bb,
+	0x00000000, 0x0021c2d3, 0x004385a6, 0x00624775, 0x0007084f, 0x0026ca9c, 0x00448de9, 0x00654f3a,
+	0x000e109e, 0x002fd24d, 0x004d9538, 0x006c57eb, 0x000918d1, 0x0028da02, 0x004a9d77, 0x006b5fa4,
+	0x00000000, 0x001c213c, 0x00384278, 0x00246344, 0x007084f0, 0x006ca5cc, 0x0048c688, 0x0054e7b4,
+	0x00610ae3, 0x007d2bdf, 0x0059489b, 0x004569a7, 0x00118e13, 0x000daf2f, 0x0029cc6b, 0x0035ed57,
+	0x00000000, 0x004216c5, 0x00042e89, 0x0046384c, 0x00085d12, 0x004a4bd7, 0x000c739b, 0x004e655e,
+	0x0010ba24, 0x0052ace1, 0x001494ad, 0x00568268, 0x0018e736, 0x005af1f3, 0x001cc9bf, 0x005edf7a,
+	0x00000000, 0x00217448, 0x0042e890, 0x00639cd8, 0x0005d223, 0x0024a66b, 0x00473ab3, 0x00664efb,
+	0x000ba446, 0x002ad00e, 0x00494cd6, 0x0068389e, 0x000e7665, 0x002f022d, 0x004c9ef5, 0x006deabd,
+	0x00000000, 0x0017488c, 0x002e9118, 0x0039d994, 0x005d2230, 0x004a6abc, 0x0073b328, 0x0064fba4,
+	0x003a4763, 0x002d0fef, 0x0014d67b, 0x00039ef7, 0x00676553, 0x00702ddf, 0x0049f44b, 0x005ebcc7,
+	0x00000000, 0x00748ec6, 0x00691e8f, 0x001d9049, 0x00523e1d, 0x0026b0db, 0x003b2092, 0x004fae54,
+	0x00247f39, 0x0050f1ff, 0x004d61b6, 0x0039ef70, 0x00764124, 0x0002cfe2, 0x001f5fab, 0x006bd16d,
+	0x00000000, 0x0048fe72, 0x0011ffe7, 0x00590195, 0x0023ffce, 0x006b01bc, 0x00320029, 0x007afe5b,
+	0x0047ff9c, 0x000f01ee, 0x0056007b, 0x001efe09, 0x00640052, 0x002cfe20, 0x0075ffb5, 0x003d01c7,
+	0x00000000, 0x004e9c52, 0x001d3ba7, 0x0053a7f5, 0x003a774e, 0x0074eb1c, 0x00274ce9, 0x0069d0bb,
+	0x0074ee9c, 0x003a72ce, 0x0069d53b, 0x00274969, 0x004e99d2, 0x00000580, 0x0053a275, 0x001d3e27,
+	0x00000000, 0x0069de3b, 0x0053bf75, 0x003a614e, 0x00277de9, 0x004ea3d2, 0x0074c29c, 0x001d1ca7,
+	0x004efbd2, 0x002725e9, 0x001d44a7, 0x00749a9c, 0x0069863b, 0x00005800, 0x003a394e, 0x0053e775,
+	0x00000000, 0x001df4a7, 0x003be94e, 0x00261de9, 0x0077d29c, 0x006a263b, 0x004c3bd2, 0x0051cf75,
+	0x006fa63b, 0x0072529c, 0x00544f75, 0x0049bbd2, 0x001874a7, 0x00058000, 0x00239de9, 0x003e694e,
+	0x00000000, 0x005f4f75, 0x003e9de9, 0x0061d29c, 0x007d3bd2, 0x002274a7, 0x0043a63b, 0x001ce94e,
+	0x007a74a7, 0x00253bd2, 0x0044e94e, 0x001ba63b, 0x00074f75, 0x00580000, 0x0039d29c, 0x00669de9,
+	0x00000000, 0x0074ea4d, 0x0069d799, 0x001d3dd4, 0x0053ac31, 0x0027467c, 0x003a7ba8, 0x004e91e5,
+	0x00275b61, 0x0053b12c, 0x004e8cf8, 0x003a66b5, 0x0074f750, 0x00001d1d, 0x001d20c9, 0x0069ca84,
+	0x00000000, 0x004eb6c2, 0x001d6e87, 0x0053d845, 0x003add0e, 0x00746bcc, 0x0027b389, 0x0069054b,
+	0x0075ba1c, 0x003b0cde, 0x0068d49b, 0x00266259, 0x004f6712, 0x0001d1d0, 0x00520995, 0x001cbf57,
+	0x00000000, 0x006b773b, 0x0056ed75, 0x003d9a4e, 0x002dd9e9, 0x0046aed2, 0x007b349c, 0x001043a7,
+	0x005bb3d2, 0x0030c4e9, 0x000d5ea7, 0x0066299c, 0x00766a3b, 0x001d1d00, 0x0020874e, 0x004bf075,
+	0x00000000, 0x003764a7, 0x006ec94e, 0x0059ade9, 0x005d919f, 0x006af538, 0x003358d1, 0x00043c76,
+	0x003b203d, 0x000c449a, 0x0055e973, 0x00628dd4, 0x0066b1a2, 0x0051d505, 0x000878ec, 0x003f1c4b,
+	0x00000000, 0x001ca56e, 0x00394adc, 0x0025efb2, 0x007295b8, 0x006e30d6, 0x004bdf64, 0x00577a0a,
+	0x00652873, 0x00798d1d, 0x005c62af, 0x0040c7c1, 0x0017bdcb, 0x000b18a5, 0x002ef717, 0x00325279,
+	0x00000000, 0x004a53e5, 0x0014a4c9, 0x005ef72c, 0x00294992, 0x00631a77, 0x003ded5b, 0x0077bebe,
+	0x00529324, 0x0018c0c1, 0x004637ed, 0x000c6408, 0x007bdab6, 0x00318953, 0x006f7e7f, 0x00252d9a,
+	0x00000000, 0x0025254b, 0x004a4a96, 0x006f6fdd, 0x0014962f, 0x0031b364, 0x005edcb9, 0x007bf9f2,
+	0x00292c5e, 0x000c0915, 0x006366c8, 0x00464383, 0x003dba71, 0x00189f3a, 0x0077f0e7, 0x0052d5ac,
+	0x00000000, 0x005258bc, 0x0024b27b, 0x0076eac7, 0x004964f6, 0x001b3c4a, 0x006dd68d, 0x003f8e31,
+	0x0012caef, 0x00409253, 0x00367894, 0x00642028, 0x005bae19, 0x0009f6a5, 0x007f1c62, 0x002d44de,
+	0x00000000, 0x002595de, 0x004b2bbc, 0x006ebe62, 0x0016547b, 0x0033c1a5, 0x005d7fc7, 0x0078ea19,
+	0x002ca8f6, 0x00093d28, 0x0067834a, 0x00421694, 0x003afc8d, 0x001f6953, 0x0071d731, 0x005442ef,
+	0x00000000, 0x005951ec, 0x0032a0db, 0x006bf137, 0x006541b6, 0x003c105a, 0x0057e16d, 0x000eb081,
+	0x004a806f, 0x0013d183, 0x007820b4, 0x00217158, 0x002fc1d9, 0x00769035, 0x001d6102, 0x004430ee,
+	0x00000000, 0x001503dd, 0x002a07ba, 0x003f0467, 0x00540f74, 0x00410ca9, 0x007e08ce, 0x006b0b13,
+	0x00281deb, 0x003d1e36, 0x00021a51, 0x0017198c, 0x007c129f, 0x00691142, 0x00561525, 0x004316f8,
+	0x00000000, 0x00503bd6, 0x002074af, 0x00704f79, 0x0040e95e, 0x0010d288, 0x00609df1, 0x0030a627,
+	0x0001d1bf, 0x0051ea69, 0x0021a510, 0x00719ec6, 0x004138e1, 0x00110337, 0x00614c4e, 0x00317798,
+	0x00000000, 0x0074cf26, 0x00699d4f, 0x001d5269, 0x0053399d, 0x0027f6bb, 0x003aa4d2, 0x004e6bf4,
+	0x00267039, 0x0052bf1f, 0x004fed76, 0x003b2250, 0x007549a4, 0x00018682, 0x001cd4eb, 0x00681bcd,
+	0x00000000, 0x004ce072, 0x0019c3e7, 0x00552395, 0x003387ce, 0x007f67bc, 0x002a4429, 0x0066a45b,
+	0x00670f9c, 0x002befee, 0x007ecc7b, 0x00322c09, 0x00548852, 0x00186820, 0x004d4bb5, 0x0001abc7,
+	0x00000000, 0x004e1c3b, 0x001c3b75, 0x0052274e, 0x003876ea, 0x00766ad1, 0x00244d9f, 0x006a51a4,
+	0x0070edd4, 0x003ef1ef, 0x006cd6a1, 0x0022ca9a, 0x00489b3e, 0x00068705, 0x0054a04b, 0x001abc70,
+	0x00000000, 0x0061d8ab, 0x0043b255, 0x00226afe, 0x000767a9, 0x0066bf02, 0x0044d5fc, 0x00250d57,
+	0x000ecf52, 0x006f17f9, 0x004d7d07, 0x002ca5ac, 0x0009a8fb, 0x00687050, 0x004a1aae, 0x002bc205,
+	0x00000000, 0x001d9ea4, 0x003b3d48, 0x0026a3ec, 0x00767a90, 0x006be434, 0x004d47d8, 0x0050d97c,
+	0x006cf623, 0x00716887, 0x0057cb6b, 0x004a55cf, 0x001a8cb3, 0x00071217, 0x0021b1fb, 0x003c2f5f,
+	0x00000000, 0x0059ef45, 0x0033dd89, 0x006a32cc, 0x0067bb12, 0x003e5457, 0x0054669b, 0x000d89de,
+	0x004f7527, 0x00169a62, 0x007ca8ae, 0x002547eb, 0x0028ce35, 0x00712170, 0x001b13bc, 0x0042fcf9,
+	0x00000000, 0x001ee94d, 0x003dd29a, 0x00233bd7, 0x007ba534, 0x00654c79, 0x004677ae, 0x00589ee3,
+	0x0077496b, 0x0069a026, 0x004a9bf1, 0x005472bc, 0x000cec5f, 0x00120512, 0x00313ec5, 0x002fd788,
+	0x00000000, 0x006e91d5, 0x005d20a9, 0x0033b17c, 0x003a4251, 0x0054d384, 0x006762f8, 0x0009f32d,
+	0x007484a2, 0x001a1577, 0x0029a40b, 0x004735de, 0x004ec6f3, 0x00205726, 0x0013e65a, 0x007d778f,
+	0x00000000, 0x0009727b, 0x0012e4f6, 0x001b968d, 0x0025c9ec, 0x002cbb97, 0x00372d1a, 0x003e5f61,
+	0x004b93d8, 0x0042e1a3, 0x0059772e, 0x00500555, 0x006e5a34, 0x0067284f, 0x007cbec2, 0x0075ccb9,
+	0x00000000, 0x001724b3, 0x002e4966, 0x00396dd5, 0x005c92cc, 0x004bb67f, 0x0072dbaa, 0x0065ff19,
+	0x0039269b, 0x002e0228, 0x00176ffd, 0x00004b4e, 0x0065b457, 0x007290e4, 0x004bfd31, 0x005cd982,
+	0x00000000, 0x00724d36, 0x0064996f, 0x0016d459, 0x004931dd, 0x003b7ceb, 0x002da8b2, 0x005fe584,
+	0x001260b9, 0x00602d8f, 0x0076f9d6, 0x0004b4e0, 0x005b5164, 0x00291c52, 0x003fc80b, 0x004d853d,
+	0x00000000, 0x0024c172, 0x004982e4, 0x006d4396, 0x001306cb, 0x0037c7b9, 0x005a842f, 0x007e455d,
+	0x00260d96, 0x0002cce4, 0x006f8f72, 0x004b4e00, 0x00350b5d, 0x0011ca2f, 0x007c89b9, 0x005848cb,
+	0x00000000, 0x004c1b2c, 0x0018355b, 0x00542e77, 0x00306ab6, 0x007c719a, 0x00285fed, 0x006444c1,
+	0x0060d56c, 0x002cce40, 0x0078e037, 0x0034fb1b, 0x0050bfda, 0x001ca4f6, 0x00488a81, 0x000491ad,
+	0x00000000, 0x0041a9db, 0x000350b5, 0x0042f96e, 0x0006a16a, 0x004708b1, 0x0005f1df, 0x00445804,
+	0x000d42d4, 0x004ceb0f, 0x000e1261, 0x004fbbba, 0x000be3be, 0x004a4a65, 0x0008b30b, 0x00491ad0,
+	0x00000000, 0x001a85a8, 0x00350b50, 0x002f8ef8, 0x006a16a0, 0x00709308, 0x005f1df0, 0x00459858,
+	0x00542e43, 0x004eabeb, 0x00612513, 0x007ba0bb, 0x003e38e3, 0x0024bd4b, 0x000b33b3, 0x0011b61b,
+	0x00000000, 0x00285f85, 0x0050bf0a, 0x0078e08f, 0x00217d17, 0x00092292, 0x0071c21d, 0x00599d98,
+	0x0042fa2e, 0x006aa5ab, 0x00124524, 0x003a1aa1, 0x00638739, 0x004bd8bc, 0x00333833, 0x001b67b6,
+	0x00000000, 0x00499a52, 0x001337a7, 0x005aadf5, 0x00266f4e, 0x006ff51c, 0x003558e9, 0x007cc2bb,
+	0x004cde9c, 0x000544ce, 0x005fe93b, 0x00167369, 0x006ab1d2, 0x00232b80, 0x00798675, 0x00301c27,
+	0x00000000, 0x0019be3b, 0x00337c76, 0x002ac24d, 0x0066f8ec, 0x007f46d7, 0x0055849a, 0x004c3aa1,
+	0x004df2db, 0x00544ce0, 0x007e8ead, 0x00673096, 0x002b0a37, 0x0032b40c, 0x00187641, 0x0001c87a,
+	0x00000000, 0x001be6b5, 0x0037cd6a, 0x002c2bdf, 0x006f9ad4, 0x00747c61, 0x005857be, 0x0043b10b,
+	0x005f36ab, 0x0044d01e, 0x0068fbc1, 0x00731d74, 0x0030ac7f, 0x002b4aca, 0x00076115, 0x001c87a0,
+	0x00000000, 0x003e6e55, 0x007cdcaa, 0x0042b2ff, 0x0079ba57, 0x0047d402, 0x000566fd, 0x003b08a8,
+	0x007377ad, 0x004d19f8, 0x000fab07, 0x0031c552, 0x000acdfa, 0x0034a3af, 0x00761150, 0x00487f05,
+	0x00000000, 0x0066ec59, 0x004ddbb1, 0x002b37e8, 0x001bb461, 0x007d5838, 0x00566fd0, 0x00308389,
+	0x003768c2, 0x0051849b, 0x007ab373, 0x001c5f2a, 0x002cdca3, 0x004a30fa, 0x00610712, 0x0007eb4b,
+	0x00000000, 0x006ed184, 0x005da00b, 0x0033718f, 0x003b4315, 0x00559291, 0x0066e31e, 0x0008329a,
+	0x0076862a, 0x001857ae, 0x002b2621, 0x0045f7a5, 0x004dc53f, 0x002314bb, 0x00106534, 0x007eb4b0,
+	0x00000000, 0x006d0f57, 0x005a1dad, 0x003712fa, 0x00343859, 0x0059370e, 0x006e25f4, 0x00032aa3,
+	0x006870b2, 0x00057fe5, 0x00326d1f, 0x005f6248, 0x005c48eb, 0x003147bc, 0x00065546, 0x006b5a11,
+	0x00000000, 0x0050e267, 0x0021c7cd, 0x007125aa, 0x00438f9a, 0x00136dfd, 0x00624857, 0x0032aa30,
+	0x00071c37, 0x0057fe50, 0x0026dbfa, 0x0076399d, 0x004493ad, 0x001471ca, 0x00655460, 0x0035b607,
+	0x00000000, 0x00606c91, 0x0040da21, 0x0020b6b0, 0x0001b741, 0x0061dbd0, 0x00416d60, 0x002101f1,
+	0x00036e82, 0x00630213, 0x0043b4a3, 0x0023d832, 0x0002d9c3, 0x0062b552, 0x004203e2, 0x00226f73,
+	0x00000000, 0x0006dd04, 0x000dba08, 0x000b670c, 0x001b7410, 0x001da914, 0x0016ce18, 0x0010131c,
+	0x0036e820, 0x00303524, 0x003b5228, 0x003d8f2c, 0x002d9c30, 0x002b4134, 0x00202638, 0x0026fb3c,
+	0x00000000, 0x006dd040, 0x005ba383, 0x003673c3, 0x00374405, 0x005a9445, 0x006ce786, 0x000137c6,
+	0x006e880a, 0x0003584a, 0x00352b89, 0x0058fbc9, 0x0059cc0f, 0x00341c4f, 0x00026f8c, 0x006fbfcc,
+	0x00000000, 0x005d1317, 0x003a252d, 0x0067363a, 0x00744a5a, 0x0029594d, 0x004e6f77, 0x00137c60,
+	0x006897b7, 0x003584a0, 0x0052b29a, 0x000fa18d, 0x001cdded, 0x0041cefa, 0x0026f8c0, 0x007bebd7,
+	0x00000000, 0x00512c6d, 0x00225bd9, 0x007377b4, 0x0044b7b2, 0x00159bdf, 0x0066ec6b, 0x0037c006,
+	0x00096c67, 0x0058400a, 0x002b37be, 0x007a1bd3, 0x004ddbd5, 0x001cf7b8, 0x006f800c, 0x003eac61,
+	0x00000000, 0x0012d8ce, 0x0025b19c, 0x00376952, 0x004b6338, 0x0059bbf6, 0x006ed2a4, 0x007c0a6a,
+	0x0016c573, 0x00041dbd, 0x003374ef, 0x0021ac21, 0x005da64b, 0x004f7e85, 0x007817d7, 0x006acf19,
+	0x00000000, 0x002d8ae6, 0x005b15cc, 0x00769f2a, 0x0036289b, 0x001ba27d, 0x006d3d57, 0x0040b7b1,
+	0x006c5136, 0x0041dbd0, 0x003744fa, 0x001ace1c, 0x005a79ad, 0x0077f34b, 0x00016c61, 0x002ce687,
+	0x00000000, 0x0058a16f, 0x003141dd, 0x0069e0b2, 0x006283ba, 0x003a22d5, 0x0053c267, 0x000b6308,
+	0x00450477, 0x001da518, 0x007445aa, 0x002ce4c5, 0x002787cd, 0x007f26a2, 0x0016c610, 0x004e677f,
+	0x00000000, 0x00492ac7, 0x0012568d, 0x005b7c4a, 0x0024ad1a, 0x006d87dd, 0x0036fb97, 0x007fd150,
+	0x00495a34, 0x000070f3, 0x005b0cb9, 0x0012267e, 0x006df72e, 0x0024dde9, 0x007fa1a3, 0x00368b64,
+	0x00000000, 0x0012b76b, 0x00256ed6, 0x0037d9bd, 0x004addac, 0x00586ac7, 0x006fb37a, 0x007d0411,
+	0x0015b85b, 0x00070f30, 0x0030d68d, 0x002261e6, 0x005f65f7, 0x004dd29c, 0x007a0b21, 0x0068bc4a,
+	0x00000000, 0x002b70b6, 0x0056e16c, 0x007d91da, 0x002dc1db, 0x0006b16d, 0x007b20b7, 0x00505001,
+	0x005b83b6, 0x0070f300, 0x000d62da, 0x0026126c, 0x0076426d, 0x005d32db, 0x0020a301, 0x000bd3b7,
+	0x00000000, 0x0037046f, 0x006e08de, 0x00590cb1, 0x005c12bf, 0x006b16d0, 0x00321a61, 0x00051e0e,
+	0x0038267d, 0x000f2212, 0x00562ea3, 0x00612acc, 0x006434c2, 0x005330ad, 0x000a3c1c, 0x003d3873,
+	0x00000000, 0x00704cfa, 0x00609af7, 0x0010d60d, 0x004136ed, 0x00317a17, 0x0021ac1a, 0x0051e0e0,
+	0x00026ed9, 0x00722223, 0x0062f42e, 0x0012b8d4, 0x00435834, 0x003314ce, 0x0023c2c3, 0x00538e39,
+	0x00000000, 0x0004ddb2, 0x0009bb64, 0x000d66d6, 0x001376c8, 0x0017ab7a, 0x001acdac, 0x001e101e,
+	0x0026ed90, 0x00223022, 0x002f56f4, 0x002b8b46, 0x00359b58, 0x003146ea, 0x003c203c, 0x0038fd8e,
+	0x00000000, 0x004ddb20, 0x001bb543, 0x00566e63, 0x00376a86, 0x007ab1a6, 0x002cdfc5, 0x006104e5,
+	0x006ed50c, 0x00230e2c, 0x0075604f, 0x0038bb6f, 0x0059bf8a, 0x001464aa, 0x00420ac9, 0x000fd1e9,
+	0x00000000, 0x005da91b, 0x003b5135, 0x0066f82e, 0x0076a26a, 0x002b0b71, 0x004df35f, 0x00105a44,
+	0x006d47d7, 0x0030eecc, 0x005616e2, 0x000bbff9, 0x001be5bd, 0x00464ca6, 0x0020b488, 0x007d1d93,
+	0x00000000, 0x0033ee0e, 0x0067dc1c, 0x00543212, 0x004fbb3b, 0x007c5535, 0x00286727, 0x001b8929,
+	0x001f7575, 0x002c9b7b, 0x0078a969, 0x004b4767, 0x0050ce4e, 0x00632040, 0x00371252, 0x0004fc5c,
+	0x00000000, 0x003eeaea, 0x007dd5d4, 0x00433f3e, 0x007ba8ab, 0x00454241, 0x00067d7f, 0x00389795,
+	0x00775255, 0x0049b8bf, 0x000a8781, 0x00346d6b, 0x000cfafe, 0x00321014, 0x00712f2a, 0x004fc5c0,
+	0x00000000, 0x006ea7a9, 0x005d4c51, 0x0033ebf8, 0x003a9ba1, 0x00543c08, 0x0067d7f0, 0x00097059,
+	0x00753742, 0x001b90eb, 0x00287b13, 0x0046dcba, 0x004face3, 0x00210b4a, 0x0012e0b2, 0x007c471b,
+	0x00000000, 0x006a6d87, 0x0054d80d, 0x003eb58a, 0x0029b319, 0x0043de9e, 0x007d6b14, 0x00170693,
+	0x00536632, 0x00390bb5, 0x0007be3f, 0x006dd3b8, 0x007ad52b, 0x0010b8ac, 0x002e0d26, 0x004460a1,
+	0x00000000, 0x0026cf67, 0x004d9ece, 0x006b51a9, 0x001b3e9f, 0x003df1f8, 0x0056a051, 0x00706f36,
+	0x00367d3e, 0x0010b259, 0x007be3f0, 0x005d2c97, 0x002d43a1, 0x000b8cc6, 0x0060dd6f, 0x00461208,
+	0x00000000, 0x006cfa7c, 0x0059f7fb, 0x00350d87, 0x0033ecf5, 0x005f1689, 0x006a1b0e, 0x0006e172,
+	0x0067d9ea, 0x000b2396, 0x003e2e11, 0x0052d46d, 0x0054351f, 0x0038cf63, 0x000dc2e4, 0x00613898,
+	0x00000000, 0x004fb0d7, 0x001f62ad, 0x0050d27a, 0x003ec55a, 0x0071758d, 0x0021a7f7, 0x006e1720,
+	0x007d8ab4, 0x00323a63, 0x0062e819, 0x002d58ce, 0x00434fee, 0x000cff39, 0x005c2d43, 0x00139d94,
+	0x00000000, 0x007b166b, 0x00762fd5, 0x000d39be, 0x006c5ca9, 0x00174ac2, 0x001a737c, 0x00616517,
+	0x0058ba51, 0x0023ac3a, 0x002e9584, 0x005583ef, 0x0034e6f8, 0x004ff093, 0x0042c92d, 0x0039df46,
+	0x00000000, 0x00777cdd, 0x006efab9, 0x00198664, 0x005df671, 0x002a8aac, 0x00330cc8, 0x00447015,
+	0x003befe1, 0x004c933c, 0x00551558, 0x00226985, 0x00661990, 0x0011654d, 0x0008e329, 0x007f9ff4,
+	0x00000000, 0x0077dfc2, 0x006fbc87, 0x00186345, 0x005f7a0d, 0x0028a5cf, 0x0030c68a, 0x00471948,
+	0x003ef719, 0x004928db, 0x00514b9e, 0x0026945c, 0x00618d14, 0x001652d6, 0x000e3193, 0x0079ee51,
+	0x00000000, 0x007dee32, 0x007bdf67, 0x00063155, 0x0077bdcd, 0x000a53ff, 0x000c62aa, 0x00718c98,
+	0x006f7899, 0x001296ab, 0x0014a7fe, 0x006949cc, 0x0018c554, 0x00652b66, 0x00631a33, 0x001ef401,
+	0x00000000, 0x005ef231, 0x003de761, 0x00631550, 0x007bcec2, 0x00253cf3, 0x004629a3, 0x0018db92,
+	0x00779e87, 0x00296cb6, 0x004a79e6, 0x00148bd7, 0x000c5045, 0x0052a274, 0x0031b724, 0x006f4515,
+	0x00000000, 0x006f3e0d, 0x005e7f19, 0x00314114, 0x003cfd31, 0x0053c33c, 0x00628228, 0x000dbc25,
+	0x0079fa62, 0x0016c46f, 0x0027857b, 0x0048bb76, 0x00450753, 0x002a395e, 0x001b784a, 0x00744647,
+	0x00000000, 0x0073f7c7, 0x0067ec8d, 0x00141b4a, 0x004fda19, 0x003c2dde, 0x00283694, 0x005bc153,
+	0x001fb731, 0x006c40f6, 0x00785bbc, 0x000bac7b, 0x00506d28, 0x00239aef, 0x003781a5, 0x00447662,
+	0x00000000, 0x003f6e62, 0x007edcc4, 0x0041b2a6, 0x007dba8b, 0x0042d4e9, 0x0003664f, 0x003c082d,
+	0x007b7615, 0x00441877, 0x0005aad1, 0x003ac4b3, 0x0006cc9e, 0x0039a2fc, 0x0078105a, 0x00477e38,
+	0x00000000, 0x0076ef29, 0x006ddd51, 0x001b3278, 0x005bb9a1, 0x002d5688, 0x003664f0, 0x00408bd9,
+	0x00377041, 0x00419f68, 0x005aad10, 0x002c4239, 0x006cc9e0, 0x001a26c9, 0x000114b1, 0x0077fb98,
+	0x00000000, 0x004ee4e2, 0x001dcac7, 0x00532e25, 0x003b958e, 0x0075716c, 0x00265f49, 0x0068bbab,
+	0x00772b1c, 0x0039cffe, 0x006ae1db, 0x00240539, 0x004cbe92, 0x00025a70, 0x00517455, 0x001f90b7,
+	0x00000000, 0x006e553b, 0x005ca975, 0x0032fc4e, 0x003951e9, 0x005704d2, 0x0065f89c, 0x000bada7,
+	0x0072a3d2, 0x001cf6e9, 0x002e0aa7, 0x00405f9c, 0x004bf23b, 0x0025a700, 0x00175b4e, 0x00790e75,
+	0x00000000, 0x006544a7, 0x004a8a4d, 0x002fceea, 0x00151799, 0x0070533e, 0x005f9dd4, 0x003ad973,
+	0x002a2f32, 0x004f6b95, 0x0060a57f, 0x0005e1d8, 0x003f38ab, 0x005a7c0c, 0x0075b2e6, 0x0010f641,
+	0x00000000, 0x00545e64, 0x0028bfcb, 0x007ce1af, 0x00517f96, 0x000521f2, 0x0079c05d, 0x002d9e39,
+	0x0022fc2f, 0x0076a24b, 0x000a43e4, 0x005e1d80, 0x007383b9, 0x0027dddd, 0x005b3c72, 0x000f6216,
+	0x00000000, 0x0045f85e, 0x000bf3bf, 0x004e0be1, 0x0017e77e, 0x00521f20, 0x001c14c1, 0x0059ec9f,
+	0x002fcefc, 0x006a36a2, 0x00243d43, 0x0061c51d, 0x00382982, 0x007dd1dc, 0x0033da3d, 0x00762263,
+	0x00000000, 0x005f9df8, 0x003f38f3, 0x0060a50b, 0x007e71e6, 0x0021ec1e, 0x00414915, 0x001ed4ed,
+	0x007ce0cf, 0x00237d37, 0x0043d83c, 0x001c45c4, 0x00029129, 0x005d0cd1, 0x003da9da, 0x00623422,
+	0x00000000, 0x0079c29d, 0x00738639, 0x000a44a4, 0x00670f71, 0x001ecdec, 0x00148948, 0x006d4bd5,
+	0x004e1de1, 0x0037df7c, 0x003d9bd8, 0x00445945, 0x00291290, 0x0050d00d, 0x005a94a9, 0x00235634,
+	0x00000000, 0x001c38c1, 0x00387182, 0x00244943, 0x0070e304, 0x006cdbc5, 0x00489286, 0x0054aa47,
+	0x0061c50b, 0x007dfdca, 0x0059b489, 0x00458c48, 0x0011260f, 0x000d1ece, 0x0029578d, 0x00356f4c,
+};
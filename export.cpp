@@ -0,0 +1,283 @@
+/* adplayer - A player for SCUMM AD resource files.
+ *
+ * (c) 2011 by Johannes Schickel <lordhoto at gmail dot com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "export.h"
+#include "adplayer.h"
+#include "writelog.h"
+
+#include <stdexcept>
+#include <algorithm>
+#include <fstream>
+#include <vector>
+#include <cstring>
+
+namespace {
+typedef std::vector<uint8_t> ExportBuffer;
+
+void putUint16(ExportBuffer &data, uint16_t value) {
+	data.push_back(value & 0xFF);
+	data.push_back(value >> 8);
+}
+
+void putUint32(ExportBuffer &data, uint32_t value) {
+	putUint16(data, value & 0xFFFF);
+	putUint16(data, value >> 16);
+}
+
+void setUint32(ExportBuffer &data, size_t offset, uint32_t value) {
+	for (int i = 0; i < 4; ++i)
+		data[offset + i] = (value >> (i * 8)) & 0xFF;
+}
+
+bool hasHighWrites(const WriteLog &log) {
+	size_t offset = 0;
+	uint64_t position = 0;
+	WriteLog::Event event;
+	do {
+		log.readEvent(offset, position, event);
+		if (event.type == WriteLog::kEventWriteHigh)
+			return true;
+	} while (event.type != WriteLog::kEventEnd);
+	return false;
+}
+
+// DOSBox raw OPL capture, version 2.0.
+const char droMagic[8] = { 'D', 'B', 'R', 'A', 'W', 'O', 'P', 'L' };
+const uint8_t droTypeOPL2 = 0;
+const uint8_t droTypeOPL3 = 2;
+// Indices with the high bit set write to the second register bank.
+const size_t droMaxCodes = 0x80 - 2;
+
+/**
+ * Delays are stored as a short delay of 1 to 256 ms and a long delay of
+ * 1 to 256 times 256 ms, each with their own code.
+ */
+void putDRODelay(ExportBuffer &data, uint64_t milliseconds, uint8_t shortCode, uint8_t longCode) {
+	while (milliseconds >= 256) {
+		const uint64_t count = std::min<uint64_t>(milliseconds >> 8, 256);
+		data.push_back(longCode);
+		data.push_back(count - 1);
+		milliseconds -= count << 8;
+	}
+	if (milliseconds) {
+		data.push_back(shortCode);
+		data.push_back(milliseconds - 1);
+	}
+}
+
+void buildDRO(const WriteLog &log, ExportBuffer &file) {
+	// Every register written gets a code, the codes are only known after
+	// looking at all writes.
+	std::vector<uint8_t> codemap;
+	int codes[0x100];
+	std::fill(codes, codes + 0x100, -1);
+	bool isOPL3 = false;
+
+	size_t offset = 0;
+	uint64_t position = 0;
+	WriteLog::Event event;
+	do {
+		log.readEvent(offset, position, event);
+		if (event.type != WriteLog::kEventWrite && event.type != WriteLog::kEventWriteHigh)
+			continue;
+		isOPL3 |= event.type == WriteLog::kEventWriteHigh;
+
+		const uint8_t reg = event.reg & 0xFF;
+		if (codes[reg] >= 0)
+			continue;
+		if (codemap.size() >= droMaxCodes)
+			throw std::runtime_error("Too many registers for a DRO file");
+		codes[reg] = codemap.size();
+		codemap.push_back(reg);
+	} while (event.type != WriteLog::kEventEnd);
+
+	const uint8_t shortCode = codemap.size();
+	const uint8_t longCode = codemap.size() + 1;
+	const int rate = log.getRate();
+
+	ExportBuffer data;
+	uint64_t milliseconds = 0;
+	offset = 0;
+	position = 0;
+	do {
+		log.readEvent(offset, position, event);
+		if (event.type == WriteLog::kEventBlock)
+			continue;
+
+		// Delays are taken from the rounded positions, so they do not
+		// drift apart from the log.
+		const uint64_t eventMilliseconds = event.position * 1000 / rate;
+		putDRODelay(data, eventMilliseconds - milliseconds, shortCode, longCode);
+		milliseconds = eventMilliseconds;
+
+		if (event.type != WriteLog::kEventEnd) {
+			data.push_back(codes[event.reg & 0xFF] | (event.type == WriteLog::kEventWriteHigh ? 0x80 : 0x00));
+			data.push_back(event.value);
+		}
+	} while (event.type != WriteLog::kEventEnd);
+
+	file.assign(droMagic, droMagic + sizeof(droMagic));
+	putUint16(file, 2);
+	putUint16(file, 0);
+	putUint32(file, data.size() / 2);
+	putUint32(file, milliseconds);
+	file.push_back(isOPL3 ? droTypeOPL3 : droTypeOPL2);
+	// Interleaved and uncompressed data
+	file.push_back(0);
+	file.push_back(0);
+	file.push_back(shortCode);
+	file.push_back(longCode);
+	file.push_back(codemap.size());
+	file.insert(file.end(), codemap.begin(), codemap.end());
+	file.insert(file.end(), data.begin(), data.end());
+}
+
+// VGM version 1.51, which added the Yamaha OPL chips.
+const char vgmMagic[4] = { 'V', 'g', 'm', ' ' };
+const uint32_t vgmVersion = 0x151;
+const size_t vgmHeaderSize = 0x80;
+const int vgmRate = 44100;
+const uint32_t vgmClockYM3812 = 3579545;
+const uint32_t vgmClockYMF262 = 14318180;
+
+enum {
+	kVGMEOFOffset = 0x04,
+	kVGMVersion = 0x08,
+	kVGMSamples = 0x18,
+	kVGMLoopOffset = 0x1C,
+	kVGMLoopSamples = 0x20,
+	kVGMDataOffset = 0x34,
+	kVGMClockYM3812 = 0x50,
+	kVGMClockYMF262 = 0x5C
+};
+
+enum {
+	kVGMCommandYM3812 = 0x5A,
+	kVGMCommandYMF262Port0 = 0x5E,
+	kVGMCommandYMF262Port1 = 0x5F,
+	kVGMCommandWait = 0x61,
+	kVGMCommandWait735 = 0x62,
+	kVGMCommandWait882 = 0x63,
+	kVGMCommandEnd = 0x66,
+	kVGMCommandWaitShort = 0x70
+};
+
+void putVGMWait(ExportBuffer &data, uint64_t samples) {
+	while (samples) {
+		if (samples == 735) {
+			data.push_back(kVGMCommandWait735);
+			samples = 0;
+		} else if (samples == 882) {
+			data.push_back(kVGMCommandWait882);
+			samples = 0;
+		} else if (samples <= 16) {
+			data.push_back(kVGMCommandWaitShort + samples - 1);
+			samples = 0;
+		} else {
+			const uint16_t wait = std::min<uint64_t>(samples, 0xFFFF);
+			data.push_back(kVGMCommandWait);
+			putUint16(data, wait);
+			samples -= wait;
+		}
+	}
+}
+
+void buildVGM(const WriteLog &log, bool loops, uint64_t loopStart, ExportBuffer &file) {
+	const bool isOPL3 = hasHighWrites(log);
+	const int rate = log.getRate();
+
+	file.assign(vgmHeaderSize, 0);
+	std::memcpy(&file[0], vgmMagic, sizeof(vgmMagic));
+	setUint32(file, kVGMVersion, vgmVersion);
+	setUint32(file, kVGMDataOffset, vgmHeaderSize - kVGMDataOffset);
+	setUint32(file, isOPL3 ? kVGMClockYMF262 : kVGMClockYM3812, isOPL3 ? vgmClockYMF262 : vgmClockYM3812);
+
+	const uint64_t loopSamples = loopStart * vgmRate / rate;
+	size_t loopOffset = 0;
+	uint64_t samples = 0;
+
+	size_t offset = 0;
+	uint64_t position = 0;
+	WriteLog::Event event;
+	do {
+		log.readEvent(offset, position, event);
+		if (event.type == WriteLog::kEventBlock)
+			continue;
+
+		// The loop starts right before the first event at its position.
+		if (loops && !loopOffset && event.position >= loopStart) {
+			putVGMWait(file, loopSamples - samples);
+			samples = loopSamples;
+			loopOffset = file.size();
+		}
+
+		const uint64_t eventSamples = event.position * vgmRate / rate;
+		putVGMWait(file, eventSamples - samples);
+		samples = eventSamples;
+
+		if (event.type == WriteLog::kEventWrite) {
+			file.push_back(isOPL3 ? kVGMCommandYMF262Port0 : kVGMCommandYM3812);
+			file.push_back(event.reg);
+			file.push_back(event.value);
+		} else if (event.type == WriteLog::kEventWriteHigh) {
+			file.push_back(kVGMCommandYMF262Port1);
+			file.push_back(event.reg & 0xFF);
+			file.push_back(event.value);
+		}
+	} while (event.type != WriteLog::kEventEnd);
+	file.push_back(kVGMCommandEnd);
+
+	if (samples > 0xFFFFFFFF || file.size() > 0xFFFFFFFF)
+		throw std::runtime_error("Export is too long for a VGM file");
+
+	setUint32(file, kVGMEOFOffset, file.size() - kVGMEOFOffset);
+	setUint32(file, kVGMSamples, samples);
+	if (loopOffset) {
+		setUint32(file, kVGMLoopOffset, loopOffset - kVGMLoopOffset);
+		setUint32(file, kVGMLoopSamples, samples - loopSamples);
+	}
+}
+} // End of anonymous namespace
+
+void writeExport(const WriteLog &log, ExportFormat format, const std::string &filename, bool loops, uint64_t loopStart) {
+	if (!log.isFinished())
+		throw std::runtime_error("Write log is not finished");
+
+	ExportBuffer data;
+	if (format == kExportDRO)
+		buildDRO(log, data);
+	else
+		buildVGM(log, loops, loopStart, data);
+
+	std::ofstream file(filename.c_str(), std::ios::binary);
+	if (!file)
+		throw std::runtime_error("Could not open export file: " + filename);
+	file.write(reinterpret_cast<const char *>(&data[0]), data.size());
+	if (!file)
+		throw std::runtime_error("Writing export file failed: " + filename);
+}
+
+uint64_t exportToFile(Player &player, ExportFormat format, const std::string &filename, uint64_t maxSamples) {
+	WriteLog log(player.getRate());
+	uint64_t loopStart = 0;
+	const bool loops = player.exportWrites(log, maxSamples, loopStart);
+	writeExport(log, format, filename, loops, loopStart);
+	return log.getLength();
+}
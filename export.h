@@ -0,0 +1,68 @@
+/* adplayer - A player for SCUMM AD resource files.
+ *
+ * (c) 2011 by Johannes Schickel <lordhoto at gmail dot com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef EXPORT_H
+#define EXPORT_H
+
+#include <string>
+#include <stdint.h>
+
+class Player;
+class WriteLog;
+
+/**
+ * Register log formats the writes of a player can be exported to.
+ *
+ * DRO is the capture format of DOSBox, version 2 with millisecond delays.
+ * VGM stores the writes for a YM3812 with delays in 44.1 kHz samples and
+ * supports a loop. Writes to the second register bank switch both formats
+ * to an OPL3.
+ */
+enum ExportFormat {
+	kExportDRO,
+	kExportVGM
+};
+
+/**
+ * Store an export made by Player::exportWrites in a file.
+ *
+ * @param log       Finished log of the writes.
+ * @param format    Format of the file.
+ * @param filename  Name of the file to create.
+ * @param loops     Whether the log ends with a loop, DRO files can not
+ *                  store it.
+ * @param loopStart Position of the loop start in the log.
+ */
+void writeExport(const WriteLog &log, ExportFormat format, const std::string &filename, bool loops, uint64_t loopStart);
+
+/**
+ * Run the sequencer of a player in fast forward and store its register
+ * writes in a file, see Player::exportWrites.
+ *
+ * @param player     Player to export, it must not have rendered yet.
+ * @param format     Format of the file.
+ * @param filename   Name of the file to create.
+ * @param maxSamples Maximum length of the export in samples, SFX resources
+ *                   can loop forever.
+ * @return Length of the export in samples.
+ */
+uint64_t exportToFile(Player &player, ExportFormat format, const std::string &filename, uint64_t maxSamples);
+
+#endif
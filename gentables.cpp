@@ -0,0 +1,291 @@
+/*
+ *  Copyright (C) 2002-2011  The DOSBox Team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/*
+	Generates dbopl_tables.h, the lookup tables DBOPL used to setup at
+	runtime in InitTables. Having them as constant data means there is no
+	startup cost and the tables are shared between all emulator instances.
+
+	Regenerate with "make tables".
+*/
+
+#include <stdio.h>
+#include <math.h>
+#include <stdint.h>
+
+#define TREMOLO_TABLE 52
+#define MUL_SH		16
+//Feedback taps of the noise generator
+#define NOISE_TAPS	0x800302
+
+//How much to substract from the base value for the final attenuation
+static const uint8_t KslCreateTable[16] = {
+	//0 will always be be lower than 7 * 8
+	64, 32, 24, 19,
+	16, 12, 11, 10,
+	 8,  6,  5,  4,
+	 3,  2,  1,  0,
+};
+
+static void PrintTable( const char* type, const char* name, const int* table, int size, int perLine ) {
+	printf( "static const %s %s[ %d ] = {\n", type, name, size );
+	for ( int i = 0; i < size; i++ ) {
+		if ( i % perLine == 0 )
+			printf( "\t" );
+		printf( "%d,", table[i] );
+		if ( i % perLine == perLine - 1 || i == size - 1 )
+			printf( "\n" );
+		else
+			printf( " " );
+	}
+	printf( "};\n" );
+}
+
+static void PrintHexTable( const char* type, const char* name, const uint32_t* table, int size, int perLine ) {
+	printf( "static const %s %s[ %d ] = {\n", type, name, size );
+	for ( int i = 0; i < size; i++ ) {
+		if ( i % perLine == 0 )
+			printf( "\t" );
+		printf( "0x%08x,", table[i] );
+		if ( i % perLine == perLine - 1 || i == size - 1 )
+			printf( "\n" );
+		else
+			printf( " " );
+	}
+	printf( "};\n" );
+}
+
+static void GenerateExpTable() {
+	int ExpTable[ 256 ];
+	//Exponential volume table, same as the real adlib
+	for ( int i = 0; i < 256; i++ ) {
+		//Save them in reverse
+		ExpTable[i] = (int)( 0.5 + ( pow(2.0, ( 255 - i) * ( 1.0 /256 ) )-1) * 1024 );
+		ExpTable[i] += 1024; //or remove the -1 oh well :)
+		//Preshift to the left once so the final volume can shift to the right
+		ExpTable[i] *= 2;
+	}
+	PrintTable( "Bit16u", "ExpTable", ExpTable, 256, 16 );
+}
+
+static void GenerateSinTable() {
+	int SinTable[ 512 ];
+	//Add 0.5 for the trunc rounding of the integer cast
+	//Do a PI sinetable instead of the original 0.5 PI
+	for ( int i = 0; i < 512; i++ ) {
+		SinTable[i] = (int16_t)( 0.5 - log10( sin( (i + 0.5) * (M_PI / 512.0) ) ) / log10(2.0)*256 );
+	}
+	PrintTable( "Bit16u", "SinTable", SinTable, 512, 16 );
+}
+
+static void FillWaveGaps( int16_t* WaveTable ) {
+	//	|    |//\\|____|WAV7|//__|/\  |____|/\/\|
+	//	|\\//|    |    |WAV7|    |  \/|    |    |
+	//	|06  |0126|27  |7   |3   |4   |4 5 |5   |
+	for ( int i = 0; i < 256; i++ ) {
+		//Fill silence gaps
+		WaveTable[ 0x400 + i ] = WaveTable[0];
+		WaveTable[ 0x500 + i ] = WaveTable[0];
+		WaveTable[ 0x900 + i ] = WaveTable[0];
+		WaveTable[ 0xc00 + i ] = WaveTable[0];
+		WaveTable[ 0xd00 + i ] = WaveTable[0];
+		//Replicate sines in other pieces
+		WaveTable[ 0x800 + i ] = WaveTable[ 0x200 + i ];
+		//double speed sines
+		WaveTable[ 0xa00 + i ] = WaveTable[ 0x200 + i * 2 ];
+		WaveTable[ 0xb00 + i ] = WaveTable[ 0x000 + i * 2 ];
+		WaveTable[ 0xe00 + i ] = WaveTable[ 0x200 + i * 2 ];
+		WaveTable[ 0xf00 + i ] = WaveTable[ 0x200 + i * 2 ];
+	}
+}
+
+static void PrintWaveTable( const char* name, const int16_t* WaveTable ) {
+	int table[ 8 * 512 ];
+	for ( int i = 0; i < 8 * 512; i++ )
+		table[i] = WaveTable[i];
+	PrintTable( "Bit16s", name, table, 8 * 512, 16 );
+}
+
+static void GenerateMulTables() {
+	int MulTable[ 384 ];
+	//Multiplication based tables
+	for ( int i = 0; i < 384; i++ ) {
+		int s = i * 8;
+		//TODO maybe keep some of the precision errors of the original table?
+		double val = ( 0.5 + ( pow(2.0, -1.0 + ( 255 - s) * ( 1.0 /256 ) )) * ( 1 << MUL_SH ));
+		MulTable[i] = (uint16_t)(val);
+	}
+	PrintTable( "Bit16u", "MulTable", MulTable, 384, 16 );
+
+	int16_t WaveTable[ 8 * 512 ];
+	//Sine Wave Base
+	for ( int i = 0; i < 512; i++ ) {
+		WaveTable[ 0x0200 + i ] = (int16_t)(sin( (i + 0.5) * (M_PI / 512.0) ) * 4084);
+		WaveTable[ 0x0000 + i ] = -WaveTable[ 0x200 + i ];
+	}
+	//Exponential wave
+	for ( int i = 0; i < 256; i++ ) {
+		WaveTable[ 0x700 + i ] = (int16_t)( 0.5 + ( pow(2.0, -1.0 + ( 255 - i * 8) * ( 1.0 /256 ) ) ) * 4085 );
+		WaveTable[ 0x6ff - i ] = -WaveTable[ 0x700 + i ];
+	}
+	FillWaveGaps( WaveTable );
+	PrintWaveTable( "MulWaveTable", WaveTable );
+}
+
+static void GenerateLogTables() {
+	int16_t WaveTable[ 8 * 512 ];
+	//Sine Wave Base
+	for ( int i = 0; i < 512; i++ ) {
+		WaveTable[ 0x0200 + i ] = (int16_t)( 0.5 - log10( sin( (i + 0.5) * (M_PI / 512.0) ) ) / log10(2.0)*256 );
+		WaveTable[ 0x0000 + i ] = ((int16_t)0x8000) | WaveTable[ 0x200 + i];
+	}
+	//Exponential wave
+	for ( int i = 0; i < 256; i++ ) {
+		WaveTable[ 0x700 + i ] = i * 8;
+		WaveTable[ 0x6ff - i ] = ((int16_t)0x8000) | i * 8;
+	}
+	FillWaveGaps( WaveTable );
+	PrintWaveTable( "LogWaveTable", WaveTable );
+}
+
+static void GenerateKslTable() {
+	int KslTable[ 8 * 16 ];
+	//Create the ksl table
+	for ( int oct = 0; oct < 8; oct++ ) {
+		int base = oct * 8;
+		for ( int i = 0; i < 16; i++ ) {
+			int val = base - KslCreateTable[i];
+			if ( val < 0 )
+				val = 0;
+			//*4 for the final range to match attenuation range
+			KslTable[ oct * 16 + i ] = val * 4;
+		}
+	}
+	PrintTable( "Bit8u", "KslTable", KslTable, 8 * 16, 16 );
+}
+
+static void GenerateTremoloTable() {
+	int TremoloTable[ TREMOLO_TABLE ];
+	//Create the Tremolo table, just increase and decrease a triangle wave
+	//This is generated for ENV_EXTRA being 0
+	for ( int i = 0; i < TREMOLO_TABLE / 2; i++ ) {
+		TremoloTable[i] = i;
+		TremoloTable[TREMOLO_TABLE - 1 - i] = i;
+	}
+	PrintTable( "Bit8u", "TremoloTable", TremoloTable, TREMOLO_TABLE, 13 );
+}
+
+static uint32_t NoiseStep( uint32_t value ) {
+	value ^= ( NOISE_TAPS ) & ( 0 - (value & 1 ) );
+	return value >> 1;
+}
+
+static uint32_t NoiseApply( const uint32_t* columns, uint32_t value ) {
+	uint32_t result = 0;
+	for ( int b = 0; b < 32; b++ ) {
+		if ( value & ( 1u << b ) )
+			result ^= columns[b];
+	}
+	return result;
+}
+
+static void GenerateNoiseJumpTable() {
+	//A step of the noise generator is linear, so 2^p steps at once are the
+	//xor of the results for every nibble of the value on its own
+	static uint32_t NoiseJumpTable[ 32 * 8 * 16 ];
+	uint32_t columns[ 32 ];
+	for ( int b = 0; b < 32; b++ )
+		columns[b] = NoiseStep( 1u << b );
+	for ( int p = 0; p < 32; p++ ) {
+		for ( int i = 0; i < 8; i++ ) {
+			for ( int n = 0; n < 16; n++ )
+				NoiseJumpTable[ ( p * 8 + i ) * 16 + n ] = NoiseApply( columns, (uint32_t)n << ( i * 4 ) );
+		}
+		//Twice the steps for the next power
+		uint32_t next[ 32 ];
+		for ( int b = 0; b < 32; b++ )
+			next[b] = NoiseApply( columns, columns[b] );
+		for ( int b = 0; b < 32; b++ )
+			columns[b] = next[b];
+	}
+	PrintHexTable( "Bit32u", "NoiseJumpTable", NoiseJumpTable, 32 * 8 * 16, 8 );
+}
+
+static void GenerateNoiseCountTable() {
+	//The same per nibble results for every digit d of a step count below
+	//4096, after d * 16^p steps
+	static uint32_t NoiseCountTable[ 3 * 16 * 8 * 16 ];
+	uint32_t digit[ 32 ];
+	for ( int b = 0; b < 32; b++ )
+		digit[b] = NoiseStep( 1u << b );
+	for ( int p = 0; p < 3; p++ ) {
+		uint32_t columns[ 32 ];
+		for ( int b = 0; b < 32; b++ )
+			columns[b] = 1u << b;
+		for ( int d = 0; d < 16; d++ ) {
+			for ( int i = 0; i < 8; i++ ) {
+				for ( int n = 0; n < 16; n++ )
+					NoiseCountTable[ ( ( p * 16 + d ) * 8 + i ) * 16 + n ] = NoiseApply( columns, (uint32_t)n << ( i * 4 ) );
+			}
+			//One more time the steps of the digit
+			for ( int b = 0; b < 32; b++ )
+				columns[b] = NoiseApply( digit, columns[b] );
+		}
+		//16 times the steps for the next digit
+		for ( int r = 0; r < 4; r++ ) {
+			uint32_t next[ 32 ];
+			for ( int b = 0; b < 32; b++ )
+				next[b] = NoiseApply( digit, digit[b] );
+			for ( int b = 0; b < 32; b++ )
+				digit[b] = next[b];
+		}
+	}
+	PrintHexTable( "Bit32u", "NoiseCountTable", NoiseCountTable, 3 * 16 * 8 * 16, 8 );
+}
+
+int main() {
+	printf( "// This file is generated by gentables.cpp, do not edit it.\n" );
+	printf( "// Run \"make tables\" to regenerate it.\n\n" );
+
+	printf( "//Volume table used by wmHandler and wmTableLog\n" );
+	GenerateExpTable();
+	printf( "\n" );
+
+	printf( "//PI table used by wmHandler\n" );
+	GenerateSinTable();
+	printf( "\n" );
+
+	printf( "//Tables used by wmTableMul\n" );
+	GenerateMulTables();
+	printf( "\n" );
+
+	printf( "//Table used by wmTableLog\n" );
+	GenerateLogTables();
+	printf( "\n" );
+
+	GenerateKslTable();
+	printf( "\n" );
+	GenerateTremoloTable();
+	printf( "\n" );
+	printf( "//Noise value after 2^p steps, xor of the entries for every nibble\n" );
+	GenerateNoiseJumpTable();
+	printf( "\n" );
+	printf( "//Noise value after d * 16^p steps, xor of the entries for every nibble\n" );
+	GenerateNoiseCountTable();
+	return 0;
+}
@@ -0,0 +1,324 @@
+/* adplayer - A player for SCUMM AD resource files.
+ *
+ * (c) 2011 by Johannes Schickel <lordhoto at gmail dot com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "adplayer.h"
+#include "output.h"
+#include "render.h"
+#include "batch.h"
+#include "stats.h"
+#include "writelog.h"
+#include "export.h"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <csignal>
+
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread/thread.hpp>
+
+// SFX resources can loop forever, thus we limit the output length when
+// rendering into files.
+static const unsigned int maxRenderSeconds = 30 * 60;
+
+// Device buffer sizes in samples for normal and low latency playback.
+static const size_t defaultBufferSamples = 512;
+static const size_t lowLatencyBufferSamples = 256;
+
+// Set by the signal handlers, playback checks them regularly.
+static volatile std::sig_atomic_t statsRequested = 0;
+static volatile std::sig_atomic_t stopRequested = 0;
+
+void playFile(Player &player, const std::string &outputFile, size_t bufferSamples, bool reportLatency,
+              const std::string &statsFile, const std::string &traceFile, const std::string &writeLogFile);
+void printLatency(const AudioOutput &output);
+
+extern "C" void requestStats(int) {
+	statsRequested = 1;
+}
+
+extern "C" void requestStop(int) {
+	stopRequested = 1;
+}
+
+void outputHelp() {
+	std::printf("Usage:\n"
+	            "\tadplayer [--loom] [--engine name] [--waves name] [--rate hz] [--loops count] [--seek seconds] [--stats json-file] [--trace json-file] [--write-log log-file] [--render output-file [--export format]] input-file\n"
+	            "\tadplayer [--loom] [--engine name] [--waves name] [--rate hz] [--loops count] [--seek seconds] [--stats json-file] [--trace json-file] [--write-log log-file] [--low-latency] [--buffer samples] input-file\n"
+	            "\tadplayer [--loom] [--engine name] [--waves name] [--loops count] --batch output-dir [--export format] [--jobs count] [--lanes count] [--list list-file] [input...]\n"
+	            "\n"
+	            "\t    --loom        Switch for Loom v3 music files\n"
+	            "\t    --engine      Emulator engine, either scalar (default) or soa\n"
+	            "\t    --waves       Wave generator of the emulator, either mul (default),\n"
+	            "\t                  log or handler\n"
+	            "\t    --rate        Output sample rate, defaults to 44100\n"
+	            "\t    --loops       Number of times looping music repeats its loop,\n"
+	            "\t                  defaults to 0 for --render and --batch and to\n"
+	            "\t                  forever for playback\n"
+	            "\t    --seek        Start at the given position in seconds\n"
+	            "\t    --low-latency Play back with a small device buffer and report\n"
+	            "\t                  the measured latency and callback jitter\n"
+	            "\t    --buffer      Device buffer size in samples for playback\n"
+	            "\t    --stats       Write timing statistics to json-file at the end,\n"
+	            "\t                  during playback also on SIGUSR1\n"
+	            "\t    --trace       Write a Chrome trace of the sequencer and the\n"
+	            "\t                  emulator to json-file at the end\n"
+	            "\t    --write-log   Log all register writes into log-file, which can\n"
+	            "\t                  be replayed with adbench --replay\n"
+	            "\t    --render      Render into a WAV file instead of playing\n"
+	            "\t    --export      Only run the sequencer and store its register writes\n"
+	            "\t                  instead of rendering, format is dro or vgm\n"
+	            "\t    --batch       Render all inputs into WAV files in output-dir,\n"
+	            "\t                  directories are expanded to the files inside\n"
+	            "\t    --jobs        Number of worker threads for --batch, defaults\n"
+	            "\t                  to the number of cores\n"
+	            "\t    --lanes       Number of files each worker renders side by side\n"
+	            "\t                  for --batch, up to 8 share one emulator pass\n"
+	            "\t    --list        Read additional inputs from list-file, one per line\n");
+}
+
+int main(int argc, char *argv[]) {
+	bool isLoom = false;
+	std::string outputFile;
+	std::string batchDir;
+	unsigned int jobs = boost::thread::hardware_concurrency();
+	unsigned int lanes = 1;
+	std::vector<std::string> lists;
+	std::vector<std::string> inputs;
+	DBOPL::Engine engine = DBOPL::engineScalar;
+	DBOPL::WaveMode waveMode = DBOPL::wmTableMul;
+	double seekSeconds = 0;
+	int rate = 44100;
+	uint32_t loopLimit = Player::kLoopForever;
+	bool isLoopLimitSet = false;
+	bool lowLatency = false;
+	size_t bufferSamples = 0;
+	std::string statsFile;
+	std::string traceFile;
+	std::string writeLogFile;
+	bool isExport = false;
+	ExportFormat exportFormat = kExportDRO;
+
+	for (int i = 1; i < argc; ++i) {
+		if (!std::strcmp(argv[i], "--loom")) {
+			isLoom = true;
+		} else if (!std::strcmp(argv[i], "--engine") && i + 1 < argc && !std::strcmp(argv[i + 1], "scalar")) {
+			engine = DBOPL::engineScalar;
+			++i;
+		} else if (!std::strcmp(argv[i], "--engine") && i + 1 < argc && !std::strcmp(argv[i + 1], "soa")) {
+			engine = DBOPL::engineSoA;
+			++i;
+		} else if (!std::strcmp(argv[i], "--waves") && i + 1 < argc && !std::strcmp(argv[i + 1], "mul")) {
+			waveMode = DBOPL::wmTableMul;
+			++i;
+		} else if (!std::strcmp(argv[i], "--waves") && i + 1 < argc && !std::strcmp(argv[i + 1], "log")) {
+			waveMode = DBOPL::wmTableLog;
+			++i;
+		} else if (!std::strcmp(argv[i], "--waves") && i + 1 < argc && !std::strcmp(argv[i + 1], "handler")) {
+			waveMode = DBOPL::wmHandler;
+			++i;
+		} else if (!std::strcmp(argv[i], "--rate") && i + 1 < argc) {
+			rate = std::atoi(argv[++i]);
+		} else if (!std::strcmp(argv[i], "--loops") && i + 1 < argc) {
+			loopLimit = std::strtoul(argv[++i], 0, 10);
+			isLoopLimitSet = true;
+		} else if (!std::strcmp(argv[i], "--low-latency")) {
+			lowLatency = true;
+		} else if (!std::strcmp(argv[i], "--buffer") && i + 1 < argc) {
+			bufferSamples = std::atoi(argv[++i]);
+		} else if (!std::strcmp(argv[i], "--seek") && i + 1 < argc) {
+			seekSeconds = std::atof(argv[++i]);
+		} else if (!std::strcmp(argv[i], "--stats") && i + 1 < argc) {
+			statsFile = argv[++i];
+		} else if (!std::strcmp(argv[i], "--trace") && i + 1 < argc) {
+			traceFile = argv[++i];
+		} else if (!std::strcmp(argv[i], "--write-log") && i + 1 < argc) {
+			writeLogFile = argv[++i];
+		} else if (!std::strcmp(argv[i], "--export") && i + 1 < argc && !std::strcmp(argv[i + 1], "dro")) {
+			isExport = true;
+			exportFormat = kExportDRO;
+			++i;
+		} else if (!std::strcmp(argv[i], "--export") && i + 1 < argc && !std::strcmp(argv[i + 1], "vgm")) {
+			isExport = true;
+			exportFormat = kExportVGM;
+			++i;
+		} else if (!std::strcmp(argv[i], "--render") && i + 1 < argc) {
+			outputFile = argv[++i];
+		} else if (!std::strcmp(argv[i], "--batch") && i + 1 < argc) {
+			batchDir = argv[++i];
+		} else if (!std::strcmp(argv[i], "--jobs") && i + 1 < argc) {
+			jobs = std::atoi(argv[++i]);
+		} else if (!std::strcmp(argv[i], "--lanes") && i + 1 < argc) {
+			lanes = std::atoi(argv[++i]);
+		} else if (!std::strcmp(argv[i], "--list") && i + 1 < argc) {
+			lists.push_back(argv[++i]);
+		} else if (argv[i][0] != '-') {
+			inputs.push_back(argv[i]);
+		} else {
+			outputHelp();
+			return -1;
+		}
+	}
+
+	const bool isBatch = !batchDir.empty();
+	if (isBatch ? (inputs.empty() && lists.empty()) || !outputFile.empty() || seekSeconds > 0 : inputs.size() != 1 || !lists.empty()) {
+		outputHelp();
+		return -1;
+	}
+
+	if ((isBatch && (rate != 44100 || !statsFile.empty() || !traceFile.empty() || !writeLogFile.empty())) || rate < 1000 || rate > 192000
+	    || ((lowLatency || bufferSamples) && (isBatch || !outputFile.empty()))
+	    || (isExport && ((!isBatch && outputFile.empty()) || !statsFile.empty() || !traceFile.empty() || !writeLogFile.empty()))) {
+		outputHelp();
+		return -1;
+	}
+
+	if (!bufferSamples)
+		bufferSamples = lowLatency ? lowLatencyBufferSamples : defaultBufferSamples;
+
+	// Rendering stops at the end of looping music unless asked otherwise.
+	if (!isLoopLimitSet && (isBatch || !outputFile.empty()))
+		loopLimit = 0;
+
+	try {
+		if (isBatch) {
+			BatchRenderer batch(batchDir, jobs, isLoom, static_cast<uint64_t>(maxRenderSeconds) * 44100);
+			batch.setEngine(engine);
+			batch.setWaveMode(waveMode);
+			batch.setLoopLimit(loopLimit);
+			batch.setLanes(lanes);
+			if (isExport)
+				batch.setExport(exportFormat);
+			for (std::vector<std::string>::const_iterator i = lists.begin(); i != lists.end(); ++i)
+				batch.addList(*i);
+			for (std::vector<std::string>::const_iterator i = inputs.begin(); i != inputs.end(); ++i)
+				batch.addInput(*i);
+			return batch.run() ? EXIT_SUCCESS : -1;
+		}
+
+		FileBuffer data;
+
+		loadADFile(inputs.front(), data);
+
+		boost::scoped_ptr<Player> player(createPlayer(data, isLoom, rate));
+		player->setEngine(engine);
+		player->setWaveMode(waveMode);
+		player->setLoopLimit(loopLimit);
+		if (seekSeconds > 0)
+			player->seek(static_cast<uint32_t>(seekSeconds * 1000));
+		if (isExport) {
+			const uint64_t maxSamples = static_cast<uint64_t>(maxRenderSeconds) * player->getRate();
+			if (exportToFile(*player, exportFormat, outputFile, maxSamples) == maxSamples && player->isPlaying())
+				std::fprintf(stderr, "WARNING: Export truncated after %u seconds\n", maxRenderSeconds);
+			return EXIT_SUCCESS;
+		}
+		playFile(*player, outputFile, bufferSamples, lowLatency, statsFile, traceFile, writeLogFile);
+	} catch (const std::exception &e) {
+		std::fprintf(stderr,  "ERROR: %s\n", e.what());
+		return -1;
+	}
+
+	return EXIT_SUCCESS;
+}
+
+void playFile(Player &player, const std::string &outputFile, size_t bufferSamples, bool reportLatency,
+              const std::string &statsFile, const std::string &traceFile, const std::string &writeLogFile) {
+	// Seeking is done before, thus it is not part of the profile and the
+	// trace.
+	Player::Profile profile;
+	if (!statsFile.empty())
+		player.setProfile(&profile);
+
+	Trace trace;
+	if (!traceFile.empty())
+		player.setTrace(&trace.addTrack(outputFile.empty() ? "Producer" : "Render"));
+
+	WriteLog writeLog(player.getRate());
+	const uint64_t start = player.getPosition();
+	if (!writeLogFile.empty())
+		player.setWriteLog(&writeLog);
+
+	if (outputFile.empty()) {
+		AudioOutput output(player, bufferSamples);
+		if (!traceFile.empty())
+			output.setTrace(&trace.addTrack("SDL audio"));
+
+		if (statsFile.empty() && traceFile.empty() && writeLogFile.empty()) {
+			output.play();
+		} else {
+			// Playback can be stopped with a signal, the statistics, the
+			// trace and the write log are still written then.
+			if (!statsFile.empty())
+				std::signal(SIGUSR1, requestStats);
+			std::signal(SIGINT, requestStop);
+			std::signal(SIGTERM, requestStop);
+
+			output.start();
+			while (!output.isDrained() && !stopRequested) {
+				if (statsRequested) {
+					statsRequested = 0;
+					writeStatistics(statsFile, player, profile, &output);
+				}
+				boost::this_thread::sleep_for(boost::chrono::milliseconds(10));
+			}
+			output.stop();
+			if (!statsFile.empty())
+				writeStatistics(statsFile, player, profile, &output);
+		}
+
+		if (reportLatency)
+			printLatency(output);
+	} else {
+		const uint64_t maxSamples = static_cast<uint64_t>(maxRenderSeconds) * player.getRate();
+		if (renderToFile(player, outputFile, maxSamples) == maxSamples && player.isPlaying())
+			std::fprintf(stderr, "WARNING: Output truncated after %u seconds\n", maxRenderSeconds);
+		if (!statsFile.empty())
+			writeStatistics(statsFile, player, profile, 0);
+	}
+
+	if (!traceFile.empty())
+		trace.write(traceFile);
+	if (!writeLogFile.empty()) {
+		writeLog.finish(player.getPosition() - start);
+		writeLog.save(writeLogFile);
+	}
+	player.setProfile(0);
+	player.setTrace(0);
+	player.setWriteLog(0);
+}
+
+void printLatency(const AudioOutput &output) {
+	const AudioOutput::Statistics &stats = output.getStatistics();
+
+	std::printf("Device buffer: %u samples\n", static_cast<unsigned int>(output.getDeviceSamples()));
+	std::printf("Callbacks: %u, underruns: %u\n", stats.callbacks, stats.underruns);
+	if (stats.latencyCount) {
+		std::printf("Latency from register write to device: min %.1f ms, avg %.1f ms, max %.1f ms\n",
+		            stats.minLatency * 1000, stats.totalLatency / stats.latencyCount * 1000,
+		            stats.maxLatency * 1000);
+	}
+	if (stats.jitterCount) {
+		std::printf("Callback jitter: avg %.2f ms, max %.2f ms\n",
+		            stats.totalJitter / stats.jitterCount * 1000, stats.maxJitter * 1000);
+	}
+}
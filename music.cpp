@@ -22,13 +22,16 @@
 
 #include <cstring>
 #include <stdexcept>
+#include <algorithm>
 
-MusicPlayer::MusicPlayer(const FileBuffer &file, const bool isLoom)
-    : Player(file), _isLoom(isLoom) {
+MusicPlayer::MusicPlayer(const FileBuffer &file, const bool isLoom, int rate)
+    : Player(file, rate), _isLoom(isLoom), _timeline(), _nextBatch(0), _callbackCount(0),
+      _isLooping(false), _loopCallback(0), _loopBatch(0), _trackEndWrite(0), _loopEndWrite(0) {
 	_timerLimit = _isLoom ? 473 : 256;
-	_musicTicks = _file.at(3) * (_isLoom ? 2 : 1);
-	_loopFlag = (_file.at(4) == 0);
-	_musicLoopStart = readWord(5);
+	_musicTicks = _file[3] * (_isLoom ? 2 : 1);
+	_loopFlag = (_file[4] == 0);
+	// The loop start is relative to the start of the event stream.
+	_musicLoopStart = 0x93 + readWord(5);
 
 	std::memset(_instrumentOffset, 0, sizeof(_instrumentOffset));
 	std::memset(_channelLastEvent, 0, sizeof(_channelLastEvent));
@@ -39,10 +42,10 @@ MusicPlayer::MusicPlayer(const FileBuffer &file, const bool isLoom)
 
 	const uint8_t instruments = _file[10];
 	for (uint8_t i = 0; i < instruments; ++i) {
-		const int instrIndex = _file.at(11 + i) - 1;
+		const int instrIndex = _file[11 + i] - 1;
 		if (0 <= instrIndex && instrIndex < 16) {
 			_instrumentOffset[instrIndex] = i * 16 + 16 + 3;
-			_voiceChannels |= _file.at(_instrumentOffset[instrIndex] + 13);
+			_voiceChannels |= _file[_instrumentOffset[instrIndex] + 13];
 		}
 	}
 
@@ -62,6 +65,112 @@ MusicPlayer::MusicPlayer(const FileBuffer &file, const bool isLoom)
 	writeReg(0xBD, _mdvdrState);
 
 	_isPlaying = true;
+	compile();
+}
+
+void MusicPlayer::compile() {
+	uint32_t callback = 0;
+	while (_isPlaying) {
+		// Without ticks the sequencer never reaches the next event.
+		if (!_musicTicks)
+			throw std::runtime_error("Music does not advance with a tempo of zero");
+
+		// The pass through the loop after the first end of the track
+		// continues from the state at the end, unlike the first one. It is
+		// compiled once more and repeated from then on.
+		const bool wasLooping = _isLooping;
+		recordWrites(&_timeline, callback);
+		sequence();
+		++callback;
+		if (_isLooping && !wasLooping)
+			_loopCallback = callback;
+	}
+	recordWrites(0, 0);
+
+	_timeline.setLength(callback);
+	_isPlaying = true;
+
+	while (_loopBatch < _timeline.getBatchCount() && _timeline.getBatchCallback(_loopBatch) < _loopCallback)
+		++_loopBatch;
+}
+
+void MusicPlayer::validate(const FileBuffer &data) {
+	// The event stream starts right after the header.
+	checkADOffset(data, 0x92, "Music header");
+	if (!data[3])
+		throwADError("Tempo of zero", 3);
+
+	const uint8_t instruments = data[10];
+	for (uint8_t i = 0; i < instruments; ++i) {
+		checkADOffset(data, 11 + i, "Instrument index");
+		const int instrIndex = data[11 + i] - 1;
+		if (0 <= instrIndex && instrIndex < 16)
+			checkADOffset(data, i * 16 + 16 + 3 + 13, "Instrument");
+	}
+
+	// Looping music continues at its loop start, which thus has to be an
+	// event. The loop has to take time, the sequencer would jump back to
+	// its start forever otherwise.
+	const uint32_t loopStart = 0x93 + (data[5] | (data[6] << 8));
+	bool loopFound = data[4] != 0;
+	bool loopDelayed = loopFound;
+
+	// Offsets into the event stream are only 16 bit wide.
+	const uint32_t size = std::min<uint32_t>(data.size(), 0x10000);
+	uint32_t offset = 0x93;
+	while (true) {
+		if (offset >= size)
+			throwADError("Music event exceeds the resource", offset);
+
+		const uint32_t eventOffset = offset;
+		if (eventOffset == loopStart)
+			loopFound = true;
+		const uint8_t command = data[offset++];
+		if (command == 0xFF) {
+			checkADOffset(data, offset, "Meta event");
+			const uint8_t type = data[offset++];
+			if (type == 47) {
+				if (!loopFound)
+					throwADError("Loop start is not at a music event", 5);
+				if (!loopDelayed)
+					throwADError("Loop has no delay", 5);
+				return;
+			} else if (type == 88) {
+				offset += 5;
+			} else {
+				checkADOffset(data, offset, "Meta event");
+				if (type == 81) {
+					checkADOffset(data, offset + 2, "Tempo event");
+					if (!(data[offset + 2] | (data[offset + 1] << 8)))
+						throwADError("Tempo of zero", eventOffset);
+				}
+				offset += data[offset] + 1;
+			}
+		} else if (command >= 0x80 && command < 0xA0) {
+			checkADOffset(data, offset + 1, "Note event");
+			offset += 2;
+		} else {
+			throwADError("Invalid music event", eventOffset);
+		}
+
+		if (offset >= size)
+			throwADError("Music event exceeds the resource", offset);
+
+		// Events of the same tick are separated by a zero byte, otherwise
+		// the delay until the next tick follows.
+		if (!data[offset]) {
+			++offset;
+			continue;
+		}
+
+		if (loopFound)
+			loopDelayed = true;
+		if (data[offset++] & 0x80) {
+			if (offset >= size)
+				throwADError("Music delay exceeds the resource", offset);
+			++offset;
+		}
+	}
 }
 
 bool MusicPlayer::isPlaying() const {
@@ -72,6 +181,62 @@ void MusicPlayer::callback() {
 	if (!_isPlaying)
 		return;
 
+	// Looping music jumps back to the loop start in the callbacks with an
+	// end of the track, the last one of the timeline is repeated. When the
+	// loop limit is reached only the writes up to the end are played.
+	const bool isTrackEnd = _isLooping && _callbackCount == _loopCallback - 1;
+	const bool isLoopEnd = _isLooping && _callbackCount == _timeline.getLength() - 1;
+	const bool stops = (isTrackEnd || isLoopEnd) && !loopPoint();
+
+	if (_nextBatch < _timeline.getBatchCount() && _timeline.getBatchCallback(_nextBatch) == _callbackCount) {
+		const Timeline::Write *end = _timeline.getBatchEnd(_nextBatch);
+		if (stops)
+			end = _timeline.getWrite(isTrackEnd ? _trackEndWrite : _loopEndWrite);
+		for (const Timeline::Write *write = _timeline.getBatchBegin(_nextBatch); write != end; ++write)
+			writeReg(write->reg, write->value);
+		++_nextBatch;
+	}
+
+	if (stops) {
+		_isPlaying = false;
+		return;
+	}
+
+	if (++_callbackCount == _timeline.getLength()) {
+		if (!_isLooping) {
+			_isPlaying = false;
+			return;
+		}
+		_callbackCount = _loopCallback;
+		_nextBatch = _loopBatch;
+	}
+}
+
+void MusicPlayer::saveSequencer(StateWriter &state) const {
+	// Only the position in the timeline changes during playback.
+	state.writeBool(_isLoom);
+	state.writeBool(_isPlaying);
+	state.writeUint32(_nextBatch);
+	state.writeUint32(_callbackCount);
+}
+
+void MusicPlayer::loadSequencer(StateReader &state) {
+	const bool isLoom = state.readBool();
+	const bool isPlaying = state.readBool();
+	const size_t nextBatch = state.readUint32();
+	const uint32_t callbackCount = state.readUint32();
+	if (isLoom != _isLoom || nextBatch > _timeline.getBatchCount() || callbackCount > _timeline.getLength())
+		throw std::runtime_error("Invalid music state");
+
+	_isPlaying = isPlaying;
+	_nextBatch = nextBatch;
+	_callbackCount = callbackCount;
+}
+
+void MusicPlayer::sequence() {
+	if (!_isPlaying)
+		return;
+
 	_musicTimer += _musicTicks;
 	if (_musicTimer < _timerLimit)
 		return;
@@ -83,25 +248,40 @@ void MusicPlayer::callback() {
 		return;
 
 	while (true) {
-		uint8_t command = _file.at(_curOffset++);
+		uint8_t command = _file[_curOffset++];
 		if (command == 0xFF) {
-			command = _file.at(_curOffset++);
+			command = _file[_curOffset++];
 			if (command == 47) {
-				// End of track
-				_isPlaying = false;
-				return;
+				// End of track. Looping music continues at the loop start
+				// right away. Compiling stops at the second end, after the
+				// rest of the callback is recorded as the start of the next
+				// pass.
+				if (!_loopFlag) {
+					_isPlaying = false;
+					return;
+				}
+
+				if (!_isLooping) {
+					_isLooping = true;
+					_trackEndWrite = _timeline.getWriteCount();
+				} else {
+					_loopEndWrite = _timeline.getWriteCount();
+					_isPlaying = false;
+				}
+				_curOffset = _musicLoopStart;
+				continue;
 			} else if (command == 88) {
 				// This is proposedly a debug information insertion. The CMS
 				// player code handles this differently, but is still using
 				// the same resources...
 				_curOffset += 5;
 			} else if (command == 81) {
-				uint16_t timing = _file.at(_curOffset + 2) | (_file.at(_curOffset + 1) << 8);
+				uint16_t timing = _file[_curOffset + 2] | (_file[_curOffset + 1] << 8);
 				_musicTicks = 0x73000 / timing;
-				command = _file.at(_curOffset++);
+				command = _file[_curOffset++];
 				_curOffset += command;
 			} else {
-				command = _file.at(_curOffset++);
+				command = _file[_curOffset++];
 				_curOffset += command;
 			}
 		} else {
@@ -110,7 +290,7 @@ void MusicPlayer::callback() {
 
 				const uint16_t instrOffset = _instrumentOffset[command];
 				if (instrOffset) {
-					if (_file.at(instrOffset + 13) != 0) {
+					if (_file[instrOffset + 13] != 0) {
 						setupRhythm(_file[instrOffset + 13], instrOffset);
 					} else {
 						uint8_t channel = findFreeChannel();
@@ -118,13 +298,13 @@ void MusicPlayer::callback() {
 							noteOff(channel);
 							setupChannel(channel, instrOffset);
 							_channelLastEvent[channel] = command + 0x90;
-							_channelFrequency[channel] = _file.at(_curOffset);
+							_channelFrequency[channel] = _file[_curOffset];
 							setupFrequency(channel, _file[_curOffset]);
 						}
 					}
 				}
 			} else {
-				const uint8_t note = _file.at(_curOffset);
+				const uint8_t note = _file[_curOffset];
 				command += 0x10;
 
 				uint8_t channel = 0xFF;
@@ -140,7 +320,7 @@ void MusicPlayer::callback() {
 				} else {
 					command -= 0x90;
 					const uint16_t instrOffset = _instrumentOffset[command];
-					if (instrOffset && _file.at(instrOffset + 13) != 0) {
+					if (instrOffset && _file[instrOffset + 13] != 0) {
 						const uint8_t rhythmInstr = _file[instrOffset + 13];
 						//if (rhythmInstr >= 6)
 						//	throw std::range_error("rhythmInstr >= 6");
@@ -155,16 +335,16 @@ void MusicPlayer::callback() {
 			_curOffset += 2;
 		}
 
-		if (_file.at(_curOffset) != 0)
+		if (_file[_curOffset] != 0)
 			break;
 		++_curOffset;
 	}
 
-	_nextEventTimer = _file.at(_curOffset++);
+	_nextEventTimer = _file[_curOffset++];
 	if (_nextEventTimer & 0x80) {
 		_nextEventTimer -= 0x80;
 		_nextEventTimer <<= 7;
-		_nextEventTimer |= _file.at(_curOffset++);
+		_nextEventTimer |= _file[_curOffset++];
 	}
 
 	_nextEventTimer >>= _isLoom ? 2 : 1;
@@ -209,16 +389,16 @@ void MusicPlayer::setupFrequency(uint8_t channel, int8_t frequency) {
 void MusicPlayer::setupRhythm(uint8_t rhythmInstr, uint16_t instrOffset) {
 	if (rhythmInstr == 1) {
 		setupChannel(6, instrOffset);
-		writeReg(0xA6, _file.at(instrOffset++));
-		writeReg(0xB6, _file.at(instrOffset) & 0xDF);
+		writeReg(0xA6, _file[instrOffset++]);
+		writeReg(0xB6, _file[instrOffset] & 0xDF);
 		_mdvdrState |= 0x10;
 		writeReg(0xBD, _mdvdrState);
 	} else if (rhythmInstr < 6) {
 		uint16_t secondOperatorOffset = instrOffset + 8;
 		setupOperator(_rhythmOperatorTable[rhythmInstr], secondOperatorOffset);
-		writeReg(0xA0 + _rhythmChannelTable[rhythmInstr], _file.at(instrOffset++));
-		writeReg(0xB0 + _rhythmChannelTable[rhythmInstr], _file.at(instrOffset++) & 0xDF);
-		writeReg(0xC0 + _rhythmChannelTable[rhythmInstr], _file.at(instrOffset));
+		writeReg(0xA0 + _rhythmChannelTable[rhythmInstr], _file[instrOffset++]);
+		writeReg(0xB0 + _rhythmChannelTable[rhythmInstr], _file[instrOffset++] & 0xDF);
+		writeReg(0xC0 + _rhythmChannelTable[rhythmInstr], _file[instrOffset]);
 		_mdvdrState |= _mdvdrTable[rhythmInstr];
 		writeReg(0xBD, _mdvdrState);
 	} else {
@@ -22,15 +22,38 @@
 #define MUSIC_H
 
 #include "adplayer.h"
+#include "timeline.h"
 
 class MusicPlayer : public Player {
 public:
-	MusicPlayer(const FileBuffer &file, const bool isLoom);
+	MusicPlayer(const FileBuffer &file, const bool isLoom, int rate = 44100);
+
+	/**
+	 * Check the header, the instruments and the event stream of a music
+	 * resource, see validateADFile.
+	 */
+	static void validate(const FileBuffer &data);
 
 	virtual bool isPlaying() const;
 protected:
 	virtual void callback();
+	virtual const char *getCallbackName() const { return "MusicPlayer::callback"; }
+	virtual void saveSequencer(StateWriter &state) const;
+	virtual void loadSequencer(StateReader &state);
 private:
+	/**
+	 * Run the sequencer for every callback up to the end of the music and
+	 * record the register writes into _timeline. For looping music this
+	 * continues up to the second end of the track. Throws a
+	 * std::runtime_error when the sequencer can not advance.
+	 */
+	void compile();
+
+	/**
+	 * Parse the events of one callback.
+	 */
+	void sequence();
+
 	void noteOff(uint8_t channel);
 	uint8_t findFreeChannel();
 	void setupFrequency(uint8_t channel, int8_t frequency);
@@ -55,6 +78,23 @@ private:
 	uint16_t _curOffset;
 	uint16_t _nextEventTimer;
 
+	Timeline _timeline;
+	size_t _nextBatch;
+	uint32_t _callbackCount;
+
+	/**
+	 * Looping music continues at the loop start in the same callback the
+	 * track ends in. The timeline ends with the callback of its second
+	 * end, the callbacks from _loopCallback, the one after the first end,
+	 * up to there are repeated forever. The end writes are the first ones
+	 * after each end, playback stops there when the loop limit is reached.
+	 */
+	bool _isLooping;
+	uint32_t _loopCallback;
+	size_t _loopBatch;
+	uint32_t _trackEndWrite;
+	uint32_t _loopEndWrite;
+
 	static const uint16_t _noteFrequencies[12];
 	static const uint8_t _mdvdrTable[6];
 	static const uint8_t _rhythmOperatorTable[6];
@@ -0,0 +1,258 @@
+/* adplayer - A player for SCUMM AD resource files.
+ *
+ * (c) 2011 by Johannes Schickel <lordhoto at gmail dot com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "output.h"
+#include "adplayer.h"
+
+#include <SDL.h>
+
+#include <stdexcept>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+
+namespace {
+// Samples rendered at once by the producer thread at most.
+const size_t renderQuantum = 256;
+// Register writes waiting for their latency to be measured.
+const size_t maxWriteMarkers = 256;
+} // End of anonymous namespace
+
+AudioOutput::Statistics::Statistics()
+    : callbacks(0), underruns(0), latencyCount(0), minLatency(0), maxLatency(0),
+      totalLatency(0), jitterCount(0), maxJitter(0), totalJitter(0), quanta(0), deadlineMisses(0),
+      renderSeconds(0), maxRenderSeconds(0) {
+	std::fill(latencyHistogram, latencyHistogram + kLatencyBuckets, 0);
+	std::fill(loadHistogram, loadHistogram + kLoadBuckets, 0);
+}
+
+AudioOutput::AudioOutput(Player &player, size_t deviceSamples)
+    : _player(player), _ring(player.getRate()), _ringSize(player.getRate()),
+      _deviceSamples(deviceSamples), _producer(), _running(false), _primed(false),
+      _finished(false), _drained(false), _underruns(0), _markers(maxWriteMarkers),
+      _readPosition(player.getPosition()), _nextMarker(), _hasNextMarker(false),
+      _hasLastCallback(false), _lastCallback(), _statistics(), _trace(), _producerMutex(), _callbackMutex() {
+	if (_deviceSamples < 1 || _deviceSamples > 32768)
+		throw std::runtime_error("Invalid audio buffer size");
+
+	if (SDL_Init(SDL_INIT_AUDIO) == -1)
+		throw std::runtime_error("Could not initialize SDL audio subsystem");
+
+	SDL_AudioSpec desired;
+	std::memset(&desired, 0, sizeof(desired));
+	desired.freq = _player.getRate();
+	desired.format = AUDIO_S16SYS;
+	desired.channels = 1;
+	desired.samples = _deviceSamples;
+	desired.callback = readSamples;
+	desired.userdata = static_cast<void *>(this);
+
+	// We pass no obtained spec here, thus SDL will take care of converting
+	// our output to whatever the hardware supports.
+	if (SDL_OpenAudio(&desired, 0) < 0) {
+		SDL_Quit();
+		throw std::runtime_error("Could not open audio device");
+	}
+}
+
+AudioOutput::~AudioOutput() {
+	stop();
+	SDL_CloseAudio();
+	SDL_Quit();
+}
+
+void AudioOutput::start() {
+	if (_producer.joinable())
+		return;
+
+	_running = true;
+	_primed = false;
+	// The time the output was stopped for is no callback interval.
+	_hasLastCallback = false;
+	_producer = boost::thread(&AudioOutput::produce, this);
+
+	// Let the producer fill the ring buffer before the device starts
+	// pulling samples.
+	while (!_primed)
+		boost::this_thread::sleep_for(boost::chrono::milliseconds(1));
+
+	SDL_PauseAudio(0);
+}
+
+void AudioOutput::stop() {
+	SDL_PauseAudio(1);
+
+	_running = false;
+	if (_producer.joinable())
+		_producer.join();
+
+	_statistics.underruns = _underruns;
+}
+
+AudioOutput::Snapshot AudioOutput::getSnapshot(const Player::Profile &profile) const {
+	boost::mutex::scoped_lock producerLock(_producerMutex);
+	boost::mutex::scoped_lock callbackLock(_callbackMutex);
+
+	Snapshot snapshot;
+	snapshot.position = _player.getPosition();
+	snapshot.profile = profile;
+	snapshot.statistics = _statistics;
+	snapshot.statistics.underruns = _underruns;
+	return snapshot;
+}
+
+void AudioOutput::play() {
+	start();
+	while (!_drained)
+		SDL_Delay(10);
+	stop();
+}
+
+void AudioOutput::readSamples(void *userdata, uint8_t *buffer, int len) {
+	AudioOutput *output = static_cast<AudioOutput *>(userdata);
+	int16_t *dst = reinterpret_cast<int16_t *>(buffer);
+	const size_t samples = len / 2;
+
+	if (output->_trace)
+		output->_trace->begin("SDL callback", "samples", samples);
+
+	// Nothing but copying is done here, the producer thread renders.
+	const size_t read = output->_ring.pop(dst, samples);
+	output->measureCallback(Clock::now(), read);
+	if (read < samples) {
+		std::fill(dst + read, dst + samples, 0);
+		if (output->_finished)
+			output->_drained = true;
+		else
+			++output->_underruns;
+	}
+
+	if (output->_trace)
+		output->_trace->end();
+}
+
+void AudioOutput::measureCallback(Clock::time_point now, size_t samples) {
+	const double bufferSeconds = static_cast<double>(_deviceSamples) / _player.getRate();
+	boost::mutex::scoped_lock lock(_callbackMutex);
+
+	if (_hasLastCallback) {
+		const double interval = boost::chrono::duration<double>(now - _lastCallback).count();
+		const double jitter = std::fabs(interval - bufferSeconds);
+		++_statistics.jitterCount;
+		_statistics.maxJitter = std::max(_statistics.maxJitter, jitter);
+		_statistics.totalJitter += jitter;
+	}
+	++_statistics.callbacks;
+	_hasLastCallback = true;
+	_lastCallback = now;
+
+	// The samples of all writes before the read position were just handed
+	// to the device, which plays them within the length of its buffer.
+	_readPosition += samples;
+	while (_hasNextMarker || _markers.pop(_nextMarker)) {
+		_hasNextMarker = true;
+		if (_nextMarker.position >= _readPosition)
+			break;
+		_hasNextMarker = false;
+
+		const double latency = boost::chrono::duration<double>(now - _nextMarker.time).count() + bufferSeconds;
+		if (!_statistics.latencyCount || latency < _statistics.minLatency)
+			_statistics.minLatency = latency;
+		_statistics.maxLatency = std::max(_statistics.maxLatency, latency);
+		_statistics.totalLatency += latency;
+		++_statistics.latencyCount;
+
+		size_t bucket = 0;
+		while (bucket + 1 < Statistics::kLatencyBuckets && latency * 1000 >= (1 << bucket))
+			++bucket;
+		++_statistics.latencyHistogram[bucket];
+	}
+}
+
+void AudioOutput::produce() {
+	const int rate = _player.getRate();
+	const size_t quantum = std::min(renderQuantum, _deviceSamples);
+	int16_t buffer[renderQuantum];
+
+	// The fill target covers the device buffer, the longest time rendering
+	// took lately and a margin. The margin grows with every underrun and
+	// shrinks again after ten seconds without one.
+	double renderPeak = 0;
+	size_t margin = 0;
+	uint32_t underruns = _underruns;
+	size_t sinceUnderrun = 0;
+
+	while (_running) {
+		if (!_player.isPlaying()) {
+			_finished = true;
+			_primed = true;
+			return;
+		}
+
+		if (_underruns != underruns) {
+			underruns = _underruns;
+			margin = std::min(margin * 2 + _deviceSamples, _ringSize / 2);
+			sinceUnderrun = 0;
+		} else if (sinceUnderrun >= static_cast<size_t>(rate) * 10) {
+			margin /= 2;
+			sinceUnderrun = 0;
+		}
+
+		const size_t renderAhead = static_cast<size_t>(renderPeak * rate * 2);
+		const size_t target = std::min(2 * _deviceSamples + renderAhead + margin, _ringSize - quantum);
+		if (_ringSize - _ring.write_available() >= target) {
+			_primed = true;
+			boost::this_thread::sleep_for(boost::chrono::milliseconds(1));
+			continue;
+		}
+
+		// getSnapshot reads the player and its profile between quanta.
+		boost::mutex::scoped_lock lock(_producerMutex);
+		const uint64_t lastWrite = _player.getLastWritePosition();
+		const Clock::time_point start = Clock::now();
+		_player.render(buffer, quantum);
+		const double seconds = boost::chrono::duration<double>(Clock::now() - start).count();
+		renderPeak = std::max(seconds, renderPeak * 0.99);
+		sinceUnderrun += quantum;
+		measureRender(seconds, quantum);
+
+		if (_player.getLastWritePosition() != lastWrite) {
+			const WriteMarker marker = { _player.getLastWritePosition(), start };
+			_markers.push(marker);
+		}
+
+		// The target leaves room for a whole quantum.
+		_ring.push(buffer, quantum);
+	}
+}
+
+void AudioOutput::measureRender(double seconds, size_t samples) {
+	const double load = seconds * _player.getRate() / samples;
+
+	++_statistics.quanta;
+	_statistics.renderSeconds += seconds;
+	_statistics.maxRenderSeconds = std::max(_statistics.maxRenderSeconds, seconds);
+	if (load > 1) {
+		++_statistics.deadlineMisses;
+		++_statistics.loadHistogram[Statistics::kLoadBuckets - 1];
+	} else {
+		++_statistics.loadHistogram[std::min<size_t>(static_cast<size_t>(load * 10), Statistics::kLoadBuckets - 2)];
+	}
+}
@@ -0,0 +1,241 @@
+/* adplayer - A player for SCUMM AD resource files.
+ *
+ * (c) 2011 by Johannes Schickel <lordhoto at gmail dot com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef OUTPUT_H
+#define OUTPUT_H
+
+#include <cstddef>
+#include <stdint.h>
+
+#include <boost/atomic.hpp>
+#include <boost/chrono.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/lockfree/spsc_queue.hpp>
+
+#include "adplayer.h"
+#include "trace.h"
+
+/**
+ * Plays back a Player through the SDL audio device.
+ *
+ * The samples are rendered ahead of time by a producer thread into a lock
+ * free ring buffer, the SDL audio callback only copies them out of it. This
+ * allows a small device buffer without any synthesis happening in the audio
+ * callback. SDL only offers a single audio device, thus there can only be
+ * one AudioOutput at a time.
+ *
+ * The player is only accessed by the producer thread while the output is
+ * started.
+ */
+class AudioOutput {
+public:
+	/**
+	 * Timing of the audio output, measured by the audio callback.
+	 */
+	struct Statistics {
+		Statistics();
+
+		uint32_t callbacks;
+		uint32_t underruns;
+
+		/**
+		 * Latencies counted by their upper bound in milliseconds, bucket
+		 * i holds those below 2^i ms and the last one all larger ones.
+		 */
+		enum { kLatencyBuckets = 12 };
+		uint32_t latencyHistogram[kLatencyBuckets];
+
+		/**
+		 * Time in seconds from a register write until the samples it
+		 * affects were played by the device. The time the device takes
+		 * is estimated as the length of its buffer.
+		 */
+		uint32_t latencyCount;
+		double minLatency;
+		double maxLatency;
+		double totalLatency;
+
+		/**
+		 * Deviation in seconds of the time between two callbacks from
+		 * the length of the device buffer. The first callback after
+		 * starting has no interval to measure.
+		 */
+		uint32_t jitterCount;
+		double maxJitter;
+		double totalJitter;
+
+		/**
+		 * Quanta rendered by the producer thread. A deadline is missed
+		 * when rendering took longer than playing back the quantum, the
+		 * output can only keep up on the buffered samples then.
+		 */
+		uint32_t quanta;
+		uint32_t deadlineMisses;
+		double renderSeconds;
+		double maxRenderSeconds;
+
+		/**
+		 * Quanta counted by the time rendering took relative to their
+		 * length, in steps of 10%. The last bucket holds the deadline
+		 * misses.
+		 */
+		enum { kLoadBuckets = 11 };
+		uint32_t loadHistogram[kLoadBuckets];
+	};
+
+	/**
+	 * @param player        Player to play back.
+	 * @param deviceSamples Size of the device buffer in samples, smaller
+	 *                      buffers mean a lower latency.
+	 */
+	AudioOutput(Player &player, size_t deviceSamples = 512);
+	~AudioOutput();
+
+	void start();
+	void stop();
+
+	/**
+	 * Play back the player until it has finished.
+	 */
+	void play();
+
+	/**
+	 * @return Whether the player has finished and all its samples were
+	 *         played back.
+	 */
+	bool isDrained() const { return _drained; }
+
+	size_t getDeviceSamples() const { return _deviceSamples; }
+
+	/**
+	 * Get the timing measured so far. This may only be called while the
+	 * output is stopped, it can be started again afterwards.
+	 */
+	const Statistics &getStatistics() const { return _statistics; }
+
+	/**
+	 * Timing of the output and of its player at the same moment.
+	 */
+	struct Snapshot {
+		uint64_t position;
+		Player::Profile profile;
+		Statistics statistics;
+	};
+
+	/**
+	 * Copy the timing measured so far, along with the position of the
+	 * player and the profile set on it. This may be called while the
+	 * output is started, the producer thread and the audio callback are
+	 * only held up while copying.
+	 *
+	 * @param profile Profile the player adds to.
+	 */
+	Snapshot getSnapshot(const Player::Profile &profile) const;
+
+	/**
+	 * Record a span for every audio callback into a trace track. This may
+	 * only be called while the output is stopped.
+	 *
+	 * @param track Track for the audio thread, 0 to stop tracing.
+	 */
+	void setTrace(Trace::Track *track) { _trace = track; }
+private:
+	AudioOutput(const AudioOutput &);
+	AudioOutput &operator=(const AudioOutput &);
+
+	static void readSamples(void *userdata, uint8_t *buffer, int len);
+
+	/**
+	 * Body of the producer thread, keeps the ring buffer filled up to the
+	 * fill target until the output is stopped or the player has finished.
+	 */
+	void produce();
+
+	Player &_player;
+
+	/**
+	 * Samples rendered ahead of the audio device.
+	 */
+	boost::lockfree::spsc_queue<int16_t> _ring;
+	const size_t _ringSize;
+	const size_t _deviceSamples;
+
+	boost::thread _producer;
+	boost::atomic<bool> _running;
+
+	/**
+	 * Set by the producer once the ring buffer was filled for the first
+	 * time after starting.
+	 */
+	boost::atomic<bool> _primed;
+
+	/**
+	 * Set by the producer once the player has finished, and by the audio
+	 * callback once the rest of its samples were played.
+	 */
+	boost::atomic<bool> _finished;
+	boost::atomic<bool> _drained;
+
+	/**
+	 * Number of times the audio callback found the ring buffer empty.
+	 */
+	boost::atomic<uint32_t> _underruns;
+
+	typedef boost::chrono::steady_clock Clock;
+
+	/**
+	 * Register writes are marked with the time they were rendered at, the
+	 * audio callback measures the latency when it reaches their position.
+	 */
+	struct WriteMarker {
+		uint64_t position;
+		Clock::time_point time;
+	};
+
+	boost::lockfree::spsc_queue<WriteMarker> _markers;
+
+	/**
+	 * Only used by the audio callback while the output is started.
+	 */
+	uint64_t _readPosition;
+	WriteMarker _nextMarker;
+	bool _hasNextMarker;
+	bool _hasLastCallback;
+	Clock::time_point _lastCallback;
+	Statistics _statistics;
+	Trace::Track *_trace;
+
+	void measureCallback(Clock::time_point now, size_t samples);
+
+	/**
+	 * Only used by the producer thread while the output is started.
+	 */
+	void measureRender(double seconds, size_t samples);
+
+	/**
+	 * Held by the producer thread while it renders and measures a quantum,
+	 * and by the audio callback while it measures. getSnapshot takes both.
+	 */
+	mutable boost::mutex _producerMutex;
+	mutable boost::mutex _callbackMutex;
+};
+
+#endif
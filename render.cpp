@@ -0,0 +1,42 @@
+/* adplayer - A player for SCUMM AD resource files.
+ *
+ * (c) 2011 by Johannes Schickel <lordhoto at gmail dot com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "render.h"
+#include "adplayer.h"
+#include "wav.h"
+
+#include <algorithm>
+
+uint64_t renderToFile(Player &player, const std::string &filename, uint64_t maxSamples) {
+	WavWriter output(filename, player.getRate(), 1);
+
+	int16_t buffer[renderChunkLength];
+
+	uint64_t samplesWritten = 0;
+	while (player.isPlaying() && samplesWritten < maxSamples) {
+		const size_t samples = std::min<uint64_t>(maxSamples - samplesWritten, renderChunkLength);
+		player.render(buffer, samples);
+		output.write(buffer, samples);
+		samplesWritten += samples;
+	}
+	output.finish();
+
+	return samplesWritten;
+}
@@ -0,0 +1,48 @@
+/* adplayer - A player for SCUMM AD resource files.
+ *
+ * (c) 2011 by Johannes Schickel <lordhoto at gmail dot com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef RENDER_H
+#define RENDER_H
+
+#include <string>
+#include <cstddef>
+#include <stdint.h>
+
+class Player;
+
+/**
+ * Number of samples rendered at once. Players are only checked for the end
+ * of the resource between chunks, thus the output length is a multiple of
+ * this unless it is limited.
+ */
+const size_t renderChunkLength = 4096;
+
+/**
+ * Render a player into a WAV file until it stops playing.
+ *
+ * @param player     Player to render.
+ * @param filename   Name of the WAV file to create.
+ * @param maxSamples Maximum number of samples to render, SFX resources can
+ *                   loop forever.
+ * @return Number of samples written.
+ */
+uint64_t renderToFile(Player &player, const std::string &filename, uint64_t maxSamples);
+
+#endif
@@ -21,15 +21,18 @@
 #include "sfx.h"
 
 #include <cstring>
+#include <stdexcept>
+#include <vector>
 
-SfxPlayer::SfxPlayer(const FileBuffer &file)
-    : Player(file), _isPlaying(false), _timer(4), _rndSeed(1) {
+SfxPlayer::SfxPlayer(const FileBuffer &file, int rate)
+    : Player(file, rate), _isPlaying(false), _timer(4), _rndSeed(1) {
 	writeReg(0xBD, 0x00);
 
-	int startChannel = _file.at(1) * 3;
+	int startChannel = _file[1] * 3;
 	// byte 0 is the priority of the SFX
 
 	std::memset(_channels, 0, sizeof(_channels));
+	std::memset(_notes, 0, sizeof(_notes));
 
 	clearChannel(startChannel+0);
 	clearChannel(startChannel+1);
@@ -41,7 +44,7 @@ SfxPlayer::SfxPlayer(const FileBuffer &file)
 	int curChannel = startChannel + 1;
 	int bufferPosition = 2;
 	uint8_t command = 0;
-	while ((command = _file.at(bufferPosition)) != 0xFF) {
+	while ((command = _file[bufferPosition]) != 0xFF) {
 		switch (command) {
 		case 1:
 			bufferPosition += 15;
@@ -68,6 +71,67 @@ SfxPlayer::SfxPlayer(const FileBuffer &file)
 	_isPlaying = true;
 }
 
+void SfxPlayer::validate(const FileBuffer &data) {
+	checkADOffset(data, 2, "SFX header");
+	// The constructor clears the three channels from the start channel on,
+	// these have to be among the 9 channels of an OPL2.
+	if (data[1] > 2)
+		throwADError("SFX start channel is too big", 1);
+
+	// Find the start of all slots the same way the constructor does.
+	std::vector<uint32_t> slots(1, 2);
+	uint32_t offset = 2;
+	while (true) {
+		checkADOffset(data, offset, "SFX slot table");
+		const uint8_t command = data[offset];
+		if (command == 0xFF)
+			break;
+		else if (command == 1)
+			offset += 15;
+		else if (command == 2)
+			offset += 11;
+		else if (command == 0x80)
+			offset += 1;
+		else
+			slots.push_back(++offset);
+	}
+
+	// Every slot plays on the next channel, none of them may go past the
+	// last OPL2 channel.
+	if (data[1] * 3 + slots.size() > 9)
+		throwADError("SFX uses too many channels", 1);
+
+	// Walk the command chain of every slot.
+	for (std::vector<uint32_t>::const_iterator i = slots.begin(); i != slots.end(); ++i) {
+		bool hasNotes = false;
+		offset = *i;
+		while (true) {
+			checkADOffset(data, offset, "SFX command");
+			const uint8_t command = data[offset];
+			if (command == 1) {
+				checkADOffset(data, offset + 14, "SFX instrument");
+				offset += 15;
+			} else if (command == 2) {
+				checkADOffset(data, offset + 10, "SFX notes");
+				for (uint32_t note = offset + 1; note < offset + 11; note += 5) {
+					if ((data[note] & 0x80) && (data[note] & 0x07) == 0x07)
+						throwADError("Invalid SFX note parameter", note);
+				}
+				hasNotes = true;
+				offset += 11;
+			} else if (command == 0x80) {
+				// Restarting a slot without any notes would never finish
+				// a callback.
+				if (!hasNotes)
+					throwADError("SFX slot loops without notes", offset);
+				break;
+			} else {
+				break;
+			}
+		}
+	}
+}
+
 bool SfxPlayer::isPlaying() const {
 	return _isPlaying;
 }
@@ -90,6 +154,83 @@ void SfxPlayer::callback() {
 	_isPlaying = stillPlaying;
 }
 
+void SfxPlayer::saveSequencer(StateWriter &state) const {
+	state.writeBool(_isPlaying);
+	state.writeUint32(_timer);
+	state.writeByte(_rndSeed);
+
+	for (size_t i = 0; i < sizeof(_channels) / sizeof(_channels[0]); ++i) {
+		const Channel &channel = _channels[i];
+		state.writeUint32(channel.state);
+		state.writeUint32(channel.currentOffset);
+		state.writeUint32(channel.startOffset);
+		for (size_t j = 0; j < sizeof(channel.instrumentData); ++j)
+			state.writeByte(channel.instrumentData[j]);
+	}
+
+	for (size_t i = 0; i < sizeof(_notes) / sizeof(_notes[0]); ++i) {
+		const Note &note = _notes[i];
+		state.writeUint32(note.state);
+		state.writeUint32(note.playTime);
+		state.writeUint32(note.sustainTimer);
+		state.writeUint32(note.instrumentValue);
+		state.writeUint32(note.bias);
+		state.writeUint32(note.preIncrease);
+		state.writeUint32(note.adjust);
+		state.writeUint32(note.envelope.stepIncrease);
+		state.writeUint32(note.envelope.step);
+		state.writeUint32(note.envelope.stepCounter);
+		state.writeUint32(note.envelope.timer);
+	}
+}
+
+void SfxPlayer::loadSequencer(StateReader &state) {
+	const bool isPlaying = state.readBool();
+	const int timer = static_cast<int32_t>(state.readUint32());
+	const uint8_t rndSeed = state.readByte();
+
+	Channel channels[sizeof(_channels) / sizeof(_channels[0])];
+	for (size_t i = 0; i < sizeof(channels) / sizeof(channels[0]); ++i) {
+		Channel &channel = channels[i];
+		channel.state = static_cast<int32_t>(state.readUint32());
+		channel.currentOffset = static_cast<int32_t>(state.readUint32());
+		channel.startOffset = static_cast<int32_t>(state.readUint32());
+		for (size_t j = 0; j < sizeof(channel.instrumentData); ++j)
+			channel.instrumentData[j] = state.readByte();
+
+		// The offsets are used without any checks during playback.
+		if (channel.state < 0 || channel.state > 2
+		    || channel.currentOffset < 0 || static_cast<size_t>(channel.currentOffset) >= _file.size()
+		    || channel.startOffset < 0 || static_cast<size_t>(channel.startOffset) >= _file.size())
+			throw std::runtime_error("Invalid SFX state");
+	}
+
+	Note notes[sizeof(_notes) / sizeof(_notes[0])];
+	for (size_t i = 0; i < sizeof(notes) / sizeof(notes[0]); ++i) {
+		Note &note = notes[i];
+		note.state = static_cast<int32_t>(state.readUint32());
+		note.playTime = static_cast<int32_t>(state.readUint32());
+		note.sustainTimer = static_cast<int32_t>(state.readUint32());
+		note.instrumentValue = static_cast<int32_t>(state.readUint32());
+		note.bias = static_cast<int32_t>(state.readUint32());
+		note.preIncrease = static_cast<int32_t>(state.readUint32());
+		note.adjust = static_cast<int32_t>(state.readUint32());
+		note.envelope.stepIncrease = static_cast<int32_t>(state.readUint32());
+		note.envelope.step = static_cast<int32_t>(state.readUint32());
+		note.envelope.stepCounter = static_cast<int32_t>(state.readUint32());
+		note.envelope.timer = static_cast<int32_t>(state.readUint32());
+	}
+
+	if (timer < 1 || timer > 4)
+		throw std::runtime_error("Invalid SFX state");
+
+	_isPlaying = isPlaying;
+	_timer = timer;
+	_rndSeed = rndSeed;
+	std::memcpy(_channels, channels, sizeof(_channels));
+	std::memcpy(_notes, notes, sizeof(_notes));
+}
+
 void SfxPlayer::clearChannel(int channel) {
 	writeReg(0xA0 + channel, 0x00);
 	writeReg(0xB0 + channel, 0x00);
@@ -106,21 +247,21 @@ void SfxPlayer::parseSlot(int channel) {
 	while (true) {
 		int curOffset = _channels[channel].currentOffset;
 
-		switch (_file.at(curOffset)) {
+		switch (_file[curOffset]) {
 		case 1:
 			++curOffset;
-			_channels[channel].instrumentData[0] = _file.at(curOffset + 0);
-			_channels[channel].instrumentData[1] = _file.at(curOffset + 2);
-			_channels[channel].instrumentData[2] = _file.at(curOffset + 9);
-			_channels[channel].instrumentData[3] = _file.at(curOffset + 8);
-			_channels[channel].instrumentData[4] = _file.at(curOffset + 4);
-			_channels[channel].instrumentData[5] = _file.at(curOffset + 3);
+			_channels[channel].instrumentData[0] = _file[curOffset + 0];
+			_channels[channel].instrumentData[1] = _file[curOffset + 2];
+			_channels[channel].instrumentData[2] = _file[curOffset + 9];
+			_channels[channel].instrumentData[3] = _file[curOffset + 8];
+			_channels[channel].instrumentData[4] = _file[curOffset + 4];
+			_channels[channel].instrumentData[5] = _file[curOffset + 3];
 			_channels[channel].instrumentData[6] = 0;
 
 			setupChannel(channel, curOffset);
 
-			writeReg(0xA0 + channel, _file.at(curOffset + 0));
-			writeReg(0xB0 + channel, _file.at(curOffset + 1) & 0xDF);
+			writeReg(0xA0 + channel, _file[curOffset + 0]);
+			writeReg(0xB0 + channel, _file[curOffset + 1] & 0xDF);
 
 			_channels[channel].currentOffset += 15;
 			break;
@@ -151,7 +292,7 @@ void SfxPlayer::updateSlot(int channel) {
 	int curOffset = _channels[channel].currentOffset + 1;
 
 	for (int num = 0; num <= 1; ++num, curOffset += 5) {
-		if (!(_file.at(curOffset) & 0x80))
+		if (!(_file[curOffset] & 0x80))
 			continue;
 
 		const int note = channel * 2 + num;
@@ -195,14 +336,14 @@ void SfxPlayer::parseNote(int channel, int num, int offset) {
 	if (num)
 		offset += 5;
 
-	if (_file.at(offset) & 0x80) {
+	if (_file[offset] & 0x80) {
 		const int note = channel * 2 + num;
 		_notes[note].state = -1;
 		processNote(note, offset);
 		_notes[note].playTime = 0; 
 
 		if (_file[offset] & 0x20) {
-			_notes[note].playTime = (_file.at(offset + 4) >> 4) * 118;
+			_notes[note].playTime = (_file[offset + 4] >> 4) * 118;
 			_notes[note].playTime += (_file[offset + 4] & 0x0F) * 8;
 		}
 	}
@@ -212,7 +353,7 @@ bool SfxPlayer::processNote(int note, int offset) {
 	if (++_notes[note].state == 4)
 		return true;
 
-	const int instrumentDataOffset = _file.at(offset) & 0x07;
+	const int instrumentDataOffset = _file[offset] & 0x07;
 	_notes[note].bias = _noteBiasTable[instrumentDataOffset];
 
 	uint8_t instrumentDataValue = 0;
@@ -225,18 +366,18 @@ bool SfxPlayer::processNote(int note, int offset) {
 	_notes[note].instrumentValue = noteInstrumentValue;
 
 	if (_notes[note].state == 2) {
-		_notes[note].sustainTimer = _numStepsTable[_file.at(offset + 3) >> 4];
+		_notes[note].sustainTimer = _numStepsTable[_file[offset + 3] >> 4];
 
 		if (_file[offset] & 0x40)
 			_notes[note].sustainTimer = (((getRnd() << 8) * _notes[note].sustainTimer) >> 16) + 1;
 	} else {
 		int timer1, timer2;
 		if (_notes[note].state == 3) {
-			timer1 = _file.at(offset + 3) & 0x0F;
+			timer1 = _file[offset + 3] & 0x0F;
 			timer2 = 0;
 		} else {
-			timer1 = _file.at(offset + _notes[note].state + 1) >> 4;
-			timer2 = _file.at(offset + _notes[note].state + 1) & 0x0F;
+			timer1 = _file[offset + _notes[note].state + 1] >> 4;
+			timer2 = _file[offset + _notes[note].state + 1] & 0x0F;
 		}
 
 		int adjustValue = ((_noteAdjustTable[timer2] * _noteAdjustScaleTable[instrumentDataOffset]) >> 16) - noteInstrumentValue;
@@ -253,7 +394,7 @@ void SfxPlayer::noteOffOn(int channel) {
 }
 
 void SfxPlayer::writeRegisterSpecial(int note, uint8_t value, int offset) {
-	const int dataOffset = _file.at(offset) & 0x07;
+	const int dataOffset = _file[offset] & 0x07;
 	if (dataOffset == 6)
 		return;
 
@@ -25,11 +25,20 @@
 
 class SfxPlayer : public Player {
 public:
-	SfxPlayer(const FileBuffer &file);
+	SfxPlayer(const FileBuffer &file, int rate = 44100);
+
+	/**
+	 * Check the header and the slot chains of a SFX resource, see
+	 * validateADFile.
+	 */
+	static void validate(const FileBuffer &data);
 
 	virtual bool isPlaying() const;
 protected:
 	virtual void callback();
+	virtual const char *getCallbackName() const { return "SfxPlayer::callback"; }
+	virtual void saveSequencer(StateWriter &state) const;
+	virtual void loadSequencer(StateReader &state);
 private:
 	void clearChannel(int channel);
 	void updateChannel(int channel);
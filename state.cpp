@@ -0,0 +1,56 @@
+/* adplayer - A player for SCUMM AD resource files.
+ *
+ * (c) 2011 by Johannes Schickel <lordhoto at gmail dot com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "state.h"
+
+#include <stdexcept>
+
+void StateWriter::writeLE(uint64_t value, int bytes) {
+	for (int i = 0; i < bytes; ++i)
+		_data.push_back(static_cast<uint8_t>(value >> (i * 8)));
+}
+
+void StateReader::skip(size_t bytes) {
+	if (bytes > _left)
+		throw std::runtime_error("State ends unexpectedly");
+	_data += bytes;
+	_left -= bytes;
+}
+
+uint64_t StateReader::readLE(int bytes) {
+	if (static_cast<size_t>(bytes) > _left)
+		throw std::runtime_error("State ends unexpectedly");
+
+	uint64_t value = 0;
+	for (int i = 0; i < bytes; ++i)
+		value |= static_cast<uint64_t>(_data[i]) << (i * 8);
+	_data += bytes;
+	_left -= bytes;
+	return value;
+}
+
+uint32_t stateChecksum(const uint8_t *data, size_t size) {
+	uint32_t hash = 2166136261U;
+	for (size_t i = 0; i < size; ++i) {
+		hash ^= data[i];
+		hash *= 16777619U;
+	}
+	return hash;
+}
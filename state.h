@@ -0,0 +1,84 @@
+/* adplayer - A player for SCUMM AD resource files.
+ *
+ * (c) 2011 by Johannes Schickel <lordhoto at gmail dot com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef STATE_H
+#define STATE_H
+
+#include <vector>
+#include <cstddef>
+#include <stdint.h>
+
+typedef std::vector<uint8_t> StateBuffer;
+
+/**
+ * Appends values to a state snapshot.
+ *
+ * All values are stored in little endian order with a fixed size, thus
+ * snapshots can be exchanged between hosts.
+ */
+class StateWriter {
+public:
+	StateWriter(StateBuffer &data) : _data(data) {}
+
+	void writeByte(uint8_t value) { _data.push_back(value); }
+	void writeUint16(uint16_t value) { writeLE(value, 2); }
+	void writeUint32(uint32_t value) { writeLE(value, 4); }
+	void writeUint64(uint64_t value) { writeLE(value, 8); }
+	void writeBool(bool value) { writeByte(value ? 1 : 0); }
+
+	StateBuffer &getData() { return _data; }
+private:
+	void writeLE(uint64_t value, int bytes);
+
+	StateBuffer &_data;
+};
+
+/**
+ * Reads values from a state snapshot in the order they were written.
+ *
+ * A std::runtime_error is thrown when reading past the end of the snapshot.
+ */
+class StateReader {
+public:
+	StateReader(const uint8_t *data, size_t size) : _data(data), _left(size) {}
+
+	uint8_t readByte() { return static_cast<uint8_t>(readLE(1)); }
+	uint16_t readUint16() { return static_cast<uint16_t>(readLE(2)); }
+	uint32_t readUint32() { return static_cast<uint32_t>(readLE(4)); }
+	uint64_t readUint64() { return readLE(8); }
+	bool readBool() { return readByte() != 0; }
+
+	const uint8_t *getPosition() const { return _data; }
+	size_t getRemaining() const { return _left; }
+	void skip(size_t bytes);
+private:
+	uint64_t readLE(int bytes);
+
+	const uint8_t *_data;
+	size_t _left;
+};
+
+/**
+ * Calculate the FNV-1a hash of some data, used to detect snapshots which do
+ * not belong to a resource or which are corrupt.
+ */
+uint32_t stateChecksum(const uint8_t *data, size_t size);
+
+#endif
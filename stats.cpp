@@ -0,0 +1,116 @@
+/* adplayer - A player for SCUMM AD resource files.
+ *
+ * (c) 2011 by Johannes Schickel <lordhoto at gmail dot com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "stats.h"
+
+#include <stdexcept>
+#include <cstdio>
+
+namespace {
+void writeHistogram(std::FILE *file, const uint32_t *counts, size_t buckets) {
+	std::fputc('[', file);
+	for (size_t i = 0; i < buckets; ++i)
+		std::fprintf(file, i ? ", %u" : "%u", counts[i]);
+	std::fputc(']', file);
+}
+
+void writeOutput(std::FILE *file, const AudioOutput &output, const AudioOutput::Statistics &stats) {
+	std::fprintf(file, ",\n"
+	             "  \"output\": {\n"
+	             "    \"device_samples\": %u,\n"
+	             "    \"callbacks\": %u,\n"
+	             "    \"underruns\": %u,\n"
+	             "    \"quanta\": %u,\n"
+	             "    \"deadline_misses\": %u,\n"
+	             "    \"render_seconds\": %.9f,\n"
+	             "    \"max_render_seconds\": %.9f,\n"
+	             "    \"load_histogram\": ",
+	             static_cast<unsigned int>(output.getDeviceSamples()), stats.callbacks, stats.underruns,
+	             stats.quanta, stats.deadlineMisses, stats.renderSeconds, stats.maxRenderSeconds);
+	writeHistogram(file, stats.loadHistogram, AudioOutput::Statistics::kLoadBuckets);
+
+	std::fprintf(file, ",\n"
+	             "    \"latency\": {\n"
+	             "      \"count\": %u,\n"
+	             "      \"min_seconds\": %.9f,\n"
+	             "      \"avg_seconds\": %.9f,\n"
+	             "      \"max_seconds\": %.9f,\n"
+	             "      \"histogram_ms\": ",
+	             stats.latencyCount, stats.minLatency,
+	             stats.latencyCount ? stats.totalLatency / stats.latencyCount : 0, stats.maxLatency);
+	writeHistogram(file, stats.latencyHistogram, AudioOutput::Statistics::kLatencyBuckets);
+
+	std::fprintf(file, "\n"
+	             "    },\n"
+	             "    \"jitter\": {\n"
+	             "      \"avg_seconds\": %.9f,\n"
+	             "      \"max_seconds\": %.9f\n"
+	             "    }\n"
+	             "  }",
+	             stats.jitterCount ? stats.totalJitter / stats.jitterCount : 0, stats.maxJitter);
+}
+} // End of anonymous namespace
+
+void writeStatistics(const std::string &filename, const Player &player, const Player::Profile &profile,
+                     const AudioOutput *output) {
+	// A started output keeps rendering, its timing and the one of the
+	// player are copied at once and written without holding it up.
+	AudioOutput::Snapshot snapshot;
+	if (output) {
+		snapshot = output->getSnapshot(profile);
+	} else {
+		snapshot.position = player.getPosition();
+		snapshot.profile = profile;
+	}
+
+	const std::string tempName = filename + ".tmp";
+	std::FILE *file = std::fopen(tempName.c_str(), "w");
+	if (!file)
+		throw std::runtime_error("Could not open statistics file: " + tempName);
+
+	std::fprintf(file, "{\n"
+	             "  \"rate\": %d,\n"
+	             "  \"position\": %llu,\n"
+	             "  \"sequencer\": {\n"
+	             "    \"callbacks\": %llu,\n"
+	             "    \"seconds\": %.9f,\n"
+	             "    \"max_seconds\": %.9f\n"
+	             "  },\n"
+	             "  \"synthesis\": {\n"
+	             "    \"blocks\": %llu,\n"
+	             "    \"samples\": %llu,\n"
+	             "    \"seconds\": %.9f,\n"
+	             "    \"max_seconds\": %.9f\n"
+	             "  }",
+	             player.getRate(), static_cast<unsigned long long>(snapshot.position),
+	             static_cast<unsigned long long>(snapshot.profile.callbacks), snapshot.profile.callbackSeconds,
+	             snapshot.profile.maxCallbackSeconds, static_cast<unsigned long long>(snapshot.profile.blocks),
+	             static_cast<unsigned long long>(snapshot.profile.blockSamples), snapshot.profile.synthesisSeconds,
+	             snapshot.profile.maxSynthesisSeconds);
+	if (output)
+		writeOutput(file, *output, snapshot.statistics);
+	std::fprintf(file, "\n}\n");
+
+	const bool failed = std::ferror(file);
+	if (std::fclose(file) || failed)
+		throw std::runtime_error("Writing statistics failed: " + tempName);
+	if (std::rename(tempName.c_str(), filename.c_str()))
+		throw std::runtime_error("Could not replace statistics file: " + filename);
+}
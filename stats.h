@@ -0,0 +1,44 @@
+/* adplayer - A player for SCUMM AD resource files.
+ *
+ * (c) 2011 by Johannes Schickel <lordhoto at gmail dot com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef STATS_H
+#define STATS_H
+
+#include "adplayer.h"
+#include "output.h"
+
+#include <string>
+
+/**
+ * Write the timing of a player as JSON.
+ *
+ * The file is replaced atomically, thus it can be written repeatedly while
+ * other programs read it.
+ *
+ * @param filename Name of the JSON file.
+ * @param player   Player the timing belongs to.
+ * @param profile  Time spent in the sequencer and the emulator.
+ * @param output   Audio output the player is played back with, 0 when it
+ *                 is rendered into a file. It may still be playing.
+ */
+void writeStatistics(const std::string &filename, const Player &player, const Player::Profile &profile,
+                     const AudioOutput *output);
+
+#endif
@@ -0,0 +1,32 @@
+/* adplayer - A player for SCUMM AD resource files.
+ *
+ * (c) 2011 by Johannes Schickel <lordhoto at gmail dot com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "timeline.h"
+
+void Timeline::addWrite(uint32_t callback, uint8_t reg, uint8_t value) {
+	if (_batches.empty() || _batches.back().callback != callback) {
+		const Batch batch = { callback, static_cast<uint32_t>(_writes.size()) };
+		_batches.push_back(batch);
+	}
+
+	const Write write = { reg, value };
+	_writes.push_back(write);
+	++_batches.back().end;
+}
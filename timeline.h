@@ -0,0 +1,82 @@
+/* adplayer - A player for SCUMM AD resource files.
+ *
+ * (c) 2011 by Johannes Schickel <lordhoto at gmail dot com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef TIMELINE_H
+#define TIMELINE_H
+
+#include <vector>
+#include <cstddef>
+#include <stdint.h>
+
+/**
+ * Register writes of a resource, compiled once ahead of playback.
+ *
+ * The writes are grouped into batches by the callback they happen in, so
+ * playback only has to replay the batch of the current callback instead of
+ * parsing the resource.
+ */
+class Timeline {
+public:
+	struct Write {
+		uint8_t reg;
+		uint8_t value;
+	};
+
+	Timeline() : _batches(), _writes(), _length(0) {}
+
+	/**
+	 * Add a register write. Writes have to be added in the order of their
+	 * callbacks.
+	 */
+	void addWrite(uint32_t callback, uint8_t reg, uint8_t value);
+
+	/**
+	 * Set the number of callbacks the resource plays.
+	 */
+	void setLength(uint32_t length) { _length = length; }
+	uint32_t getLength() const { return _length; }
+
+	/**
+	 * Number of batches, callbacks without writes have none.
+	 */
+	size_t getBatchCount() const { return _batches.size(); }
+
+	/**
+	 * Number of writes added so far, the index of the next one.
+	 */
+	uint32_t getWriteCount() const { return _writes.size(); }
+
+	uint32_t getBatchCallback(size_t batch) const { return _batches[batch].callback; }
+	const Write *getBatchBegin(size_t batch) const { return &_writes[0] + (batch ? _batches[batch - 1].end : 0); }
+	const Write *getBatchEnd(size_t batch) const { return &_writes[0] + _batches[batch].end; }
+	const Write *getWrite(uint32_t index) const { return &_writes[0] + index; }
+private:
+	struct Batch {
+		uint32_t callback;
+		// The writes of a batch end where the ones of the next begin.
+		uint32_t end;
+	};
+
+	std::vector<Batch> _batches;
+	std::vector<Write> _writes;
+	uint32_t _length;
+};
+
+#endif
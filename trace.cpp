@@ -0,0 +1,114 @@
+/* adplayer - A player for SCUMM AD resource files.
+ *
+ * (c) 2011 by Johannes Schickel <lordhoto at gmail dot com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "trace.h"
+
+#include <stdexcept>
+#include <cstdio>
+
+Trace::Track::Track(const std::string &name, uint32_t id, size_t maxEvents)
+    : _name(name), _id(id), _maxEvents(maxEvents), _events(), _droppedDepth(0), _dropped(0) {
+}
+
+void Trace::Track::begin(const char *name, const char *argName, uint32_t arg) {
+	if (!add('B', name, argName, arg, 0, 0))
+		++_droppedDepth;
+}
+
+void Trace::Track::end() {
+	// The end of a span which was recorded is always kept, otherwise the
+	// trace would not be balanced.
+	if (_droppedDepth) {
+		--_droppedDepth;
+		++_dropped;
+		return;
+	}
+
+	const Event event = { Clock::now(), 0, 'E', { 0, 0 }, { 0, 0 } };
+	_events.push_back(event);
+}
+
+void Trace::Track::instant(const char *name, const char *argName1, uint32_t arg1, const char *argName2, uint32_t arg2) {
+	add('i', name, argName1, arg1, argName2, arg2);
+}
+
+bool Trace::Track::add(char phase, const char *name, const char *argName1, uint32_t arg1,
+                       const char *argName2, uint32_t arg2) {
+	if (_events.size() >= _maxEvents) {
+		++_dropped;
+		return false;
+	}
+
+	const Event event = { Clock::now(), name, phase, { argName1, argName2 }, { arg1, arg2 } };
+	_events.push_back(event);
+	return true;
+}
+
+Trace::Trace(size_t maxEvents)
+    : _start(Clock::now()), _maxEvents(maxEvents), _tracks() {
+}
+
+Trace::Track &Trace::addTrack(const std::string &name) {
+	_tracks.push_back(boost::shared_ptr<Track>(new Track(name, _tracks.size() + 1, _maxEvents)));
+	return *_tracks.back();
+}
+
+void Trace::write(const std::string &filename) const {
+	std::FILE *file = std::fopen(filename.c_str(), "w");
+	if (!file)
+		throw std::runtime_error("Could not open trace file: " + filename);
+
+	uint64_t dropped = 0;
+	std::fprintf(file, "{\"traceEvents\":[\n");
+	for (std::vector<boost::shared_ptr<Track> >::const_iterator i = _tracks.begin(); i != _tracks.end(); ++i) {
+		const Track &track = **i;
+		dropped += track._dropped;
+
+		// The names are our own, thus they need no escaping.
+		std::fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+		             i == _tracks.begin() ? "" : ",\n", track._id, track._name.c_str());
+
+		for (std::vector<Track::Event>::const_iterator e = track._events.begin(); e != track._events.end(); ++e) {
+			const double ts = boost::chrono::duration<double, boost::micro>(e->time - _start).count();
+			if (e->phase == 'E') {
+				std::fprintf(file, ",\n{\"ph\":\"E\",\"ts\":%.3f,\"pid\":1,\"tid\":%u}", ts, track._id);
+				continue;
+			}
+
+			std::fprintf(file, ",\n{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%u",
+			             e->name, e->phase, ts, track._id);
+			if (e->phase == 'i')
+				std::fprintf(file, ",\"s\":\"t\"");
+			if (e->argNames[0]) {
+				std::fprintf(file, ",\"args\":{\"%s\":%u", e->argNames[0], e->args[0]);
+				if (e->argNames[1])
+					std::fprintf(file, ",\"%s\":%u", e->argNames[1], e->args[1]);
+				std::fputc('}', file);
+			}
+			std::fputc('}', file);
+		}
+	}
+	std::fprintf(file, "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped_events\":%llu}}\n",
+	             static_cast<unsigned long long>(dropped));
+
+	const bool failed = std::ferror(file);
+	if (std::fclose(file) || failed)
+		throw std::runtime_error("Writing trace failed: " + filename);
+}
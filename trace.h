@@ -0,0 +1,118 @@
+/* adplayer - A player for SCUMM AD resource files.
+ *
+ * (c) 2011 by Johannes Schickel <lordhoto at gmail dot com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "dbopl.h"
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <stdint.h>
+
+#include <boost/chrono.hpp>
+#include <boost/shared_ptr.hpp>
+
+/**
+ * Collects timed events and writes them in the Chrome trace event format,
+ * which can be viewed with chrome://tracing or Perfetto.
+ *
+ * Events are recorded into tracks, each of which is shown as a thread of
+ * its own. A track may only be used by one thread at a time. All events are
+ * kept in memory until the trace is written, once a track holds the maximum
+ * number of events further ones are dropped.
+ */
+class Trace {
+public:
+	typedef boost::chrono::steady_clock Clock;
+
+	class Track : public DBOPL::TraceHandler {
+	public:
+		/**
+		 * Start a span, spans have to be ended in the reverse order they
+		 * were started in. The names are not copied.
+		 */
+		void begin(const char *name) { begin(name, 0, 0); }
+		void begin(const char *name, const char *argName, uint32_t arg);
+		void end();
+
+		/**
+		 * Add an event without duration.
+		 */
+		void instant(const char *name, const char *argName1, uint32_t arg1, const char *argName2, uint32_t arg2);
+
+		virtual void BeginSpan(const char *name, const char *argName, DBOPL::Bitu arg) { begin(name, argName, arg); }
+		virtual void EndSpan() { end(); }
+	private:
+		friend class Trace;
+		Track(const std::string &name, uint32_t id, size_t maxEvents);
+
+		struct Event {
+			Clock::time_point time;
+			const char *name;
+			char phase;
+			const char *argNames[2];
+			uint32_t args[2];
+		};
+
+		bool add(char phase, const char *name, const char *argName1, uint32_t arg1,
+		         const char *argName2, uint32_t arg2);
+
+		const std::string _name;
+		const uint32_t _id;
+		const size_t _maxEvents;
+		std::vector<Event> _events;
+
+		/**
+		 * Spans started after the track was full, their ends are dropped
+		 * too.
+		 */
+		uint32_t _droppedDepth;
+		uint64_t _dropped;
+	};
+
+	/**
+	 * @param maxEvents Maximum number of events kept per track.
+	 */
+	Trace(size_t maxEvents = 1 << 22);
+
+	/**
+	 * Add a track. This may not be done while other tracks are in use.
+	 *
+	 * @param name Name the track is shown with.
+	 * @return Track owned by the trace.
+	 */
+	Track &addTrack(const std::string &name);
+
+	/**
+	 * Write all events recorded so far as JSON. No track may be in use
+	 * meanwhile.
+	 *
+	 * @param filename Name of the file to create.
+	 */
+	void write(const std::string &filename) const;
+private:
+	const Clock::time_point _start;
+	const size_t _maxEvents;
+	std::vector<boost::shared_ptr<Track> > _tracks;
+};
+
+#endif
@@ -0,0 +1,93 @@
+/* adplayer - A player for SCUMM AD resource files.
+ *
+ * (c) 2011 by Johannes Schickel <lordhoto at gmail dot com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "wav.h"
+
+#include <stdexcept>
+#include <algorithm>
+
+WavWriter::WavWriter(const std::string &filename, int rate, int channels)
+    : _file(std::fopen(filename.c_str(), "wb")), _rate(rate),
+      _channels(channels), _dataSize(0) {
+	if (!_file)
+		throw std::runtime_error("Could not open output file: " + filename);
+
+	writeHeader();
+}
+
+WavWriter::~WavWriter() {
+	if (_file)
+		std::fclose(_file);
+}
+
+void WavWriter::write(const int16_t *samples, size_t count) {
+	uint8_t buffer[4096];
+
+	while (count > 0) {
+		const size_t toWrite = std::min(count, sizeof(buffer) / 2);
+		for (size_t i = 0; i < toWrite; ++i) {
+			buffer[i * 2 + 0] = samples[i] & 0xFF;
+			buffer[i * 2 + 1] = (samples[i] >> 8) & 0xFF;
+		}
+
+		if (std::fwrite(buffer, 2, toWrite, _file) != toWrite)
+			throw std::runtime_error("Writing to output file failed");
+
+		_dataSize += toWrite * 2;
+		samples += toWrite;
+		count -= toWrite;
+	}
+}
+
+void WavWriter::finish() {
+	if (std::fseek(_file, 0, SEEK_SET) == -1)
+		throw std::runtime_error("Seeking failed");
+	writeHeader();
+
+	const int result = std::fclose(_file);
+	_file = 0;
+	if (result != 0)
+		throw std::runtime_error("Closing output file failed");
+}
+
+void WavWriter::writeHeader() {
+	std::fwrite("RIFF", 1, 4, _file);
+	writeLE(36 + _dataSize, 4);
+	std::fwrite("WAVEfmt ", 1, 8, _file);
+	writeLE(16, 4);
+	writeLE(1, 2);
+	writeLE(_channels, 2);
+	writeLE(_rate, 4);
+	writeLE(_rate * _channels * 2, 4);
+	writeLE(_channels * 2, 2);
+	writeLE(16, 2);
+	std::fwrite("data", 1, 4, _file);
+	writeLE(_dataSize, 4);
+
+	if (std::ferror(_file))
+		throw std::runtime_error("Writing to output file failed");
+}
+
+void WavWriter::writeLE(uint32_t value, int bytes) {
+	for (int i = 0; i < bytes; ++i) {
+		std::fputc(value & 0xFF, _file);
+		value >>= 8;
+	}
+}
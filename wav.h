@@ -0,0 +1,53 @@
+/* adplayer - A player for SCUMM AD resource files.
+ *
+ * (c) 2011 by Johannes Schickel <lordhoto at gmail dot com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef WAV_H
+#define WAV_H
+
+#include <string>
+#include <cstdio>
+#include <stdint.h>
+
+/**
+ * Writes signed 16bit PCM data into a RIFF WAVE file.
+ *
+ * The header is written with a zero length first and fixed up in finish().
+ */
+class WavWriter {
+public:
+	WavWriter(const std::string &filename, int rate, int channels);
+	~WavWriter();
+
+	void write(const int16_t *samples, size_t count);
+	void finish();
+private:
+	WavWriter(const WavWriter &);
+	WavWriter &operator=(const WavWriter &);
+
+	void writeHeader();
+	void writeLE(uint32_t value, int bytes);
+
+	std::FILE *_file;
+	const int _rate;
+	const int _channels;
+	uint32_t _dataSize;
+};
+
+#endif
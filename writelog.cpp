@@ -0,0 +1,185 @@
+/* adplayer - A player for SCUMM AD resource files.
+ *
+ * (c) 2011 by Johannes Schickel <lordhoto at gmail dot com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "writelog.h"
+
+#include <stdexcept>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <cstring>
+
+namespace {
+const char writeLogMagic[4] = { 'A', 'D', 'W', 'L' };
+const uint8_t writeLogVersion = 1;
+// Magic, version and rate
+const size_t writeLogHeaderSize = 9;
+} // End of anonymous namespace
+
+WriteLog::WriteLog(int rate)
+    : _rate(rate), _events(), _position(0), _finished(false), _highWrites(false) {
+}
+
+void WriteLog::addWrite(uint64_t position, uint16_t reg, uint8_t value) {
+	addEvent(position, (reg & 0x100) ? kEventWriteHigh : kEventWrite);
+	_highWrites |= (reg & 0x100) != 0;
+	_events.push_back(reg & 0xFF);
+	_events.push_back(value);
+}
+
+void WriteLog::addBlock(uint64_t position) {
+	addEvent(position, kEventBlock);
+}
+
+void WriteLog::finish(uint64_t position) {
+	addEvent(position, kEventEnd);
+	_finished = true;
+}
+
+void WriteLog::addEvent(uint64_t position, EventType type) {
+	if (_finished)
+		throw std::runtime_error("Write log is already finished");
+	if (position < _position)
+		throw std::runtime_error("Write log events are out of order");
+
+	uint64_t code = ((position - _position) << 2) | type;
+	_position = position;
+	do {
+		_events.push_back((code & 0x7F) | (code >= 0x80 ? 0x80 : 0x00));
+		code >>= 7;
+	} while (code);
+}
+
+void WriteLog::readEvent(size_t &offset, uint64_t &position, Event &event) const {
+	uint64_t code = 0;
+	for (int shift = 0; ; shift += 7) {
+		if (offset >= _events.size() || shift > 63)
+			throw std::runtime_error("Invalid write log event");
+		const uint8_t byte = _events[offset++];
+		code |= static_cast<uint64_t>(byte & 0x7F) << shift;
+		if (!(byte & 0x80))
+			break;
+	}
+
+	position += code >> 2;
+	event.type = static_cast<EventType>(code & 3);
+	event.position = position;
+	event.reg = 0;
+	event.value = 0;
+
+	if (event.type == kEventWrite || event.type == kEventWriteHigh) {
+		if (offset + 2 > _events.size())
+			throw std::runtime_error("Invalid write log event");
+		event.reg = _events[offset] | (event.type == kEventWriteHigh ? 0x100 : 0);
+		event.value = _events[offset + 1];
+		offset += 2;
+	}
+}
+
+void WriteLog::save(const std::string &filename) const {
+	if (!_finished)
+		throw std::runtime_error("Write log is not finished");
+
+	std::ofstream file(filename.c_str(), std::ios::binary);
+	if (!file)
+		throw std::runtime_error("Could not open write log: " + filename);
+
+	uint8_t header[writeLogHeaderSize];
+	std::memcpy(header, writeLogMagic, sizeof(writeLogMagic));
+	header[4] = writeLogVersion;
+	for (int i = 0; i < 4; ++i)
+		header[5 + i] = (static_cast<uint32_t>(_rate) >> (i * 8)) & 0xFF;
+
+	file.write(reinterpret_cast<const char *>(header), sizeof(header));
+	file.write(reinterpret_cast<const char *>(&_events[0]), _events.size());
+	if (!file)
+		throw std::runtime_error("Writing write log failed: " + filename);
+}
+
+void WriteLog::load(const std::string &filename) {
+	std::ifstream file(filename.c_str(), std::ios::binary);
+	if (!file)
+		throw std::runtime_error("Could not open write log: " + filename);
+
+	std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	if (data.size() < writeLogHeaderSize || std::memcmp(&data[0], writeLogMagic, sizeof(writeLogMagic)))
+		throw std::runtime_error("Not a write log: " + filename);
+	if (data[4] != writeLogVersion)
+		throw std::runtime_error("Unsupported write log version: " + filename);
+
+	uint32_t rate = 0;
+	for (int i = 0; i < 4; ++i)
+		rate |= static_cast<uint32_t>(data[5 + i]) << (i * 8);
+	if (rate < 1000 || rate > 192000)
+		throw std::runtime_error("Invalid write log rate: " + filename);
+
+	WriteLog log(rate);
+	log._events.assign(data.begin() + writeLogHeaderSize, data.end());
+
+	// Walk through all events, so playing the log can not fail.
+	size_t offset = 0;
+	uint64_t position = 0;
+	Event event;
+	do {
+		log.readEvent(offset, position, event);
+		log._highWrites |= event.type == kEventWriteHigh;
+	} while (event.type != kEventEnd);
+	if (offset != log._events.size())
+		throw std::runtime_error("Write log has data after its end: " + filename);
+
+	log._position = position;
+	log._finished = true;
+	*this = log;
+}
+
+template<class ChipType>
+WriteLogPlayer<ChipType>::WriteLogPlayer(const WriteLog &log, ChipType &chip)
+    : _log(log), _chip(chip), _offset(0), _eventPosition(0), _position(0), _next(), _hasNext(false) {
+	if (!_log.isFinished())
+		throw std::runtime_error("Write log is not finished");
+
+	_chip.Setup(_log.getRate());
+}
+
+template<class ChipType>
+size_t WriteLogPlayer<ChipType>::generate(int32_t *dst, size_t maxSamples) {
+	// Pass on all events up to the current position.
+	while (true) {
+		if (!_hasNext) {
+			_log.readEvent(_offset, _eventPosition, _next);
+			_hasNext = true;
+		}
+		if (_next.position > _position)
+			break;
+		if (_next.type == WriteLog::kEventEnd)
+			return 0;
+		if (_next.type != WriteLog::kEventBlock)
+			_chip.WriteReg(_next.reg, _next.value);
+		_hasNext = false;
+	}
+
+	const size_t samples = std::min<uint64_t>(_next.position - _position, maxSamples);
+	_chip.GenerateBlock2(samples, dst);
+	_position += samples;
+	return samples;
+}
+
+template class WriteLogPlayer<DBOPL::Chip>;
+template class WriteLogPlayer<DBOPL::Opl2Chip>;
@@ -0,0 +1,161 @@
+/* adplayer - A player for SCUMM AD resource files.
+ *
+ * (c) 2011 by Johannes Schickel <lordhoto at gmail dot com>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef WRITELOG_H
+#define WRITELOG_H
+
+#include "dbopl.h"
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <stdint.h>
+
+/**
+ * Compact log of the register writes passed to an emulator, together with
+ * the sample position of every write and the blocks the output was
+ * generated in.
+ *
+ * Replaying a log with WriteLogPlayer reproduces the output of the emulator
+ * exactly, without the sequencer or the resource the writes came from.
+ *
+ * Every event is stored as a LEB128 number holding the samples since the
+ * previous event shifted left by two and the event type in the low bits.
+ * Writes are followed by the register and the value.
+ */
+class WriteLog {
+public:
+	enum EventType {
+		kEventWrite = 0,
+		kEventWriteHigh = 1,
+		kEventBlock = 2,
+		kEventEnd = 3
+	};
+
+	struct Event {
+		EventType type;
+		uint64_t position;
+		uint16_t reg;
+		uint8_t value;
+	};
+
+	/**
+	 * @param rate Sample rate of the emulator.
+	 */
+	WriteLog(int rate = 44100);
+
+	/**
+	 * Add a write. Events have to be added in the order of their positions.
+	 *
+	 * @param position Position of the write in samples.
+	 */
+	void addWrite(uint64_t position, uint16_t reg, uint8_t value);
+
+	/**
+	 * Add the start of a block the emulator generates at once.
+	 */
+	void addBlock(uint64_t position);
+
+	/**
+	 * End the log, no events can be added afterwards.
+	 *
+	 * @param position Position of the end of the output.
+	 */
+	void finish(uint64_t position);
+
+	bool isFinished() const { return _finished; }
+	int getRate() const { return _rate; }
+
+	/**
+	 * @return Position of the end of the output, only valid once finished.
+	 */
+	uint64_t getLength() const { return _position; }
+
+	/**
+	 * @return Whether the log writes to the second register bank, which
+	 *         only a DBOPL::Chip has. Logs of the players never do.
+	 */
+	bool hasHighWrites() const { return _highWrites; }
+
+	/**
+	 * Decode the event at an offset of the event data.
+	 *
+	 * @param offset   Offset of the event, advanced past it.
+	 * @param position Position of the previous event, advanced to the one
+	 *                 of the decoded event.
+	 * @param event    Decoded event.
+	 */
+	void readEvent(size_t &offset, uint64_t &position, Event &event) const;
+
+	/**
+	 * Store the log in a file, it has to be finished.
+	 */
+	void save(const std::string &filename) const;
+
+	/**
+	 * Load a log from a file. A std::runtime_error is thrown when the file
+	 * is no valid log.
+	 */
+	void load(const std::string &filename);
+private:
+	void addEvent(uint64_t position, EventType type);
+
+	int _rate;
+	std::vector<uint8_t> _events;
+	uint64_t _position;
+	bool _finished;
+	bool _highWrites;
+};
+
+/**
+ * Feeds the writes of a log into an emulator and generates its output.
+ *
+ * The players use DBOPL::Opl2Chip, thus their logs replay on it. Logs with
+ * writes to the second register bank need a DBOPL::Chip.
+ */
+template<class ChipType>
+class WriteLogPlayer {
+public:
+	/**
+	 * @param log  Finished log, it has to stay valid while playing.
+	 * @param chip Emulator to write to, it is set up for the rate of the log.
+	 */
+	WriteLogPlayer(const WriteLog &log, ChipType &chip);
+
+	/**
+	 * Generate the next block of mono output with GenerateBlock2.
+	 *
+	 * All writes up to the start of the block are passed to the emulator
+	 * first. Blocks end at the next event or after maxSamples.
+	 *
+	 * @return Number of samples generated, 0 at the end of the log.
+	 */
+	size_t generate(int32_t *dst, size_t maxSamples);
+private:
+	const WriteLog &_log;
+	ChipType &_chip;
+	size_t _offset;
+	uint64_t _eventPosition;
+	uint64_t _position;
+	WriteLog::Event _next;
+	bool _hasNext;
+};
+
+#endif